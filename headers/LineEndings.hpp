@@ -9,6 +9,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 
 namespace omtt
@@ -36,4 +37,58 @@ changeLineEndingsToLf(std::string &buffer)
     replace(buffer, "\r", "\n");
 }
 
+/*
+ * Changes line endings of a text given in chunks, the CR LF pair
+ * may be split between two chunks.
+ */
+class LfNormalizer
+{
+public:
+    LfNormalizer()
+        :
+        fLastWasCr(false)
+    {
+    }
+
+    std::string_view
+    Normalize(const std::string_view &chunk)
+    {
+        if (chunk.empty()) {
+            return chunk;
+        }
+
+        const std::string_view::size_type begin = (fLastWasCr && chunk.front() == '\n') ? 1 : 0;
+        fLastWasCr = false;
+
+        std::string_view::size_type cr = chunk.find('\r', begin);
+        if (cr == std::string_view::npos) {
+            return chunk.substr(begin);
+        }
+
+        fBuffer.assign(chunk.data() + begin, cr - begin);
+
+        for (auto i = cr; i < chunk.size(); ++i) {
+            if (chunk[i] != '\r') {
+                fBuffer += chunk[i];
+                continue;
+            }
+
+            fBuffer += '\n';
+
+            if (i + 1 == chunk.size()) {
+                fLastWasCr = true;
+            }
+            else if (chunk[i + 1] == '\n') {
+                ++i;
+            }
+        }
+
+        return fBuffer;
+    }
+
+private:
+    std::string fBuffer;
+    bool fLastWasCr;
+};
+
 }  // omtt
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/LineEndings.hpp"
+#include "headers/OutputObserver.hpp"
+#include "headers/TestData.hpp"
+#include "headers/expectation/PartialOutputExpectation.hpp"
+#include "headers/expectation/PreparationContext.hpp"
+#include "headers/expectation/StreamingExpectation.hpp"
+#include "headers/expectation/detail/MultiPatternMatcher.hpp"
+#include "headers/normalize/Normalizer.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace omtt
+{
+
+/*
+ * Changes line endings of the SUT output, applies the test filters and
+ * passes it to the streaming expectations. Texts of all partial output expectations are searched
+ * together in one pass. The whole output is kept only when other
+ * expectations need it, the output is dropped when no expectation
+ * needs more of it.
+ */
+class OutputDispatcher : public OutputObserver
+{
+public:
+                 OutputDispatcher(const TestData &testData,
+                                  const expectation::PreparationContext &context);
+
+    void         OnOutput(const std::string_view &chunk);
+
+    std::string  TakeOutput();
+
+private:
+    void         _Dispatch(const std::string_view &normalized);
+    bool         _NeedsOutput() const;
+    void         _MarkFoundPartialOutputs();
+
+private:
+    LfNormalizer                                              fNormalizer;
+    std::optional<normalize::Normalizer>                      fFilters;
+    std::string                                               fFilteredChunk;
+    std::vector<expectation::StreamingExpectation *>          fStreamingExpectations;
+    std::vector<expectation::PartialOutputExpectation *>      fPartialOutputExpectations;
+    std::optional<expectation::detail::MultiPatternMatcher>   fPartialOutputMatcher;
+    bool                                                      fIsOutputKept;
+    std::string                                               fOutput;
+};
+
+}  // omtt
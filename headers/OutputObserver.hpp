@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string_view>
+
+
+namespace omtt
+{
+
+/*
+ * Receives the SUT standard output as it is read from the pipe.
+ */
+class OutputObserver
+{
+public:
+    virtual      ~OutputObserver() = default;
+
+    virtual void OnOutput(const std::string_view &chunk) = 0;
+};
+
+}  // omtt
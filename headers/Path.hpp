@@ -9,6 +9,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 
@@ -18,4 +19,22 @@ namespace omtt
 typedef std::string Path;
 typedef std::vector<Path> TestPaths;
 
+/*
+ * Paths written in a test file are relative to the directory of that file.
+ */
+inline Path
+resolvePath(const Path &testFilePath, const std::string_view &path)
+{
+    if (path.empty() || path.front() == '/') {
+        return Path(path);
+    }
+
+    const Path::size_type lastSlash = testFilePath.rfind('/');
+    if (lastSlash == Path::npos) {
+        return Path(path);
+    }
+
+    return testFilePath.substr(0, lastSlash + 1).append(path);
+}
+
 }  // omtt
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include "headers/ResourceUsage.hpp"
+
+#include <optional>
 #include <string>
 
 
@@ -19,6 +22,10 @@ struct ProcessResults
     int exitCode;
     std::string output;
     std::string errors;
+    ResourceUsage resources;
+
+    // the error output checked by the expectations, set only when they need it
+    std::optional<std::string> normalizedErrors;
 };
 
 }  // omtt
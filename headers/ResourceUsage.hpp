@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+
+namespace omtt
+{
+
+// resources used by the SUT process, as reported by wait4()
+struct ResourceUsage
+{
+    std::chrono::nanoseconds wallTime{0};
+    std::chrono::microseconds userTime{0};
+    std::chrono::microseconds systemTime{0};
+    std::int64_t maxResidentSetSizeKb = 0;
+    std::int64_t minorPageFaults = 0;
+    std::int64_t majorPageFaults = 0;
+    std::int64_t voluntaryContextSwitches = 0;
+    std::int64_t involuntaryContextSwitches = 0;
+};
+
+}  // omtt
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "headers/OutputObserver.hpp"
 #include "headers/ProcessResults.hpp"
 
+#include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -17,9 +20,16 @@
 namespace omtt
 {
 
+/*
+ * When the input file is given, it becomes the SUT standard input
+ * and the input string is not used. When the output observer is given,
+ * the standard output is passed to it instead of the process results.
+ */
 ProcessResults
 RunProcess(const std::string &path,
            const std::vector<std::string> &options,
-           const std::string_view &input);
+           const std::string_view &input,
+           const std::optional<std::string> &inputFilePath = std::nullopt,
+           OutputObserver *outputObserver = nullptr);
 
 }  // omtt
@@ -9,8 +9,11 @@
 #pragma once
 
 #include "headers/expectation/Expectation.hpp"
+#include "headers/normalize/Filter.hpp"
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -21,7 +24,14 @@ namespace omtt
 struct TestData
 {
     std::string_view input;
+    std::optional<std::string_view> inputFile;
     std::vector<std::unique_ptr<expectation::Expectation>> expectations;
+
+    // filters applied to the output and to the expected texts
+    normalize::Filters normalization;
+
+    // expected texts changed by the filters, referenced by the expectations
+    std::vector<std::unique_ptr<const std::string>> normalizedTexts;
 };
 
 }  // omtt
@@ -11,6 +11,7 @@
 #include "headers/Verdict.hpp"
 #include "headers/expectation/validation/ValidationResult.hpp"
 
+#include <chrono>
 #include <ostream>
 #include <vector>
 
@@ -22,6 +23,9 @@ struct TestExecutionSummary
 {
     Verdict verdict;
     std::vector<expectation::validation::ValidationResult::Cause> causes;
+
+    // the SUT execution and the validation time
+    std::chrono::nanoseconds duration{0};
 };
 
 }  // omtt
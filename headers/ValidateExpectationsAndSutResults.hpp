@@ -16,8 +16,21 @@
 namespace omtt
 {
 
+enum class ValidationMode
+{
+    ALL_CAUSES,
+    VERDICT_ONLY
+};
+
+/*
+ * In the VERDICT_ONLY mode the cheap expectations are checked first,
+ * the validation stops at the first not satisfied expectation and
+ * the summary has no causes. In the ALL_CAUSES mode the causes are
+ * built only for the not satisfied expectations.
+ */
 TestExecutionSummary
 ValidateExpectationsAndSutResults(const TestData&,
-                                  const ProcessResults&);
+                                  const ProcessResults&,
+                                  const ValidationMode mode = ValidationMode::ALL_CAUSES);
 
 }  // omtt
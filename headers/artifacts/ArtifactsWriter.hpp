@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/OutputObserver.hpp"
+#include "headers/Path.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <sys/types.h>
+
+
+namespace omtt::artifacts
+{
+
+// the test name with '%' and the directories separators escaped, so different
+// tests never share a name, e.g. "dir%2Ftest.omtt#2"
+std::string
+artifact_name(const Path &testName);
+
+/*
+ * Keeps the SUT output of the running test in memory, the output bigger
+ * than MEMORY_OUTPUT_SIZE is moved to an anonymous spill file (memfd when
+ * available). The output, the error output and the input of the failed
+ * test are saved to the artifacts directory, the spilled output is copied
+ * by the kernel. Nothing is written to the directory for the passed tests.
+ */
+class ArtifactsWriter : public OutputObserver
+{
+public:
+    static constexpr std::string::size_type MEMORY_OUTPUT_SIZE = 1024 * 1024;
+
+    explicit         ArtifactsWriter(const Path &directoryPath);
+                     ~ArtifactsWriter();
+
+                     ArtifactsWriter(const ArtifactsWriter &) = delete;
+    ArtifactsWriter &operator=(const ArtifactsWriter &) = delete;
+
+    // starts recording the next test output, it is passed to the observer too
+    OutputObserver & Record(OutputObserver &observer);
+
+    void             OnOutput(const std::string_view &chunk) override;
+
+    // writes <test>.stdout, <test>.stderr and <test>.input files
+    void             Save(const Path &testName,
+                          const std::string_view &errors,
+                          const std::string_view &input,
+                          const std::optional<Path> &inputFilePath);
+
+private:
+    int              _CreateSpillFile();
+    int              _CreateArtifact(const Path &testName, const char *suffix);
+
+private:
+    const Path       fDirectoryPath;
+    int              fDirectoryFd;
+    int              fSpillFd;
+    off_t            fSpillSize;
+    std::string      fOutput;
+    OutputObserver * fObserver;
+};
+
+}  // omtt::artifacts
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/cache/detail/Format.hpp"
+#include "headers/lexer/Token.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace omtt::cache
+{
+
+/*
+ * Passes tokens from the given lexer and remembers them as offsets
+ * into the test file buffer, so they can be stored in the cache.
+ */
+template<class Lexer>
+class RecordingLexer
+{
+public:
+    RecordingLexer(Lexer &lexer, const std::string &inputBuffer)
+        :
+        fLexer(lexer),
+        fInputBuffer(inputBuffer)
+    {
+    }
+
+    std::optional<const lexer::Token>
+    FindNextToken()
+    {
+        auto token = fLexer.FindNextToken();
+
+        if (token.has_value()) {
+            fRecords.push_back({static_cast<std::uint64_t>(token->value.data() - fInputBuffer.data()),
+                                token->value.length(),
+                                static_cast<std::uint32_t>(token->kind),
+                                0});
+        }
+
+        return token;
+    }
+
+    std::vector<detail::TokenRecord> &
+    GetRecords()
+    {
+        return fRecords;
+    }
+
+private:
+    Lexer &fLexer;
+    const std::string &fInputBuffer;
+    std::vector<detail::TokenRecord> fRecords;
+};
+
+}  // omtt::cache
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/Path.hpp"
+#include "headers/TestData.hpp"
+#include "headers/cache/detail/Format.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace omtt::cache
+{
+
+/*
+ * Suite level cache of the lexer results, stored in one memory mapped
+ * file. Entries are keyed by test file path, size and modification time,
+ * so the file content isn't hashed; any mismatch falls back to the lexer
+ * and refreshes the entry.
+ */
+class TestCache
+{
+public:
+    explicit                     TestCache(const Path &cacheFilePath);
+                                 ~TestCache();
+
+                                 TestCache(const TestCache &) = delete;
+    TestCache &                  operator=(const TestCache &) = delete;
+
+    std::vector<TestData>        Parse(const Path &testFilePath, const std::string &testFileBuffer);
+
+    // the number of tests of the up to date entry, the file isn't read
+    std::optional<std::size_t>   FindTestsCount(const Path &testFilePath) const;
+    void                         Save();
+
+private:
+    struct UpdatedEntry
+    {
+        detail::Entry entry;
+        std::vector<detail::TokenRecord> tokens;
+    };
+
+private:
+    void                         _Map();
+    bool                         _IsMappingValid();
+    const detail::Entry *        _FindEntry(const Path &testFilePath, const std::uint64_t pathHash) const;
+    static bool                  _IsEntryUpToDate(const detail::Entry &entry, const detail::Entry &current);
+    std::string_view             _EntryPath(const detail::Entry &entry) const;
+
+private:
+    const Path                   fCacheFilePath;
+    void *                       fMapping;
+    size_t                       fMappingSize;
+    const detail::Header *       fHeader;
+    const detail::Entry *        fEntries;
+    const detail::TokenRecord *  fTokens;
+    const char *                 fStrings;
+    std::map<Path, UpdatedEntry> fUpdatedEntries;
+};
+
+}  // omtt::cache
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/cache/detail/Format.hpp"
+#include "headers/lexer/Token.hpp"
+
+#include <optional>
+#include <string>
+
+
+namespace omtt::cache
+{
+
+/*
+ * Lexer replaying tokens stored in the cache. Tokens values point
+ * to the test file buffer, so the parser gets the same views as with
+ * the real lexer.
+ */
+class TokenReplay
+{
+public:
+    TokenReplay(const std::string &inputBuffer,
+                const detail::TokenRecord *begin,
+                const detail::TokenRecord *end)
+        :
+        fInputBuffer(inputBuffer),
+        fCurrent(begin),
+        fEnd(end)
+    {
+    }
+
+    std::optional<const lexer::Token>
+    FindNextToken()
+    {
+        if (fCurrent == fEnd) {
+            return std::nullopt;
+        }
+
+        const detail::TokenRecord &record = *fCurrent;
+        ++fCurrent;
+
+        return lexer::Token{static_cast<lexer::TokenKind>(record.kind),
+                            std::string_view(fInputBuffer.data() + record.offset,
+                                             record.length)};
+    }
+
+private:
+    const std::string &fInputBuffer;
+    const detail::TokenRecord *fCurrent;
+    const detail::TokenRecord * const fEnd;
+};
+
+}  // omtt::cache
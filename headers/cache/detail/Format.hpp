@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace omtt::cache::detail
+{
+
+/*
+ * Cache file layout (native byte order, every part 8 bytes aligned):
+ *
+ *   Header
+ *   Entry[entriesCount]              sorted by pathHash
+ *   TokenRecord[tokensCount]
+ *   char[stringsSize]                test files paths
+ */
+
+constexpr char MAGIC[8] = {'O', 'M', 'T', 'T', 'C', '\0', '\0', '\0'};
+
+// bumped on every change of the layout and of the lexer, the tokens of the
+// older lexer aren't valid anymore
+constexpr std::uint32_t FORMAT_VERSION = 4;
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t entriesCount;
+    std::uint64_t tokensCount;
+    std::uint64_t stringsSize;
+};
+
+struct Entry
+{
+    std::uint64_t pathHash;
+    std::uint64_t pathOffset;
+    std::uint64_t pathLength;
+    std::uint64_t firstToken;
+    std::uint64_t tokensCount;
+    std::uint64_t fileSize;
+    std::int64_t modificationTimeSec;
+    std::int64_t modificationTimeNsec;
+    std::uint64_t testsCount;
+};
+
+struct TokenRecord
+{
+    std::uint64_t offset;
+    std::uint64_t length;
+    std::uint32_t kind;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(Header) == 32, "unexpected cache header size");
+static_assert(sizeof(Entry) == 72, "unexpected cache entry size");
+static_assert(sizeof(TokenRecord) == 24, "unexpected cache token record size");
+
+}  // omtt::cache::detail
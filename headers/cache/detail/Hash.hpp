@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+
+namespace omtt::cache::detail
+{
+
+constexpr std::uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr std::uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/*
+ * FNV-1a variant consuming eight bytes per step, so hashing big inputs
+ * costs about as much as a single memory read of the buffer.
+ */
+inline std::uint64_t
+hash(const std::string_view &text)
+{
+    std::uint64_t h = FNV_OFFSET_BASIS ^ text.size();
+    std::string_view::size_type i = 0;
+
+    for (; i + sizeof(std::uint64_t) <= text.size(); i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, text.data() + i, sizeof(word));
+        h = (h ^ word) * FNV_PRIME;
+        h ^= h >> 32;
+    }
+
+    for (; i < text.size(); ++i) {
+        h = (h ^ static_cast<unsigned char>(text[i])) * FNV_PRIME;
+    }
+
+    return h;
+}
+
+}  // omtt::cache::detail
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/Path.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace omtt::check
+{
+
+struct CheckError
+{
+    Path path;
+    std::optional<std::string::size_type> position;
+    std::string message;
+};
+
+struct CheckSummary
+{
+    TestPaths::size_type testsCount;
+    std::vector<CheckError> errors;
+};
+
+/*
+ * Reads and parses the test files without running the SUT. Files are
+ * shared between the threads, the errors are returned in the order of
+ * the given paths.
+ */
+CheckSummary
+CheckTestFiles(const TestPaths &testFiles, unsigned threadsCount);
+
+}  // omtt::check
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/exception/SutExecutionException.hpp"
+
+#include <string>
+
+
+namespace omtt::exception
+{
+
+class InputFileException : public SutExecutionException
+{
+public:
+    InputFileException(const std::string &path, const std::string &reason)
+        :
+        SutExecutionException("failed to open input file '" + path + "': " + reason),
+        fPath(path),
+        fReason(reason)
+    {
+    }
+
+    const std::string &
+    GetPath() const
+    {
+        return fPath;
+    }
+
+    const std::string &
+    GetReason() const
+    {
+        return fReason;
+    }
+
+private:
+    std::string fPath;
+    std::string fReason;
+};
+
+}
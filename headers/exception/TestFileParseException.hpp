@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/Path.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace omtt::exception
+{
+
+class TestFileParseException : public std::runtime_error
+{
+public:
+    TestFileParseException(const Path &testFilePath, const std::string &msg)
+        :
+        std::runtime_error(testFilePath + ": " + msg)
+    {
+    }
+};
+
+}
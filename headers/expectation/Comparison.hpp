@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace omtt::expectation
+{
+
+// how a counted property of the output is compared with the expected count
+enum class Comparison
+{
+    EXACTLY,
+    AT_LEAST,
+    AT_MOST
+};
+
+inline bool
+isWithinLimit(const std::uint64_t count, const Comparison comparison, const std::uint64_t expectedCount)
+{
+    switch (comparison) {
+        case Comparison::AT_LEAST:
+            return count >= expectedCount;
+        case Comparison::AT_MOST:
+            return count <= expectedCount;
+        default:
+            return count == expectedCount;
+    }
+}
+
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "headers/expectation/Expectation.hpp"
+#include "headers/expectation/Stream.hpp"
 #include "headers/expectation/validation/EmptyOutputCause.hpp"
 
 
@@ -18,18 +19,51 @@ namespace omtt::expectation
 class EmptyOutputExpectation : public Expectation
 {
 public:
-    explicit EmptyOutputExpectation() = default;
+    explicit EmptyOutputExpectation(const Stream stream = Stream::OUTPUT)
+        :
+        fStream(stream)
+    {
+    }
 
     validation::ValidationResult
     Validate(const ProcessResults &processResults)
     {
-        if (processResults.output.empty()) {
+        const std::string &output = streamText(processResults, fStream);
+
+        if (output.empty()) {
             return {std::nullopt};
         }
         else {
-            return {validation::EmptyOutputCause{processResults.output}};
+            return {validation::EmptyOutputCause{output, fStream}};
         }
     }
+
+    Stream
+    GetStream() const
+    {
+        return fStream;
+    }
+
+    bool
+    NeedsWholeOutput() const
+    {
+        return fStream == Stream::OUTPUT;
+    }
+
+    bool
+    NeedsErrorOutput() const
+    {
+        return fStream == Stream::ERROR_OUTPUT;
+    }
+
+    Cost
+    GetCost() const
+    {
+        return Cost::CHEAP;
+    }
+
+private:
+    const Stream fStream;
 };
 
 }
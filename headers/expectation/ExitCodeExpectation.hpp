@@ -35,6 +35,18 @@ public:
         }
     }
 
+    bool
+    NeedsWholeOutput() const
+    {
+        return false;
+    }
+
+    Cost
+    GetCost() const
+    {
+        return Cost::CHEAP;
+    }
+
     int
     GetContent() const
     {
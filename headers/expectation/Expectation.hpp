@@ -9,6 +9,7 @@
 #pragma once
 
 #include "headers/ProcessResults.hpp"
+#include "headers/expectation/PreparationContext.hpp"
 #include "headers/expectation/validation/ValidationResult.hpp"
 
 
@@ -18,9 +19,30 @@ namespace omtt::expectation
 class Expectation
 {
 public:
+    // how much work is left for the validation after the SUT has finished
+    enum class Cost
+    {
+        CHEAP,
+        EXPENSIVE
+    };
+
     virtual                               ~Expectation() = default;
 
+    // called before the SUT is executed
+    virtual void                          Prepare(const PreparationContext &) {}
+
     virtual validation::ValidationResult  Validate(const ProcessResults &processResults) = 0;
+
+    // checks only the verdict, without building the cause
+    virtual bool                          IsSatisfied(const ProcessResults &processResults) { return Validate(processResults).isSatisfied(); }
+
+    virtual Cost                          GetCost() const { return Cost::EXPENSIVE; }
+
+    // false when the expectation doesn't look at the output in the process results
+    virtual bool                          NeedsWholeOutput() const { return true; }
+
+    // true when the expectation looks at the error output in the process results
+    virtual bool                          NeedsErrorOutput() const { return false; }
 };
 
 }
@@ -28,6 +28,18 @@ public:
             return {validation::FailureExitCause{processResults.exitCode}};
         }
     }
+
+    bool
+    NeedsWholeOutput() const
+    {
+        return false;
+    }
+
+    Cost
+    GetCost() const
+    {
+        return Cost::CHEAP;
+    }
 };
 
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "headers/expectation/Expectation.hpp"
+#include "headers/expectation/Stream.hpp"
 
 #include <string_view>
 
@@ -19,13 +20,18 @@ namespace omtt::expectation
 class FullOutputExpectation : public Expectation
 {
 public:
-    explicit FullOutputExpectation(const std::string_view &expectedOutput)
+    explicit FullOutputExpectation(const std::string_view &expectedOutput,
+                                   const Stream stream = Stream::OUTPUT)
         :
-        fExpectedOutput(expectedOutput)
+        fExpectedOutput(expectedOutput),
+        fStream(stream),
+        fIsLineDiffShown(false)
     {
     }
 
+    void                         Prepare(const PreparationContext &context);
     validation::ValidationResult Validate(const ProcessResults &processResults);
+    bool                         IsSatisfied(const ProcessResults &processResults);
 
     const std::string_view &
     GetContent() const
@@ -33,8 +39,28 @@ public:
         return fExpectedOutput;
     }
 
+    Stream
+    GetStream() const
+    {
+        return fStream;
+    }
+
+    bool
+    NeedsWholeOutput() const
+    {
+        return fStream == Stream::OUTPUT;
+    }
+
+    bool
+    NeedsErrorOutput() const
+    {
+        return fStream == Stream::ERROR_OUTPUT;
+    }
+
 private:
     const std::string_view fExpectedOutput;
+    const Stream           fStream;
+    bool                   fIsLineDiffShown;
 };
 
 }
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/StreamingExpectation.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Each line of the expected text has to be found in the output after
+ * the text from the previous line. The output is searched once, only
+ * for the next text not found yet.
+ */
+class InOutputInOrderExpectation : public StreamingExpectation
+{
+public:
+    explicit                     InOutputInOrderExpectation(const std::string_view &expectedTexts);
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fExpectedTexts;
+    }
+
+    const std::vector<std::string_view> &
+    GetTexts() const
+    {
+        return fTexts;
+    }
+
+private:
+    void                         _NextText();
+
+private:
+    const std::string_view                   fExpectedTexts;
+    std::vector<std::string_view>            fTexts;
+
+    // Knuth-Morris-Pratt prefix function of each text
+    std::vector<std::vector<std::uint32_t>>  fPrefixes;
+
+    std::vector<std::string_view>::size_type fCurrentText;
+    std::uint32_t                            fMatched;
+    std::string::size_type                   fPosition;
+    std::string::size_type                   fSearchStart;
+};
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/StreamingExpectation.hpp"
+#include "headers/regex/Matcher.hpp"
+
+#include <optional>
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Some part of the output has to match the regular expression.
+ */
+class InOutputMatchesExpectation : public StreamingExpectation
+{
+public:
+    explicit                     InOutputMatchesExpectation(const std::string_view &pattern);
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fPattern;
+    }
+
+private:
+    const std::string_view        fPattern;
+    std::optional<regex::Matcher> fMatcher;
+};
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/StreamingExpectation.hpp"
+#include "headers/expectation/detail/OutputContext.hpp"
+#include "headers/LineEndings.hpp"
+#include "headers/normalize/Normalizer.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Compares the output with a memory mapped file chunk by chunk, only
+ * the context of the first difference is kept. With the normalization
+ * filters the file is filtered in chunks while it is compared, only
+ * the filtered chunk not compared yet is kept in memory.
+ */
+class OutputFileExpectation : public StreamingExpectation
+{
+public:
+    explicit                     OutputFileExpectation(const std::string_view &expectedOutputFile,
+                                                       const normalize::Filters &normalization = {});
+                                 ~OutputFileExpectation();
+
+                                 OutputFileExpectation(const OutputFileExpectation &) = delete;
+    OutputFileExpectation &      operator=(const OutputFileExpectation &) = delete;
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+    bool                         IsSatisfied(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fExpectedOutputFile;
+    }
+
+private:
+    void                         _Unmap();
+    bool                         _NormalizeNextChunk();
+    void                         _Remember(const std::string_view &matchedOutput);
+    void                         _MarkDifference();
+
+private:
+    const std::string_view       fExpectedOutputFile;
+    const normalize::Filters     fNormalization;
+    const char *                 fMapping;
+    size_t                       fMappingSize;
+    size_t                       fMappingPosition;
+    LfNormalizer                 fLfNormalizer;
+    std::optional<normalize::Normalizer> fNormalizer;
+    std::string                  fFilteredChunk;
+    std::string                  fNormalizedContent;
+    const char *                 fExpected;
+    size_t                       fExpectedSize;
+    size_t                       fExpectedPosition;
+    std::string::size_type       fOutputPosition;
+    std::string::size_type       fOutputLine;
+    std::string::size_type       fOutputLineBegin;
+    std::string                  fExpectedContext;
+    detail::OutputContext        fOutputContext;
+};
+
+}
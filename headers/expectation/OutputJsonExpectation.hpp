@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/StreamingExpectation.hpp"
+#include "headers/expectation/detail/JsonComparison.hpp"
+#include "headers/json/Parser.hpp"
+#include "headers/json/Value.hpp"
+
+#include <optional>
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * The output has to be a JSON document equal to the expected one. Objects
+ * members order, white spaces and numbers notation are not compared.
+ *
+ * Throws json::exception::SyntaxException when the expected text is not
+ * a valid JSON.
+ */
+class OutputJsonExpectation : public StreamingExpectation
+{
+public:
+    explicit                       OutputJsonExpectation(const std::string_view &expectedOutput);
+
+    void                           Prepare(const PreparationContext &context);
+    void                           Consume(const std::string_view &outputChunk);
+    validation::ValidationResult   Validate(const ProcessResults &processResults);
+    bool                           IsSatisfied(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fExpectedOutput;
+    }
+
+private:
+    void                           _Finish();
+
+private:
+    const std::string_view         fExpectedOutput;
+    const json::Value              fExpected;
+    std::optional<detail::JsonComparison> fComparison;
+    std::optional<json::Parser>    fParser;
+};
+
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/Comparison.hpp"
+#include "headers/expectation/StreamingExpectation.hpp"
+
+#include <cstdint>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Counts the lines of the output while it is read, the last line is
+ * counted also without the new line character at the end.
+ */
+class OutputLineCountExpectation : public StreamingExpectation
+{
+public:
+                                 OutputLineCountExpectation(const Comparison comparison,
+                                                            const std::uint64_t expectedLineCount);
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    bool                         NeedsMoreOutput() const;
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+
+    Comparison
+    GetComparison() const
+    {
+        return fComparison;
+    }
+
+    std::uint64_t
+    GetExpectedLineCount() const
+    {
+        return fExpectedLineCount;
+    }
+
+private:
+    std::uint64_t       _LineCount() const;
+
+private:
+    const Comparison    fComparison;
+    const std::uint64_t fExpectedLineCount;
+    std::uint64_t       fNewLines;
+    bool                fIsLastLineOpen;
+};
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/StreamingExpectation.hpp"
+#include "headers/expectation/detail/LineMultiset.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * The output has to contain the same lines as the expected output,
+ * in any order.
+ */
+class OutputLinesUnorderedExpectation : public StreamingExpectation
+{
+public:
+    explicit                     OutputLinesUnorderedExpectation(const std::string_view &expectedOutput);
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+    bool                         IsSatisfied(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fExpectedOutput;
+    }
+
+private:
+    void                                _RemovePartialLine();
+
+private:
+    const std::string_view              fExpectedOutput;
+    std::optional<detail::LineMultiset> fLines;
+    std::string                         fPartialLine;
+};
+
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/StreamingExpectation.hpp"
+#include "headers/expectation/detail/Sha256.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Compares the SHA-256 digest of the output, the digest is updated with
+ * each chunk of the output. Only a few bytes from the beginning and the
+ * end of the output are kept for the report.
+ *
+ * Throws exception::DigestSyntaxException when the expected digest is
+ * not 64 hex digits.
+ */
+class OutputSha256Expectation : public StreamingExpectation
+{
+public:
+    // bytes at the beginning and the end of the output kept for the report
+    static constexpr std::string::size_type SAMPLE_SIZE = 7;
+
+    explicit                     OutputSha256Expectation(const std::string_view &expectedDigest);
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+    bool                         IsSatisfied(const ProcessResults &processResults);
+
+    const detail::Sha256::Digest &
+    GetExpectedDigest() const
+    {
+        return fExpectedDigest;
+    }
+
+private:
+    const detail::Sha256::Digest fExpectedDigest;
+    detail::Sha256               fSha256;
+    std::uint64_t                fSize;
+    std::string                  fHead;
+    std::string                  fTail;
+};
+
+}
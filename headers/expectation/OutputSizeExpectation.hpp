@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/Comparison.hpp"
+#include "headers/expectation/StreamingExpectation.hpp"
+
+#include <cstdint>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Counts the bytes of the output while it is read, the output itself
+ * is not kept.
+ */
+class OutputSizeExpectation : public StreamingExpectation
+{
+public:
+                                 OutputSizeExpectation(const Comparison comparison,
+                                                       const std::uint64_t expectedSize);
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    bool                         NeedsMoreOutput() const;
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+
+    Comparison
+    GetComparison() const
+    {
+        return fComparison;
+    }
+
+    std::uint64_t
+    GetExpectedSize() const
+    {
+        return fExpectedSize;
+    }
+
+private:
+    const Comparison    fComparison;
+    const std::uint64_t fExpectedSize;
+    std::uint64_t       fSize;
+};
+
+}
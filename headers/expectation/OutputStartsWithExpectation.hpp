@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/StreamingExpectation.hpp"
+#include "headers/expectation/detail/OutputContext.hpp"
+
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Compares only the beginning of the output, the rest of it is not
+ * needed when the expected text is found or the difference context
+ * is collected.
+ */
+class OutputStartsWithExpectation : public StreamingExpectation
+{
+public:
+    explicit                     OutputStartsWithExpectation(const std::string_view &expectedBeginning);
+
+    void                         Prepare(const PreparationContext &context);
+    void                         Consume(const std::string_view &outputChunk);
+    bool                         NeedsMoreOutput() const;
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fExpectedBeginning;
+    }
+
+private:
+    const std::string_view      fExpectedBeginning;
+    std::string_view::size_type fMatched;
+    detail::OutputContext       fOutputContext;
+};
+
+}
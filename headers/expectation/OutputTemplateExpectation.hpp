@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/Expectation.hpp"
+#include "headers/expectation/detail/OutputTemplate.hpp"
+
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+class OutputTemplateExpectation : public Expectation
+{
+public:
+    // the template is compiled here, so unknown placeholders are reported by the parser
+    explicit OutputTemplateExpectation(const std::string_view &outputTemplate)
+        :
+        fSource(outputTemplate),
+        fTemplate(outputTemplate)
+    {
+    }
+
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+    bool                         IsSatisfied(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fSource;
+    }
+
+private:
+    const std::string_view fSource;
+    const detail::OutputTemplate fTemplate;
+};
+
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/Expectation.hpp"
+#include "headers/expectation/detail/TolerantComparison.hpp"
+
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * The output has to be the same as the expected output, but the numbers
+ * may differ by the absolute or the relative tolerance.
+ *
+ * Throws exception::ToleranceSyntaxException when a tolerance is not
+ * a non-negative number.
+ */
+class OutputWithToleranceExpectation : public Expectation
+{
+public:
+    OutputWithToleranceExpectation(const std::string_view &expectedOutput,
+                                   const std::string_view &absoluteTolerance,
+                                   const std::string_view &relativeTolerance);
+
+    validation::ValidationResult Validate(const ProcessResults &processResults);
+    bool                         IsSatisfied(const ProcessResults &processResults);
+
+    const std::string_view &
+    GetContent() const
+    {
+        return fExpectedOutput;
+    }
+
+    const detail::Tolerance &
+    GetTolerance() const
+    {
+        return fTolerance;
+    }
+
+private:
+    const std::string_view  fExpectedOutput;
+    const detail::Tolerance fTolerance;
+};
+
+}
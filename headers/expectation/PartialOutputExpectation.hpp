@@ -9,6 +9,7 @@
 #pragma once
 
 #include "headers/expectation/Expectation.hpp"
+#include "headers/expectation/Stream.hpp"
 
 #include <string_view>
 
@@ -19,22 +20,70 @@ namespace omtt::expectation
 class PartialOutputExpectation : public Expectation
 {
 public:
-    explicit PartialOutputExpectation(const std::string_view &expectedPartialOutput)
+    explicit PartialOutputExpectation(const std::string_view &expectedPartialOutput,
+                                      const Stream stream = Stream::OUTPUT)
         :
-        fExpectedPartialOutput(expectedPartialOutput)
+        fExpectedPartialOutput(expectedPartialOutput),
+        fStream(stream),
+        fIsSearchedExternally(false),
+        fIsFound(false)
     {
     }
 
     validation::ValidationResult Validate(const ProcessResults &processResults);
 
+    /*
+     * Validate will use the result given with MarkFound instead of searching
+     * the output, used when many texts are searched in one pass.
+     */
+    void
+    UseExternalSearch()
+    {
+        fIsSearchedExternally = true;
+        fIsFound = false;
+    }
+
+    void
+    MarkFound()
+    {
+        fIsFound = true;
+    }
+
+    bool
+    NeedsWholeOutput() const
+    {
+        return fStream == Stream::OUTPUT && !fIsSearchedExternally;
+    }
+
+    bool
+    NeedsErrorOutput() const
+    {
+        return fStream == Stream::ERROR_OUTPUT;
+    }
+
+    Cost
+    GetCost() const
+    {
+        return fIsSearchedExternally ? Cost::CHEAP : Cost::EXPENSIVE;
+    }
+
     const std::string_view &
     GetContent() const
     {
         return fExpectedPartialOutput;
     }
 
+    Stream
+    GetStream() const
+    {
+        return fStream;
+    }
+
 private:
     const std::string_view fExpectedPartialOutput;
+    const Stream           fStream;
+    bool                   fIsSearchedExternally;
+    bool                   fIsFound;
 };
 
 }
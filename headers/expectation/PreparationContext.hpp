@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/Path.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Data shared by the tests, given to the expectations before the SUT
+ * is executed.
+ */
+struct PreparationContext
+{
+    const Path &testFilePath;
+    regex::PatternCache &patternCache;
+
+    // the full output causes contain line differences
+    bool isLineDiffShown = false;
+};
+
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/ProcessResults.hpp"
+
+#include <string>
+
+
+namespace omtt::expectation
+{
+
+// SUT stream checked by an expectation
+enum class Stream
+{
+    OUTPUT,
+    ERROR_OUTPUT
+};
+
+inline const std::string &
+streamText(const ProcessResults &processResults, const Stream stream)
+{
+    if (stream == Stream::OUTPUT) {
+        return processResults.output;
+    }
+
+    return processResults.normalizedErrors.has_value() ? *processResults.normalizedErrors : processResults.errors;
+}
+
+}
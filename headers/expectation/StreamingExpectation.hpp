@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/Expectation.hpp"
+#include "headers/expectation/PreparationContext.hpp"
+
+#include <string_view>
+
+
+namespace omtt::expectation
+{
+
+/*
+ * Expectation checked while the SUT output is read, it doesn't need
+ * the whole output in the process results.
+ */
+class StreamingExpectation : public Expectation
+{
+public:
+    virtual void Prepare(const PreparationContext &context) = 0;
+    virtual void Consume(const std::string_view &outputChunk) = 0;
+
+    // false when the rest of the output can't change the result
+    virtual bool NeedsMoreOutput() const { return true; }
+
+    bool
+    NeedsWholeOutput() const
+    {
+        return false;
+    }
+
+    // the output was already examined while it was read
+    Cost
+    GetCost() const
+    {
+        return Cost::CHEAP;
+    }
+};
+
+}
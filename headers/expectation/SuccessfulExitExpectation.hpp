@@ -28,6 +28,18 @@ public:
             return {validation::SuccessfulExitCause{processResults.exitCode}};
         }
     }
+
+    bool
+    NeedsWholeOutput() const
+    {
+        return false;
+    }
+
+    Cost
+    GetCost() const
+    {
+        return Cost::CHEAP;
+    }
 };
 
 }
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+
+namespace omtt::expectation::detail
+{
+
+struct Difference
+{
+    std::string_view::size_type  position;
+
+    // counted from one, the column is counted in bytes
+    std::string_view::size_type  line;
+    std::string_view::size_type  column;
+};
+
+/*
+ * Compares the texts in one pass, eight bytes at a time, and counts the
+ * new lines before the difference. The end of the shorter text is the
+ * difference when it is the beginning of the longer one. Returns nothing
+ * when the texts are the same.
+ */
+std::optional<Difference>  find_first_difference(const std::string_view &expected,
+                                                 const std::string_view &output);
+
+// counts the new lines eight bytes at a time, like the comparison
+std::string_view::size_type  count_new_lines(const std::string_view &text);
+
+}  // omtt::expectation::detail
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/json/Handler.hpp"
+#include "headers/json/Value.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::expectation::detail
+{
+
+/*
+ * Compares the parsed JSON events with the expected value, the members order
+ * and the numbers notation don't matter. Only the first difference is kept.
+ */
+class JsonComparison : public json::Handler
+{
+public:
+    struct Difference
+    {
+        std::string  pointer;
+        std::string  expected;
+        std::string  actual;
+    };
+
+    explicit                          JsonComparison(const json::Value &expected);
+
+    void                              OnNull() override;
+    void                              OnBoolean(bool value) override;
+    void                              OnNumber(const std::string_view &number) override;
+    void                              OnString(const std::string_view &value) override;
+    void                              OnKey(const std::string_view &key) override;
+    void                              OnObjectBegin() override;
+    void                              OnObjectEnd() override;
+    void                              OnArrayBegin() override;
+    void                              OnArrayEnd() override;
+
+    // reports the output that isn't a valid JSON at the current position
+    void                              SetInvalidOutput(const std::string &error);
+
+    bool                              HasDifference() const;
+    const std::optional<Difference> & GetDifference() const;
+
+private:
+    struct Frame
+    {
+        const json::Value *  expected;
+
+        // items begun in the array, or the current member in the object
+        std::size_t          index;
+        std::string          key;
+        std::vector<bool>    seenMembers;
+    };
+
+    const json::Value *               _BeginValue(std::string_view actual);
+    void                              _BeginContainer(json::Value::Kind kind, std::string_view actual);
+    void                              _SetDifference(std::string expected, std::string actual);
+    std::string                       _Pointer() const;
+
+private:
+    const json::Value &               fExpected;
+    std::vector<Frame>                fFrames;
+    std::size_t                       fDepth;
+    std::optional<Difference>         fDifference;
+};
+
+}  // omtt::expectation::detail
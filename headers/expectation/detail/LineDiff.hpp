@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::expectation::detail
+{
+
+struct DiffLine
+{
+    enum class Kind
+    {
+        COMMON,
+        DELETED,
+        INSERTED
+    };
+
+    Kind              kind;
+
+    // the line with its new line character, when it has one
+    std::string_view  text;
+};
+
+struct DiffHunk
+{
+    // zero based numbers of the first lines
+    std::size_t            expectedBegin;
+    std::size_t            expectedCount;
+    std::size_t            outputBegin;
+    std::size_t            outputCount;
+
+    std::vector<DiffLine>  lines;
+};
+
+/*
+ * Finds the shortest line edit script with the linear space variant of
+ * the Myers O(ND) algorithm and groups the changes with the context lines
+ * around them. Returns nothing when more than maxEditDistance lines have
+ * to be deleted or inserted, the time and memory are bound by this limit.
+ */
+std::optional<std::vector<DiffHunk>>  diff_lines(const std::string_view &expected,
+                                                 const std::string_view &output,
+                                                 std::size_t maxEditDistance,
+                                                 std::size_t contextLines = 3);
+
+}  // omtt::expectation::detail
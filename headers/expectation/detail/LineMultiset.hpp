@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::expectation::detail
+{
+
+/*
+ * Counts lines in an open addressing hash table. Expected lines are added,
+ * output lines are removed; at the end a positive count means a missing
+ * line and a negative one an extra line. Memory depends only on the number
+ * of distinct lines.
+ */
+class LineMultiset
+{
+public:
+    struct Entry
+    {
+        std::string_view  line;
+        std::int64_t      count;
+        std::size_t       hash;
+    };
+
+                                 LineMultiset();
+
+    // the line has to outlive the multiset
+    void                         Add(const std::string_view &line);
+
+    // the line is copied when it wasn't added before
+    void                         Remove(const std::string_view &line);
+
+    // in order of the first appearance
+    const std::vector<Entry> &   GetEntries() const;
+
+private:
+    std::uint32_t                _FindOrInsert(const std::string_view &line, bool copyLine);
+    void                         _Grow();
+
+private:
+    std::vector<Entry>           fEntries;
+    std::vector<std::uint32_t>   fSlots;
+    std::deque<std::string>      fCopiedLines;
+};
+
+}  // omtt::expectation::detail
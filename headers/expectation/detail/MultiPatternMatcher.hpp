@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::expectation::detail
+{
+
+/*
+ * Aho-Corasick automaton finding many patterns in one pass over the text.
+ * The text may be given in chunks, a pattern split between chunks is found.
+ */
+class MultiPatternMatcher
+{
+public:
+    explicit  MultiPatternMatcher(const std::vector<std::string_view> &patterns);
+
+    // returns true when a pattern not found before was found in the chunk
+    bool      Feed(const std::string_view &chunk);
+
+    bool      IsFound(std::size_t patternIndex) const;
+    bool      AreAllFound() const;
+
+private:
+    std::uint32_t  _Insert(const std::string_view &pattern);
+    void           _Build();
+    void           _Report(std::uint32_t state);
+
+private:
+    std::array<std::uint16_t, 256>  fByteClass;
+    std::size_t                     fClassCount;
+    std::vector<std::uint32_t>      fTransitions;
+    std::vector<std::uint32_t>      fOutputLink;
+    std::vector<bool>               fIsTerminal;
+    std::vector<bool>               fIsFound;
+    std::vector<bool>               fHasPendingOutput;
+    std::vector<std::uint32_t>      fPatternStates;
+    std::size_t                     fRemaining;
+    std::uint32_t                   fState;
+};
+
+}  // omtt::expectation::detail
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::detail
+{
+
+/*
+ * Collects the bytes around the first difference in the streamed output,
+ * without keeping the whole output.
+ */
+class OutputContext
+{
+public:
+    // the same amount of bytes around the difference is shown by the logger
+    static constexpr std::string::size_type SIZE = 6;
+
+                            OutputContext();
+
+    void                    Reset();
+
+    // remembers the output before the difference
+    void                    Remember(const std::string_view &output);
+
+    // the difference is at the current position
+    void                    Start();
+    void                    Collect(const std::string_view &output);
+
+    bool                    IsStarted() const;
+
+    // all bytes after the difference shown by the logger are collected
+    bool                    IsCollected() const;
+    const std::string &     GetTail() const;
+    const std::string &     GetContext() const;
+    std::string::size_type  GetPosition() const;
+
+private:
+    std::string             fTail;
+    std::string             fContext;
+    bool                    fIsStarted;
+};
+
+}  // omtt::expectation::detail
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::expectation::detail
+{
+
+/*
+ * Output template with {{*}}, {{int}} and {{hex}} placeholders, compiled
+ * to blocks of literal texts and placeholders separated by {{*}}.
+ *
+ * The first block is matched at the beginning of the output, every next
+ * one at its first position where it matches, the last one at the end of
+ * the output. {{int}} and {{hex}} take the whole run of digits, so a block
+ * matched once is never matched again and the output is scanned forward.
+ */
+class OutputTemplate
+{
+public:
+    struct Mismatch
+    {
+        std::string_view::size_type outputPosition;
+        std::string_view::size_type templatePosition;
+    };
+
+    // throws exception::TemplateSyntaxException on unknown placeholders
+    explicit                 OutputTemplate(const std::string_view &source);
+
+    // returns the furthest difference found when the output doesn't match
+    std::optional<Mismatch>  Match(const std::string_view &output) const;
+
+private:
+    struct Element
+    {
+        enum class Kind { TEXT, INTEGER, HEX };
+
+        Kind                         kind;
+        std::string_view             text;
+        std::string_view::size_type  templatePosition;
+    };
+
+    typedef std::vector<Element> Block;
+
+    friend class OutputTemplateMatching;
+
+    void  _AddText(const std::string_view &source,
+                   std::string_view::size_type begin,
+                   std::string_view::size_type end);
+    void  _AddElement(Element &&element);
+
+private:
+    std::string_view::size_type  fSize;
+    std::vector<Block>           fBlocks;
+};
+
+}  // omtt::expectation::detail
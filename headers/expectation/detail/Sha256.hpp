@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::detail
+{
+
+/*
+ * SHA-256 (FIPS 180-4) of a text given in chunks. Whole blocks of a chunk
+ * are hashed in place, only the bytes of an unfinished block are copied.
+ */
+class Sha256
+{
+public:
+    typedef std::array<std::uint8_t, 32> Digest;
+
+                  Sha256();
+
+    void          Reset();
+    void          Update(const std::string_view &chunk);
+
+    // digest of the text given so far, more text may be given later
+    Digest        GetDigest() const;
+
+private:
+    void          _Compress(const unsigned char *block);
+
+private:
+    static constexpr std::size_t BLOCK_SIZE = 64;
+
+    std::array<std::uint32_t, 8>              fState;
+    std::array<unsigned char, BLOCK_SIZE>     fBuffer;
+    std::size_t                               fBuffered;
+    std::uint64_t                             fLength;
+};
+
+// lower case hex digits
+std::string                     to_hex(const Sha256::Digest &digest);
+
+// accepts upper and lower case hex digits, nothing when it isn't a digest
+std::optional<Sha256::Digest>   parse_digest(const std::string_view &text);
+
+}  // omtt::expectation::detail
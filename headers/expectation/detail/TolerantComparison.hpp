@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+
+namespace omtt::expectation::detail
+{
+
+struct Tolerance
+{
+    double  absolute;
+    double  relative;
+};
+
+struct ToleranceMismatch
+{
+    std::string_view::size_type  expectedPosition;
+    std::string_view::size_type  outputPosition;
+
+    // sizes of the compared numbers, zero when the texts are different
+    std::string_view::size_type  expectedNumberSize;
+    std::string_view::size_type  outputNumberSize;
+};
+
+// size of the decimal number at the beginning of the text, zero when there is no number
+std::string_view::size_type       number_size(const std::string_view &text);
+
+// the whole text has to be a decimal number
+std::optional<double>             parse_number(const std::string_view &text);
+
+bool                              is_within_tolerance(double expected, double actual, const Tolerance &tolerance);
+
+/*
+ * Compares the texts in one pass, numbers found at the same places are
+ * compared with the tolerance, the rest byte by byte.
+ */
+std::optional<ToleranceMismatch>  compare_with_tolerance(const std::string_view &expected,
+                                                         const std::string_view &output,
+                                                         const Tolerance &tolerance);
+
+}  // omtt::expectation::detail
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::exception
+{
+
+class DigestSyntaxException : public std::runtime_error {
+public:
+    explicit DigestSyntaxException(const std::string_view &digest)
+        :
+        std::runtime_error("invalid output digest '" + std::string(digest)
+                           + "', expected 64 hex digits of SHA-256")
+    {
+    }
+};
+
+}  // omtt::expectation::exception
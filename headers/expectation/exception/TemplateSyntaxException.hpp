@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::exception
+{
+
+class TemplateSyntaxException : public std::runtime_error {
+public:
+    TemplateSyntaxException(const std::string_view &placeholder,
+                            const std::string_view::size_type position)
+        :
+        std::runtime_error("unknown output template placeholder '" + std::string(placeholder)
+                           + "' at position " + std::to_string(position))
+    {
+    }
+};
+
+}  // omtt::expectation::exception
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "headers/expectation/Stream.hpp"
+
 #include <string_view>
 
 
@@ -17,6 +19,7 @@ namespace omtt::expectation::validation
 struct EmptyOutputCause
 {
     const std::string_view fOutput;
+    const Stream fStream = Stream::OUTPUT;
 };
 
 }
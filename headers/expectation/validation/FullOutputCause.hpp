@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "headers/expectation/Stream.hpp"
+
 #include <string_view>
 
 
@@ -17,8 +19,14 @@ namespace omtt::expectation::validation
 struct FullOutputCause
 {
     const std::string::size_type fDifferencePosition;
+
+    // counted from one
+    const std::string::size_type fDifferenceLine;
+    const std::string::size_type fDifferenceColumn;
+
     const std::string_view fExpectedOutput;
     const std::string_view fOutput;
+    const Stream fStream = Stream::OUTPUT;
 };
 
 }
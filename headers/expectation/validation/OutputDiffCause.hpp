@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/Stream.hpp"
+#include "headers/expectation/detail/LineDiff.hpp"
+
+#include <vector>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputDiffCause
+{
+    const std::vector<detail::DiffHunk> fHunks;
+    const Stream fStream = Stream::OUTPUT;
+};
+
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputFileCause
+{
+    const std::string_view fExpectedOutputFile;
+    const std::string::size_type fDifferencePosition;
+
+    // counted from one
+    const std::string::size_type fDifferenceLine;
+    const std::string::size_type fDifferenceColumn;
+
+    const std::string::size_type fContextPosition;
+    const std::string_view fExpectedContext;
+    const std::string_view fOutputContext;
+};
+
+}
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputJsonCause
+{
+    // JSON Pointer (RFC 6901) to the first different value
+    const std::string fPointer;
+    const std::string fExpected;
+    const std::string fActual;
+};
+
+}
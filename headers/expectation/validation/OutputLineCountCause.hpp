@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/Comparison.hpp"
+
+#include <cstdint>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputLineCountCause
+{
+    const Comparison fComparison;
+    const std::uint64_t fExpectedLineCount;
+    const std::uint64_t fLineCount;
+};
+
+}
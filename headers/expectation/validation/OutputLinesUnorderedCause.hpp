@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputLinesUnorderedCause
+{
+    struct Line
+    {
+        std::string_view fLine;
+        std::uint64_t fCount;
+    };
+
+    // only the first lines are listed, the counts include all of them
+    const std::vector<Line> fMissingLines;
+    const std::uint64_t fMissingLinesCount;
+    const std::vector<Line> fExtraLines;
+    const std::uint64_t fExtraLinesCount;
+};
+
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputSha256Cause
+{
+    const std::string fExpectedDigest;
+    const std::string fDigest;
+    const std::uint64_t fSize;
+
+    // a few bytes from the beginning and the end of the output
+    const std::string_view fHead;
+    const std::string_view fTail;
+};
+
+}
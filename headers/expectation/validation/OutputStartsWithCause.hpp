@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputStartsWithCause
+{
+    const std::string_view fExpectedBeginning;
+    const std::string::size_type fDifferencePosition;
+    const std::string::size_type fContextPosition;
+    const std::string_view fOutputContext;
+};
+
+}
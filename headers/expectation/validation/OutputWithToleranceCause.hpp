@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+
+namespace omtt::expectation::validation
+{
+
+struct OutputWithToleranceCause
+{
+    const std::string::size_type fExpectedPosition;
+    const std::string::size_type fDifferencePosition;
+
+    // empty when the difference is not in a number
+    const std::string_view fExpectedNumber;
+    const std::string_view fNumber;
+
+    const std::string_view fExpectedOutput;
+    const std::string_view fOutput;
+};
+
+}
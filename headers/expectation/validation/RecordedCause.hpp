@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string_view>
+
+
+namespace omtt::expectation::validation
+{
+
+// the cause message rendered earlier, read back from a results log
+struct RecordedCause
+{
+    const std::string_view fMessage;
+};
+
+}
@@ -14,6 +14,21 @@
 #include "headers/expectation/validation/PartialOutputCause.hpp"
 #include "headers/expectation/validation/SuccessfulExitCause.hpp"
 #include "headers/expectation/validation/FailureExitCause.hpp"
+#include "headers/expectation/validation/OutputFileCause.hpp"
+#include "headers/expectation/validation/OutputMatchesCause.hpp"
+#include "headers/expectation/validation/InOutputMatchesCause.hpp"
+#include "headers/expectation/validation/InOutputInOrderCause.hpp"
+#include "headers/expectation/validation/OutputLinesUnorderedCause.hpp"
+#include "headers/expectation/validation/OutputJsonCause.hpp"
+#include "headers/expectation/validation/OutputWithToleranceCause.hpp"
+#include "headers/expectation/validation/OutputDiffCause.hpp"
+#include "headers/expectation/validation/OutputTemplateCause.hpp"
+#include "headers/expectation/validation/OutputSizeCause.hpp"
+#include "headers/expectation/validation/OutputLineCountCause.hpp"
+#include "headers/expectation/validation/OutputStartsWithCause.hpp"
+#include "headers/expectation/validation/OutputSha256Cause.hpp"
+#include "headers/expectation/validation/InputFileCause.hpp"
+#include "headers/expectation/validation/RecordedCause.hpp"
 
 #include <string>
 #include <optional>
@@ -31,7 +46,22 @@ struct ValidationResult
         validation::FullOutputCause,
         validation::PartialOutputCause,
         validation::SuccessfulExitCause,
-        validation::FailureExitCause
+        validation::FailureExitCause,
+        validation::OutputFileCause,
+        validation::OutputMatchesCause,
+        validation::InOutputMatchesCause,
+        validation::OutputTemplateCause,
+        validation::InOutputInOrderCause,
+        validation::OutputLinesUnorderedCause,
+        validation::OutputJsonCause,
+        validation::OutputWithToleranceCause,
+        validation::OutputDiffCause,
+        validation::OutputSizeCause,
+        validation::OutputLineCountCause,
+        validation::OutputStartsWithCause,
+        validation::OutputSha256Cause,
+        validation::InputFileCause,
+        validation::RecordedCause
         > Cause;
 
     const std::optional<Cause> cause;
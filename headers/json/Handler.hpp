@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string_view>
+
+
+namespace omtt::json
+{
+
+/*
+ * Receives the events of the parsed JSON text. Strings and keys are
+ * given already unescaped, numbers as they are written.
+ */
+class Handler
+{
+public:
+    virtual       ~Handler() = default;
+
+    virtual void  OnNull() = 0;
+    virtual void  OnBoolean(bool value) = 0;
+    virtual void  OnNumber(const std::string_view &number) = 0;
+    virtual void  OnString(const std::string_view &value) = 0;
+    virtual void  OnKey(const std::string_view &key) = 0;
+    virtual void  OnObjectBegin() = 0;
+    virtual void  OnObjectEnd() = 0;
+    virtual void  OnArrayBegin() = 0;
+    virtual void  OnArrayEnd() = 0;
+};
+
+}  // omtt::json
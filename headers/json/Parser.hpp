@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/json/Handler.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::json
+{
+
+/*
+ * Streaming JSON parser, the text may be given in chunks split at any
+ * byte. Only the token being read is buffered, so the memory depends on
+ * the nesting depth and the longest string, not on the text size.
+ */
+class Parser
+{
+public:
+    explicit            Parser(Handler &handler);
+
+    // both return false after a syntax error
+    bool                Feed(const std::string_view &chunk);
+    bool                Finish();
+
+    bool                HasError() const;
+    const std::string & GetError() const;
+
+private:
+    enum class State
+    {
+        VALUE,
+        VALUE_OR_ARRAY_END,
+        KEY,
+        KEY_OR_OBJECT_END,
+        COLON,
+        COMMA_OR_END,
+        END,
+        STRING,
+        NUMBER,
+        LITERAL,
+        ERROR
+    };
+
+    enum class NumberState
+    {
+        START,
+        ZERO,
+        INTEGER,
+        DOT,
+        FRACTION,
+        EXPONENT,
+        EXPONENT_SIGN,
+        EXPONENT_DIGITS
+    };
+
+    enum class EscapeState
+    {
+        NONE,
+        BACKSLASH,
+        UNICODE
+    };
+
+    std::string_view::size_type  _ReadStructural(const std::string_view &chunk, std::string_view::size_type i);
+    void                         _BeginValue(char character);
+    void                         _EndContainer(char character);
+    void                         _AfterValue();
+
+    std::string_view::size_type  _ReadString(const std::string_view &chunk, std::string_view::size_type i);
+    void                         _ReadEscape(char character);
+    void                         _AppendCodeUnit(std::uint32_t codeUnit);
+    void                         _AppendCodePoint(std::uint32_t codePoint);
+    void                         _FlushHighSurrogate();
+
+    std::string_view::size_type  _ReadNumber(const std::string_view &chunk, std::string_view::size_type i);
+    bool                         _IsNumberComplete() const;
+    void                         _EmitNumber();
+
+    std::string_view::size_type  _ReadLiteral(const std::string_view &chunk, std::string_view::size_type i);
+
+    void                         _SetError(const std::string &message, std::string_view::size_type i);
+
+private:
+    Handler &                    fHandler;
+    State                        fState;
+    std::vector<char>            fContainers;
+    std::uint64_t                fOffset;
+
+    std::string                  fToken;
+    bool                         fIsKey;
+    NumberState                  fNumberState;
+    EscapeState                  fEscapeState;
+    std::uint32_t                fCodeUnit;
+    int                          fCodeUnitDigits;
+    std::uint32_t                fHighSurrogate;
+    std::string_view             fLiteral;
+    std::string_view::size_type  fLiteralSize;
+
+    std::string                  fError;
+};
+
+}  // omtt::json
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace omtt::json
+{
+
+struct Value
+{
+    enum class Kind
+    {
+        NULL_VALUE,
+        BOOLEAN,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT
+    };
+
+    static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+    Kind                                       kind;
+    bool                                       boolean;
+
+    // unescaped string or the number as it is written
+    std::string                                text;
+
+    // the same for all notations of the number, see canonical_number
+    std::string                                canonicalNumber;
+
+    // array items, or object members in the written order
+    std::vector<Value>                         items;
+    std::vector<std::string>                   keys;
+
+    // indexes of the object members sorted by their keys
+    std::vector<std::uint32_t>                 sortedMembers;
+
+    std::size_t                                FindMember(const std::string_view &key) const;
+};
+
+// throws exception::SyntaxException when the text is not a valid JSON
+Value        parse(const std::string_view &text);
+
+/*
+ * Writes the number as its significant digits and the decimal exponent,
+ * so 1, 1.0, 10e-1 and 0.1E1 are the same.
+ */
+std::string  canonical_number(const std::string_view &number);
+
+// short text describing the value, used in the differences reports
+std::string  describe(const Value &value);
+std::string  describe_string(const std::string_view &value);
+
+}  // omtt::json
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+
+namespace omtt::json::exception
+{
+
+class SyntaxException : public std::runtime_error {
+public:
+    explicit SyntaxException(const std::string &message)
+        :
+        std::runtime_error("invalid JSON: " + message)
+    {
+    }
+};
+
+}  // omtt::json::exception
@@ -38,6 +38,9 @@ private:
              std::optional<const Token>   _HandleReadingKeywordsState(Lexer::ReadingKeywordsStateOptions = Lexer::ReadingKeywordsStateOptions::NONE);
              std::optional<const Token>   _HandleReadingLinesUpToExpectState();
              std::optional<const Token>   _HandleReadingLinesUpToEofState();
+             std::optional<const Token>   _HandleReadingClauseState();
+             std::optional<const Token>   _HandleReadingClauseArgumentsState();
+             std::optional<const Token>   _HandleReadingRestOfLineState();
              std::optional<const Token>   _HandleReadingInteger();
 
     inline   void                         _SwitchStateTo(const detail::State newState);
@@ -45,7 +48,10 @@ private:
     const    std::string_view             _ReadNextWord();
              PositionInBuffer             _FindNextLetterPosition(const PositionInBuffer begin) const;
              PositionInBuffer             _FindNextWhiteCharPosition(const PositionInBuffer begin) const;
+             PositionInBuffer             _FindEndOfLines(const PositionInBuffer begin) const;
     inline   void                         _ConsumeWhiteCharactersWithoutNewLine();
+             bool                         _IsAtEndOfLine() const;
+             void                         _SwitchToReadingLinesOrClause();
     inline   void                         _ConsumeNewLineCharacter();
              std::optional<const Token>   _ConsumeAndGetTokenWithText(const Lexer::PositionInBuffer begin, const Lexer::PositionInBuffer end);
 
@@ -16,6 +16,9 @@ enum class State {
     READ_KEYWORDS_AND_MOVE_TO_READING_LINES,
     READ_KEYWORDS,
     READ_LINES_UP_TO_EXPECT,
+    READ_CLAUSE,
+    READ_CLAUSE_ARGUMENTS,
+    READ_REST_OF_LINE,
     READ_INTEGER,
     READ_COMMENT
 };
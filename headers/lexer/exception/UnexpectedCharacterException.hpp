@@ -9,17 +9,30 @@
 #pragma once
 
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
 
 namespace omtt::lexer::exception {
 
 class UnexpectedCharacterException : public std::runtime_error {
 public:
-    explicit UnexpectedCharacterException(const std::string &msg)
+    UnexpectedCharacterException(const std::string &msg,
+                                 const std::string_view::size_type position)
         :
-        std::runtime_error(msg)
+        std::runtime_error(msg),
+        fPosition(position)
     {
     }
+
+    std::string_view::size_type
+    GetPosition() const
+    {
+        return fPosition;
+    }
+
+private:
+    std::string_view::size_type fPosition;
 };
 
 }  // omtt::lexer::exception
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/logger/Logger.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace omtt::logger
+{
+
+/*
+ * Decorates a logger, so a slow terminal or pipe doesn't stop the tests.
+ *
+ * The decorated logger renders every event into a memory buffer on the
+ * calling thread, the text is passed through a bounded single producer,
+ * single consumer ring to the writer thread, which writes everything
+ * waiting in the ring with one writev call. The events are written in
+ * the order they were logged.
+ */
+class AsyncLogger : public Logger
+{
+public:
+    using LoggerFactory = std::function<std::unique_ptr<Logger>(std::ostream &stream)>;
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 64;
+
+         AsyncLogger(const LoggerFactory &createLogger,
+                     const int fd,
+                     const std::size_t capacity = DEFAULT_CAPACITY);
+         // writes the remaining events, the write errors are ignored
+         ~AsyncLogger();
+
+    void SutPath(const std::string &path) override;
+
+    void BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                            const omtt::TestPaths::size_type numberOfTests,
+                            const omtt::Path &testPath) override;
+    void EndTestExecution(const omtt::ProcessResults &processResults,
+                          const omtt::TestExecutionSummary &summary) override;
+
+    void OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                           const omtt::TestPaths::size_type numberOfTestsPassed,
+                           const omtt::TestPaths::size_type numberOfTestsFailed) override;
+
+    // waits until every event is written, rethrows the write error
+    void Flush() override;
+
+private:
+    class EventBuffer : public std::streambuf
+    {
+    public:
+        std::string &
+        Text()
+        {
+            return fText;
+        }
+
+    protected:
+        int_type        overflow(int_type c) override;
+        std::streamsize xsputn(const char *s, std::streamsize count) override;
+
+    private:
+        std::string fText;
+    };
+
+    void        _Publish();
+    void        _WaitForFreeSlot();
+    void        _WakeUpWriter();
+    void        _Write();
+    void        _WriteBatch(const std::size_t head, const std::size_t tail);
+    void        _Stop();
+
+private:
+    EventBuffer              fEventBuffer;
+    std::ostream             fEventStream;
+    std::unique_ptr<Logger>  fLogger;
+
+    const int                fFd;
+    std::vector<std::string> fSlots;
+
+    // the producer moves the tail, the writer moves the head
+    std::atomic<std::size_t> fHead;
+    std::atomic<std::size_t> fTail;
+
+    // used only to sleep when the ring is empty or full
+    std::mutex               fMutex;
+    std::condition_variable  fWriterWakeUp;
+    std::condition_variable  fProducerWakeUp;
+    std::atomic<bool>        fIsWriterWaiting;
+    std::atomic<bool>        fIsProducerWaiting;
+    std::atomic<bool>        fIsStopped;
+
+    std::exception_ptr       fWriteError;
+    std::thread              fWriter;
+};
+
+}
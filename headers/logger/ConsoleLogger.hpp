@@ -10,6 +10,7 @@
 
 #include "headers/logger/Logger.hpp"
 #include <iostream>
+#include <string>
 
 
 namespace omtt::logger
@@ -18,7 +19,8 @@ namespace omtt::logger
 class ConsoleLogger : public Logger
 {
 public:
-         ConsoleLogger(std::ostream &stream = std::cout) : stream(stream) {};
+         ConsoleLogger(std::ostream &stream = std::cout, const bool isResourceUsageShown = false)
+             : stream(stream), isResourceUsageShown(isResourceUsageShown) {};
          ~ConsoleLogger() = default;
 
     void SutPath(const std::string &) override;
@@ -33,8 +35,12 @@ public:
                            const omtt::TestPaths::size_type numberOfTestsPassed,
                            const omtt::TestPaths::size_type numberOfTestsFailed) override;
 
+    void Flush() override;
+
 private:
      std::ostream &stream;
+     const bool isResourceUsageShown;
+     std::string buffer;
 };
 
 }
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/logger/Logger.hpp"
+
+#include <ostream>
+#include <string>
+
+
+namespace omtt::logger
+{
+
+/*
+ * Writes the JUnit XML report, one test suite named after the SUT with
+ * the test cases written when the tests end. The counters of the test
+ * suite are not known in advance, they are not written.
+ */
+class JUnitXmlLogger : public Logger
+{
+public:
+    explicit JUnitXmlLogger(std::ostream &stream);
+             // ends the report when the run was interrupted
+             ~JUnitXmlLogger();
+
+    void SutPath(const std::string &path) override;
+
+    void BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                            const omtt::TestPaths::size_type numberOfTests,
+                            const omtt::Path &testPath) override;
+    void EndTestExecution(const omtt::ProcessResults &processResults,
+                          const omtt::TestExecutionSummary &summary) override;
+
+    void OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                           const omtt::TestPaths::size_type numberOfTestsPassed,
+                           const omtt::TestPaths::size_type numberOfTestsFailed) override;
+
+    void Flush() override;
+
+private:
+    void _AppendFailure(const omtt::TestExecutionSummary &summary);
+    void _EndReport();
+    void _Write();
+
+private:
+    std::ostream      &fStream;
+    std::string       fBuffer;
+    std::string       fMessage;
+
+    std::string       fSutPath;
+    omtt::Path        fTestPath;
+    bool              fIsReportOpen;
+};
+
+}
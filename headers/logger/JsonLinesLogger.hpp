@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/logger/Logger.hpp"
+
+#include <ostream>
+#include <string>
+
+
+namespace omtt::logger
+{
+
+/*
+ * Writes one JSON object per line: the "start" record with the SUT path,
+ * one "test" record written when the test ends and the "summary" record.
+ */
+class JsonLinesLogger : public Logger
+{
+public:
+    explicit JsonLinesLogger(std::ostream &stream);
+
+    void SutPath(const std::string &path) override;
+
+    void BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                            const omtt::TestPaths::size_type numberOfTests,
+                            const omtt::Path &testPath) override;
+    void EndTestExecution(const omtt::ProcessResults &processResults,
+                          const omtt::TestExecutionSummary &summary) override;
+
+    void OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                           const omtt::TestPaths::size_type numberOfTestsPassed,
+                           const omtt::TestPaths::size_type numberOfTestsFailed) override;
+
+    void Flush() override;
+
+private:
+    void _WriteRecord();
+
+private:
+    std::ostream                &fStream;
+    std::string                 fBuffer;
+
+    omtt::Path                  fTestPath;
+    omtt::TestPaths::size_type  fTestNumber;
+    omtt::TestPaths::size_type  fNumberOfTests;
+};
+
+}
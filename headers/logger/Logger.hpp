@@ -34,6 +34,9 @@ public:
     virtual void OverallStatistics(const omtt::TestPaths::size_type executedTests,
                                    const omtt::TestPaths::size_type numberOfTestsPassed,
                                    const omtt::TestPaths::size_type numberOfTestsFailed) = 0;
+
+    // writes the events still kept in the buffers
+    virtual void Flush() {}
 };
 
 }
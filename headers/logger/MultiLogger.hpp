@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/logger/Logger.hpp"
+
+#include <memory>
+#include <vector>
+
+
+namespace omtt::logger
+{
+
+// passes every event to all the loggers, in the order they were given
+class MultiLogger : public Logger
+{
+public:
+    explicit MultiLogger(std::vector<std::unique_ptr<Logger>> &&loggers)
+        :
+        fLoggers(std::move(loggers))
+    {
+    }
+
+    void
+    SutPath(const std::string &path) override
+    {
+        for (auto &logger : fLoggers) {
+            logger->SutPath(path);
+        }
+    }
+
+    void
+    BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                       const omtt::TestPaths::size_type numberOfTests,
+                       const omtt::Path &testPath) override
+    {
+        for (auto &logger : fLoggers) {
+            logger->BeginTestExecution(executedTests, numberOfTests, testPath);
+        }
+    }
+
+    void
+    EndTestExecution(const omtt::ProcessResults &processResults,
+                     const omtt::TestExecutionSummary &summary) override
+    {
+        for (auto &logger : fLoggers) {
+            logger->EndTestExecution(processResults, summary);
+        }
+    }
+
+    void
+    OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                      const omtt::TestPaths::size_type numberOfTestsPassed,
+                      const omtt::TestPaths::size_type numberOfTestsFailed) override
+    {
+        for (auto &logger : fLoggers) {
+            logger->OverallStatistics(executedTests, numberOfTestsPassed, numberOfTestsFailed);
+        }
+    }
+
+    void
+    Flush() override
+    {
+        for (auto &logger : fLoggers) {
+            logger->Flush();
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<Logger>> fLoggers;
+};
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/logger/Logger.hpp"
+#include "headers/results/detail/Format.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::logger
+{
+
+/*
+ * Appends one fixed size record per test to the results log and the texts
+ * to the context file, see results/detail/Format.hpp. Only the causes of
+ * the failed tests are rendered, the records are read back and formatted
+ * by the "omtt report" command.
+ */
+class ResultsLogLogger : public Logger
+{
+public:
+    ResultsLogLogger(std::ostream &logStream, std::ostream &contextStream);
+
+    void SutPath(const std::string &path) override;
+
+    void BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                            const omtt::TestPaths::size_type numberOfTests,
+                            const omtt::Path &testPath) override;
+    void EndTestExecution(const omtt::ProcessResults &processResults,
+                          const omtt::TestExecutionSummary &summary) override;
+
+    void OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                           const omtt::TestPaths::size_type numberOfTestsPassed,
+                           const omtt::TestPaths::size_type numberOfTestsFailed) override;
+
+    void Flush() override;
+
+private:
+    std::uint64_t _WriteContext(const std::string_view &text);
+
+private:
+    std::ostream          &fLogStream;
+    std::ostream          &fContextStream;
+    std::uint64_t         fContextSize;
+    std::string           fBuffer;
+    results::detail::Record fRecord;
+};
+
+}
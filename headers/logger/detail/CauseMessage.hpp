@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2019-2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/expectation/validation/ValidationResult.hpp"
+
+#include <string>
+
+
+namespace omtt::logger::detail
+{
+
+// appends the description of the cause, the last line is not ended
+void
+append_cause_message(std::string &buffer, const expectation::validation::ValidationResult::Cause &cause);
+
+}
@@ -6,85 +6,15 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
-#include <algorithm>
-#include <cctype>
-#include <iomanip>
-#include <iterator>
-#include <sstream>
+#pragma once
 
+#include <cstddef>
+#include <string>
+#include <string_view>
 
-namespace omtt::logger::detail
-{
-
-namespace
-{
-
-constexpr int CONTEXT_SIZE = 6;
-
-template<class T>
-void
-write_char(std::ostream &os, const T c)
-{
-    os << std::setw(5) << std::left << c;
-}
-
-void
-write_hex_integer(std::ostream &os, const int c)
-{
-    os << "0x" << std::setfill('0') << std::setw(2) << std::hex << c << " ";
-}
-
-template<class T>
-T
-start_position(const T mismatchPosition)
-{
-    T lower = 0;
-    if (mismatchPosition > CONTEXT_SIZE) {
-        lower = mismatchPosition - CONTEXT_SIZE;
-    }
-    return lower;
-}
 
-template<class T>
-T
-end_position(const T textLength, const T mismatchPosition)
+namespace omtt::logger::detail
 {
-    return std::min(textLength,
-                    mismatchPosition + CONTEXT_SIZE + 1);
-}
-
-bool
-isSpace(const int c) {
-    return c == ' ';
-}
-
-bool
-isTab(const int c) {
-    return c == '\t';
-}
-
-bool
-isCr(const int c) {
-    return c == '\r';
-}
-
-bool
-isLf(const int c) {
-    return c == '\n';
-}
-
-bool
-isVTab(const int c) {
-    return c == '\v';
-}
-
-bool
-isFeed(const int c) {
-    return c == '\f';
-}
-
-}
-
 
 enum class PointerVisibility
 {
@@ -93,56 +23,21 @@ enum class PointerVisibility
 };
 
 
-template<class T>
-std::string
-context(const T &text,
-        const typename T::size_type mismatchPosition,
-        const PointerVisibility pointerVisibility)
-{
-    std::stringstream alnum, point, hex;
-
-    const typename T::size_type lower = start_position(mismatchPosition);
-    const typename T::size_type upper = end_position(text.length(), mismatchPosition);
-    for (auto i = lower; i < upper; ++i) {
-        const char c = text.at(i);
-        if (isSpace(c)) {
-            write_char(alnum, "SPC");
-        }
-        else if (isTab(c)) {
-            write_char(alnum, "TAB");
-        }
-        else if (isCr(c)) {
-            write_char(alnum, "CR");
-        }
-        else if (isLf(c)) {
-            write_char(alnum, "LF");
-        }
-        else if (isVTab(c)) {
-            write_char(alnum, "VT");
-        }
-        else if (isFeed(c)) {
-            write_char(alnum, "FF");
-        }
-        else if (std::isprint(c)) {
-            write_char(alnum, c);
-        }
-        else {
-            write_char(alnum, "NP");
-        }
-
-        if  (pointerVisibility == PointerVisibility::INCLUDE_POINTER) {
-            write_char(point, (i == mismatchPosition) ? '^' : ' ');
-        }
-
-        write_hex_integer(hex, c);
-    }
+/*
+ * Appends the bytes around the mismatch position to the buffer, one row
+ * with the characters, optionally one with the pointer at the mismatch
+ * and one with the hex codes. The rows are separated with new lines,
+ * the last one is not ended.
+ */
+void
+append_context(std::string &buffer,
+               const std::string_view &text,
+               const std::size_t mismatchPosition,
+               const PointerVisibility pointerVisibility);
 
-    if (pointerVisibility == PointerVisibility::INCLUDE_POINTER) {
-        return alnum.str() + "\n" + point.str() + "\n" + hex.str();
-    }
-    else {
-        return alnum.str() + "\n" + hex.str();
-    }
-}
+std::string
+context(const std::string_view &text,
+        const std::size_t mismatchPosition,
+        const PointerVisibility pointerVisibility);
 
 }
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+
+namespace omtt::logger::detail
+{
+
+/*
+ * The SUT may print any bytes, the bytes not being a valid UTF-8 text
+ * are replaced with U+FFFD, so the reports stay valid.
+ */
+
+// appends the quoted JSON string
+void
+append_json_string(std::string &buffer, const std::string_view &text);
+
+// appends the text escaped to be used as XML element content
+void
+append_xml_text(std::string &buffer, const std::string_view &text);
+
+// appends the text escaped to be used as XML attribute value
+void
+append_xml_attribute(std::string &buffer, const std::string_view &text);
+
+}
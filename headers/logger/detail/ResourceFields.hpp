@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/ResourceUsage.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::logger::detail
+{
+
+// the resource usage value in the machine readable reports, times are in seconds
+struct ResourceField
+{
+    std::string_view name;
+    void (*appendValue)(std::string &buffer, const ResourceUsage &resources);
+};
+
+extern const std::array<ResourceField, 8> RESOURCE_FIELDS;
+
+}
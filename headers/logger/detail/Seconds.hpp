@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+
+namespace omtt::logger::detail
+{
+
+// appends the duration in seconds, with the microseconds precision
+inline void
+append_seconds(std::string &buffer, const std::chrono::nanoseconds duration)
+{
+    const std::chrono::duration<double> seconds = duration;
+
+    char text[32];
+    const int length = std::snprintf(text, sizeof(text), "%.6f", seconds.count());
+    buffer.append(text, static_cast<std::size_t>(length));
+}
+
+}
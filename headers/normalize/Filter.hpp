@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <vector>
+
+
+namespace omtt::normalize
+{
+
+enum class Filter
+{
+    // removes spaces and tabs at the end of lines
+    TRIM,
+
+    // leaves at most one empty line in a row
+    SQUEEZE,
+
+    // replaces decimal numbers with '#'
+    MASK_INT,
+
+    // replaces hexadecimal numbers after the 0x prefix with '#'
+    MASK_HEX
+};
+
+// filters applied in the given order
+typedef std::vector<Filter> Filters;
+
+}  // omtt::normalize
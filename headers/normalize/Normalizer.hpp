@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/normalize/Filter.hpp"
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::normalize
+{
+
+/*
+ * Applies the filters to a text given in chunks. Every filter changes
+ * the chunk in place in one pass, only the spaces which may end a line
+ * are kept until the next chunk. The filtered text is passed to the sink,
+ * the kept spaces followed by a text are passed as a separate piece.
+ */
+class Normalizer
+{
+public:
+    using Sink = std::function<void(const std::string_view &piece)>;
+
+    explicit      Normalizer(const Filters &filters);
+
+    void          Apply(std::string &chunk, const Sink &sink);
+
+private:
+    struct FilterState
+    {
+        Filter       filter;
+
+        // TRIM: spaces not followed by anything yet
+        std::string  pendingSpaces;
+
+        // SQUEEZE: new lines in a row
+        unsigned     newLines;
+
+        // MASK_INT, MASK_HEX: inside the masked number
+        bool         isMasking;
+
+        // MASK_HEX: the last three bytes of the filtered text, the newest is the last one
+        char         recent[3];
+    };
+
+    void          _Apply(std::vector<FilterState>::size_type first, std::string &chunk, const Sink &sink);
+
+    static void   _Trim(FilterState &state, std::string &chunk, std::string &releasedSpaces);
+    static void   _Squeeze(FilterState &state, std::string &chunk);
+    static void   _MaskInt(FilterState &state, std::string &chunk);
+    static void   _MaskHex(FilterState &state, std::string &chunk);
+
+private:
+    std::vector<FilterState>  fStates;
+};
+
+// normalizes the whole text
+std::string  normalized(const Filters &filters, std::string text);
+
+}  // omtt::normalize
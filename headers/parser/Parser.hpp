@@ -18,17 +18,37 @@
 #include "headers/expectation/ExitCodeExpectation.hpp"
 #include "headers/expectation/SuccessfulExitExpectation.hpp"
 #include "headers/expectation/FailureExitExpectation.hpp"
+#include "headers/expectation/OutputFileExpectation.hpp"
+#include "headers/expectation/OutputMatchesExpectation.hpp"
+#include "headers/expectation/InOutputMatchesExpectation.hpp"
+#include "headers/expectation/InOutputInOrderExpectation.hpp"
+#include "headers/expectation/OutputTemplateExpectation.hpp"
+#include "headers/expectation/OutputLinesUnorderedExpectation.hpp"
+#include "headers/expectation/OutputJsonExpectation.hpp"
+#include "headers/expectation/OutputWithToleranceExpectation.hpp"
+#include "headers/expectation/OutputSizeExpectation.hpp"
+#include "headers/expectation/OutputLineCountExpectation.hpp"
+#include "headers/expectation/OutputStartsWithExpectation.hpp"
+#include "headers/expectation/OutputSha256Expectation.hpp"
 
 #include "headers/parser/exception/MissingKeywordException.hpp"
 #include "headers/parser/exception/WrongTokenException.hpp"
 #include "headers/parser/exception/MissingTextException.hpp"
 #include "headers/parser/exception/MissingIntegerException.hpp"
+#include "headers/parser/exception/MissingToleranceException.hpp"
+#include "headers/parser/exception/IntegerOutOfRangeException.hpp"
 #include "headers/parser/exception/UnexpectedKeywordException.hpp"
+#include "headers/normalize/Normalizer.hpp"
+#include "headers/regex/Regex.hpp"
 
 #include <algorithm>
+#include <charconv>
+#include <cstdint>
 #include <initializer_list>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 namespace omtt::parser
@@ -40,13 +60,20 @@ public:
     explicit Parser(Lexer &lexer)
         :
         fLexer(lexer),
-        fCurrentState(State::RUN)
+        fCurrentState(State::RUN),
+        fHasNextTest(false)
     {
     }
 
     TestData &&
     parse()
     {
+        if (fHasNextTest) {
+            fTestData = TestData();
+            fCurrentState = State::WITH;
+            fHasNextTest = false;
+        }
+
         while (true) {
             switch (fCurrentState) {
                 case State::RUN:
@@ -55,6 +82,12 @@ public:
                 case State::WITH:
                     _HandleWithState();
                     break;
+                case State::NORMALIZE_FILTER:
+                    _HandleNormalizeFilterState();
+                    break;
+                case State::NORMALIZE_MASK:
+                    _HandleNormalizeMaskState();
+                    break;
                 case State::EMPTY_OR_INPUT:
                     _HandleEmptyOrInputState();
                     break;
@@ -64,6 +97,9 @@ public:
                 case State::TEXT_INPUT:
                     _HandleTextInputState();
                     break;
+                case State::INPUT_FILE:
+                    _HandleInputFileState();
+                    break;
                 case State::EXPECT_OR_FINISH:
                     _HandleExpectOrFinishState();
                     break;
@@ -73,9 +109,24 @@ public:
                 case State::IN_OUTPUT:
                     _HandleInOutputState();
                     break;
+                case State::IN_ERROR_OUTPUT:
+                    _HandleInErrorOutputState();
+                    break;
                 case State::EMPTY_OUTPUT:
                     _HandleEmptyOutputState();
                     break;
+                case State::EMPTY_ERROR_OUTPUT:
+                    _HandleEmptyErrorOutputState();
+                    break;
+                case State::ERROR_OUTPUT:
+                    _HandleErrorOutputState();
+                    break;
+                case State::TEXT_ERROR_OUTPUT:
+                    _HandleTextErrorOutputState();
+                    break;
+                case State::TEXT_IN_ERROR_OUTPUT:
+                    _HandleTextInErrorOutputState();
+                    break;
                 case State::CODE_OR_WITH:
                     _HandleCodeOrWithState();
                     break;
@@ -88,6 +139,51 @@ public:
                 case State::TEXT_OUTPUT:
                     _HandleTextOutputState();
                     break;
+                case State::OUTPUT_FILE:
+                    _HandleOutputFileState();
+                    break;
+                case State::OUTPUT_TEMPLATE:
+                    _HandleOutputTemplateState();
+                    break;
+                case State::OUTPUT_LINES:
+                    _HandleOutputLinesState();
+                    break;
+                case State::TEXT_OUTPUT_LINES_UNORDERED:
+                    _HandleTextOutputLinesUnorderedState();
+                    break;
+                case State::OUTPUT_JSON:
+                    _HandleOutputJsonState();
+                    break;
+                case State::OUTPUT_SIZE:
+                    _HandleOutputSizeState();
+                    break;
+                case State::OUTPUT_STARTS:
+                    _HandleOutputStartsState();
+                    break;
+                case State::TEXT_OUTPUT_STARTS_WITH:
+                    _HandleTextOutputStartsWithState();
+                    break;
+                case State::OUTPUT_SHA256:
+                    _HandleOutputSha256State();
+                    break;
+                case State::OUTPUT_WITH:
+                    _HandleOutputWithState();
+                    break;
+                case State::TOLERANCE_AND_TEXT_OUTPUT:
+                    _HandleToleranceAndTextOutputState();
+                    break;
+                case State::OUTPUT_MATCHES:
+                    _HandleOutputMatchesState();
+                    break;
+                case State::IN_OUTPUT_MATCHES:
+                    _HandleInOutputMatchesState();
+                    break;
+                case State::IN_OUTPUT_ORDER:
+                    _HandleInOutputOrderState();
+                    break;
+                case State::TEXT_IN_OUTPUT_IN_ORDER:
+                    _HandleTextInOutputInOrderState();
+                    break;
                 case State::TEXT_IN_OUTPUT:
                     _HandleTextInOutputState();
                     break;
@@ -97,21 +193,62 @@ public:
         }
     }
 
+    bool
+    HasNextTest() const
+    {
+        return fHasNextTest;
+    }
+
+    std::vector<TestData>
+    parseAll()
+    {
+        std::vector<TestData> tests;
+
+        do {
+            tests.emplace_back(parse());
+        } while (HasNextTest());
+
+        return tests;
+    }
+
 private:
       enum class State {
         RUN,
         WITH,
+        NORMALIZE_FILTER,
+        NORMALIZE_MASK,
         EMPTY_OR_INPUT,
         EMPTY_INPUT,
         TEXT_INPUT,
+        INPUT_FILE,
         EXPECT_OR_FINISH,
         OUTPUT_OR_EXIT_OR_IN,
         IN_OUTPUT,
+        IN_ERROR_OUTPUT,
         EMPTY_OUTPUT,
+        EMPTY_ERROR_OUTPUT,
+        ERROR_OUTPUT,
+        TEXT_ERROR_OUTPUT,
+        TEXT_IN_ERROR_OUTPUT,
         CODE_OR_WITH,
         CODE_NUMBER,
         EXIT_WITH_FAILURE_OR_SUCCESS,
         TEXT_OUTPUT,
+        OUTPUT_FILE,
+        OUTPUT_TEMPLATE,
+        OUTPUT_LINES,
+        TEXT_OUTPUT_LINES_UNORDERED,
+        OUTPUT_JSON,
+        OUTPUT_SIZE,
+        OUTPUT_STARTS,
+        TEXT_OUTPUT_STARTS_WITH,
+        OUTPUT_SHA256,
+        OUTPUT_WITH,
+        TOLERANCE_AND_TEXT_OUTPUT,
+        OUTPUT_MATCHES,
+        IN_OUTPUT_MATCHES,
+        IN_OUTPUT_ORDER,
+        TEXT_IN_OUTPUT_IN_ORDER,
         TEXT_IN_OUTPUT,
         DONE
     };
@@ -126,7 +263,70 @@ private:
     void
     _HandleWithState()
     {
-        _ExpectKeywordAndSwitchToState("WITH", State::EMPTY_OR_INPUT);
+        auto token = fLexer.FindNextToken();
+
+        // the filters are optional, so only the required keyword is reported
+        _ThrowMissingKeywordWhenTokenNotPresent({"WITH"}, token);
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "NORMALIZE") {
+            fCurrentState = State::NORMALIZE_FILTER;
+        }
+        else if (token->kind == lexer::TokenKind::KEYWORD
+                 && token->value == "WITH") {
+            fCurrentState = State::EMPTY_OR_INPUT;
+        }
+        else {
+            _ThrowWhenNotKeywordOrHasDifferrentName({"WITH"}, *token);
+        }
+    }
+
+    void
+    _HandleNormalizeFilterState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingKeywordWhenTokenNotPresent({"TRIM", "SQUEEZE", "MASK"}, token);
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "TRIM") {
+            fTestData.normalization.push_back(normalize::Filter::TRIM);
+            fCurrentState = State::WITH;
+        }
+        else if (token->kind == lexer::TokenKind::KEYWORD
+                 && token->value == "SQUEEZE") {
+            fTestData.normalization.push_back(normalize::Filter::SQUEEZE);
+            fCurrentState = State::WITH;
+        }
+        else if (token->kind == lexer::TokenKind::KEYWORD
+                 && token->value == "MASK") {
+            fCurrentState = State::NORMALIZE_MASK;
+        }
+        else {
+            _ThrowWhenNotKeywordOrHasDifferrentName({"TRIM", "SQUEEZE", "MASK"}, *token);
+        }
+    }
+
+    void
+    _HandleNormalizeMaskState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingKeywordWhenTokenNotPresent({"INT", "HEX"}, token);
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "INT") {
+            fTestData.normalization.push_back(normalize::Filter::MASK_INT);
+            fCurrentState = State::WITH;
+        }
+        else if (token->kind == lexer::TokenKind::KEYWORD
+                 && token->value == "HEX") {
+            fTestData.normalization.push_back(normalize::Filter::MASK_HEX);
+            fCurrentState = State::WITH;
+        }
+        else {
+            _ThrowWhenNotKeywordOrHasDifferrentName({"INT", "HEX"}, *token);
+        }
     }
 
     void
@@ -161,24 +361,48 @@ private:
         auto token = fLexer.FindNextToken();
 
         _ThrowMissingTextWhenTokenNotPresent(token);
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "FILE") {
+            fCurrentState = State::INPUT_FILE;
+            return;
+        }
+
         _ThrowWhenKeyword(*token);
 
         fTestData.input = token->value;
         fCurrentState = State::EXPECT_OR_FINISH;
     }
 
+    void
+    _HandleInputFileState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        fTestData.inputFile = token->value;
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
     void
     _HandleExpectOrFinishState()
     {
         auto token = fLexer.FindNextToken();
 
-        if (token.has_value()) {
-            _ThrowWhenNotKeywordOrHasDifferrentName({"EXPECT"}, *token);
-            fCurrentState = State::OUTPUT_OR_EXIT_OR_IN;
+        if (!token.has_value()) {
+            fCurrentState = State::DONE;
         }
-        else {
+        else if (token->kind == lexer::TokenKind::KEYWORD
+                 && token->value == "RUN") {
+            fHasNextTest = true;
             fCurrentState = State::DONE;
         }
+        else {
+            _ThrowWhenNotKeywordOrHasDifferrentName({"EXPECT", "RUN"}, *token);
+            fCurrentState = State::OUTPUT_OR_EXIT_OR_IN;
+        }
     }
 
     void
@@ -186,12 +410,16 @@ private:
     {
         auto token = fLexer.FindNextToken();
 
-        _ThrowMissingKeywordWhenTokenNotPresent({"EMPTY", "OUTPUT", "EXIT", "IN"}, token);
+        _ThrowMissingKeywordWhenTokenNotPresent({"EMPTY", "OUTPUT", "ERROR", "EXIT", "IN"}, token);
 
         if (token->kind == lexer::TokenKind::KEYWORD
             && token->value == "OUTPUT") {
             fCurrentState = State::TEXT_OUTPUT;
         }
+        else if (token->kind == lexer::TokenKind::KEYWORD
+                 && token->value == "ERROR") {
+            fCurrentState = State::ERROR_OUTPUT;
+        }
         else if (token->kind == lexer::TokenKind::KEYWORD
                  && token->value == "EXIT") {
             fCurrentState = State::CODE_OR_WITH;
@@ -205,23 +433,76 @@ private:
             fCurrentState = State::EMPTY_OUTPUT;
         }
         else {
-            _ThrowWhenNotKeywordOrHasDifferrentName({"EMPTY", "OUTPUT", "EXIT", "IN"}, *token);
+            _ThrowWhenNotKeywordOrHasDifferrentName({"EMPTY", "OUTPUT", "ERROR", "EXIT", "IN"}, *token);
         }
     }
 
     void
     _HandleInOutputState()
     {
-        _ExpectKeywordAndSwitchToState("OUTPUT", State::TEXT_IN_OUTPUT);
+        _ExpectOutputOrErrorAndSwitchToState(State::TEXT_IN_OUTPUT, State::IN_ERROR_OUTPUT);
+    }
+
+    void
+    _HandleInErrorOutputState()
+    {
+        _ExpectKeywordAndSwitchToState("OUTPUT", State::TEXT_IN_ERROR_OUTPUT);
     }
 
     void
     _HandleEmptyOutputState()
+    {
+        _ExpectOutputOrErrorAndSwitchToState(State::EXPECT_OR_FINISH, State::EMPTY_ERROR_OUTPUT);
+
+        if (fCurrentState == State::EXPECT_OR_FINISH) {
+            auto expectation = std::make_unique<expectation::EmptyOutputExpectation>();
+            fTestData.expectations.emplace_back(std::move(expectation));
+        }
+    }
+
+    void
+    _HandleEmptyErrorOutputState()
     {
         _ExpectKeywordAndSwitchToState("OUTPUT", State::EXPECT_OR_FINISH);
 
-        auto expectation = std::make_unique<expectation::EmptyOutputExpectation>();
+        auto expectation = std::make_unique<expectation::EmptyOutputExpectation>(expectation::Stream::ERROR_OUTPUT);
+        fTestData.expectations.emplace_back(std::move(expectation));
+    }
+
+    void
+    _HandleErrorOutputState()
+    {
+        _ExpectKeywordAndSwitchToState("OUTPUT", State::TEXT_ERROR_OUTPUT);
+    }
+
+    void
+    _HandleTextErrorOutputState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::FullOutputExpectation>(_ExpectedText(token->value),
+                                                                                expectation::Stream::ERROR_OUTPUT);
         fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleTextInErrorOutputState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::PartialOutputExpectation>(_ExpectedText(token->value),
+                                                                                   expectation::Stream::ERROR_OUTPUT);
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
     }
 
     void
@@ -296,10 +577,230 @@ private:
     {
         auto token = fLexer.FindNextToken();
 
+        _ThrowMissingTextWhenTokenNotPresent(token);
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "FILE") {
+            fCurrentState = State::OUTPUT_FILE;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "MATCHES") {
+            fCurrentState = State::OUTPUT_MATCHES;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "TEMPLATE") {
+            fCurrentState = State::OUTPUT_TEMPLATE;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "LINES") {
+            fCurrentState = State::OUTPUT_LINES;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "JSON") {
+            fCurrentState = State::OUTPUT_JSON;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "SIZE") {
+            fCurrentState = State::OUTPUT_SIZE;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "STARTS") {
+            fCurrentState = State::OUTPUT_STARTS;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "SHA256") {
+            fCurrentState = State::OUTPUT_SHA256;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "WITH") {
+            fCurrentState = State::OUTPUT_WITH;
+            return;
+        }
+
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::FullOutputExpectation>(_ExpectedText(token->value));
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputFileState()
+    {
+        auto token = fLexer.FindNextToken();
+
         _ThrowMissingTextWhenTokenNotPresent(token);
         _ThrowWhenKeyword(*token);
 
-        auto expectation = std::make_unique<expectation::FullOutputExpectation>(token->value);
+        auto expectation = std::make_unique<expectation::OutputFileExpectation>(token->value, fTestData.normalization);
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputTemplateState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::OutputTemplateExpectation>(_ExpectedText(token->value));
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputLinesState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        if (token.has_value()
+            && token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "UNORDERED") {
+            fCurrentState = State::TEXT_OUTPUT_LINES_UNORDERED;
+            return;
+        }
+
+        const auto [comparison, expectedLineCount] = _ExpectCount(token);
+
+        auto expectation = std::make_unique<expectation::OutputLineCountExpectation>(comparison, expectedLineCount);
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleTextOutputLinesUnorderedState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::OutputLinesUnorderedExpectation>(_ExpectedText(token->value));
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputJsonState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::OutputJsonExpectation>(_ExpectedText(token->value));
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputSizeState()
+    {
+        const auto [comparison, expectedSize] = _ExpectCount(fLexer.FindNextToken());
+
+        auto expectation = std::make_unique<expectation::OutputSizeExpectation>(comparison, expectedSize);
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputStartsState()
+    {
+        _ExpectKeywordAndSwitchToState("WITH", State::TEXT_OUTPUT_STARTS_WITH);
+    }
+
+    void
+    _HandleTextOutputStartsWithState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::OutputStartsWithExpectation>(_ExpectedText(token->value));
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputSha256State()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::OutputSha256Expectation>(token->value);
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputWithState()
+    {
+        _ExpectKeywordAndSwitchToState("TOLERANCE", State::TOLERANCE_AND_TEXT_OUTPUT);
+    }
+
+    void
+    _HandleToleranceAndTextOutputState()
+    {
+        auto absoluteTolerance = fLexer.FindNextToken();
+        _ThrowMissingToleranceWhenTokenNotPresent(absoluteTolerance);
+        _ThrowWhenKeyword(*absoluteTolerance);
+
+        auto relativeTolerance = fLexer.FindNextToken();
+        _ThrowMissingToleranceWhenTokenNotPresent(relativeTolerance);
+        _ThrowWhenKeyword(*relativeTolerance);
+
+        auto token = fLexer.FindNextToken();
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::OutputWithToleranceExpectation>(_ExpectedText(token->value),
+                                                                                         absoluteTolerance->value,
+                                                                                         relativeTolerance->value);
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleOutputMatchesState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+        regex::checkSyntax(token->value);
+
+        auto expectation = std::make_unique<expectation::OutputMatchesExpectation>(token->value);
         fTestData.expectations.emplace_back(std::move(expectation));
 
         fCurrentState = State::EXPECT_OR_FINISH;
@@ -310,15 +811,124 @@ private:
     {
         auto token = fLexer.FindNextToken();
 
+        _ThrowMissingTextWhenTokenNotPresent(token);
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "MATCHES") {
+            fCurrentState = State::IN_OUTPUT_MATCHES;
+            return;
+        }
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "IN") {
+            fCurrentState = State::IN_OUTPUT_ORDER;
+            return;
+        }
+
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::PartialOutputExpectation>(_ExpectedText(token->value));
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    void
+    _HandleInOutputMatchesState()
+    {
+        auto token = fLexer.FindNextToken();
+
         _ThrowMissingTextWhenTokenNotPresent(token);
         _ThrowWhenKeyword(*token);
+        regex::checkSyntax(token->value);
 
-        auto expectation = std::make_unique<expectation::PartialOutputExpectation>(token->value);
+        auto expectation = std::make_unique<expectation::InOutputMatchesExpectation>(token->value);
         fTestData.expectations.emplace_back(std::move(expectation));
 
         fCurrentState = State::EXPECT_OR_FINISH;
     }
 
+    void
+    _HandleInOutputOrderState()
+    {
+        _ExpectKeywordAndSwitchToState("ORDER", State::TEXT_IN_OUTPUT_IN_ORDER);
+    }
+
+    void
+    _HandleTextInOutputInOrderState()
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingTextWhenTokenNotPresent(token);
+        _ThrowWhenKeyword(*token);
+
+        auto expectation = std::make_unique<expectation::InOutputInOrderExpectation>(_ExpectedText(token->value));
+        fTestData.expectations.emplace_back(std::move(expectation));
+
+        fCurrentState = State::EXPECT_OR_FINISH;
+    }
+
+    std::string_view
+    _ExpectedText(const std::string_view &text)
+    {
+        if (fTestData.normalization.empty()) {
+            return text;
+        }
+
+        auto normalized = std::make_unique<const std::string>(
+            normalize::normalized(fTestData.normalization, std::string(text)));
+        const std::string_view normalizedText = *normalized;
+        fTestData.normalizedTexts.emplace_back(std::move(normalized));
+
+        return normalizedText;
+    }
+
+    // the count may be preceded by AT LEAST or AT MOST
+    std::pair<expectation::Comparison, std::uint64_t>
+    _ExpectCount(std::optional<const lexer::Token> token)
+    {
+        _ThrowMissingIntegerWhenTokenNotPresent(token);
+
+        if (token->kind != lexer::TokenKind::KEYWORD
+            || token->value != "AT") {
+            return {expectation::Comparison::EXACTLY, _ExpectInteger(token)};
+        }
+
+        auto limit = fLexer.FindNextToken();
+
+        _ThrowMissingKeywordWhenTokenNotPresent({"LEAST", "MOST"}, limit);
+        _ThrowWhenNotKeywordOrHasDifferrentName({"LEAST", "MOST"}, *limit);
+
+        const auto comparison = (limit->value == "LEAST")
+                                ? expectation::Comparison::AT_LEAST
+                                : expectation::Comparison::AT_MOST;
+
+        return {comparison, _ExpectInteger(fLexer.FindNextToken())};
+    }
+
+    static std::uint64_t
+    _ExpectInteger(std::optional<const lexer::Token> token)
+    {
+        constexpr auto expectedTokenKind = lexer::TokenKind::INTEGER;
+
+        _ThrowMissingIntegerWhenTokenNotPresent(token);
+
+        if (token->kind != expectedTokenKind) {
+            throw exception::WrongTokenException({}, expectedTokenKind, *token);
+        }
+
+        std::uint64_t value = 0;
+        const char * const end = token->value.data() + token->value.size();
+        const auto result = std::from_chars(token->value.data(), end, value);
+
+        // the lexer gives only digits, so the number may only be too big
+        if (result.ec != std::errc() || result.ptr != end) {
+            throw exception::IntegerOutOfRangeException(*token);
+        }
+
+        return value;
+    }
+
     static void
     _ThrowMissingTextWhenTokenNotPresent(std::optional<const lexer::Token> &given)
     {
@@ -335,6 +945,14 @@ private:
         }
     }
 
+    static void
+    _ThrowMissingToleranceWhenTokenNotPresent(std::optional<const lexer::Token> &given)
+    {
+        if (!given.has_value()) {
+            throw exception::MissingToleranceException();
+        }
+    }
+
     static void
     _ThrowWhenKeyword(const lexer::Token &given)
     {
@@ -354,6 +972,23 @@ private:
         fCurrentState = state;
     }
 
+    void
+    _ExpectOutputOrErrorAndSwitchToState(const State outputState, const State errorOutputState)
+    {
+        auto token = fLexer.FindNextToken();
+
+        _ThrowMissingKeywordWhenTokenNotPresent({"OUTPUT", "ERROR"}, token);
+
+        if (token->kind == lexer::TokenKind::KEYWORD
+            && token->value == "ERROR") {
+            fCurrentState = errorOutputState;
+        }
+        else {
+            _ThrowWhenNotKeywordOrHasDifferrentName({"OUTPUT", "ERROR"}, *token);
+            fCurrentState = outputState;
+        }
+    }
+
     void
     _IgnoreCommentExpectKeywordAndSwitchToState(const std::string &expectedKeywordName, const State state)
     {
@@ -411,6 +1046,7 @@ private:
 private:
     Lexer &    fLexer;
     State      fCurrentState;
+    bool       fHasNextTest;
     TestData   fTestData;
 };
 
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/lexer/Token.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace omtt::parser::exception
+{
+
+class IntegerOutOfRangeException : public std::runtime_error {
+public:
+    explicit IntegerOutOfRangeException(const lexer::Token &given)
+        :
+        std::runtime_error("Number '"
+                           + static_cast<std::string>(given.value)
+                           + "' is out of range.")
+    {
+    }
+};
+
+}  // omtt::parser::exception
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stdexcept>
+
+
+namespace omtt::parser::exception
+{
+
+class MissingToleranceException : public std::runtime_error {
+public:
+    explicit MissingToleranceException()
+        :
+        std::runtime_error("Expected tolerance, a floating point number, but got nothing.")
+    {
+    }
+};
+
+}  // omtt::parser::exception
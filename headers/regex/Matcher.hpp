@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/regex/Regex.hpp"
+
+#include <optional>
+#include <string_view>
+
+
+namespace omtt::regex
+{
+
+/*
+ * Matches one text given in chunks. In WHOLE_TEXT mode the result is
+ * decided when the text can't match anymore, in SEARCH mode when a match
+ * is found; bytes after that are not looked at.
+ */
+class Matcher
+{
+public:
+    explicit     Matcher(Regex &regex);
+
+    // returns the number of bytes consumed before the result was decided
+    std::size_t  Feed(const std::string_view &chunk);
+    bool         Finish();
+
+    bool         IsDecided() const;
+
+    // the longest prefix of the text that can still be extended to a match
+    std::size_t  GetMatchedPrefixSize() const;
+
+private:
+    void         _StepUncached(unsigned char byte);
+
+private:
+    Regex &                          fRegex;
+    std::int32_t                     fState;
+    std::optional<Regex::StateKey>   fUncachedState;
+    bool                             fIsDecided;
+    bool                             fIsMatched;
+    std::size_t                      fConsumedSize;
+};
+
+}  // omtt::regex
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/regex/Regex.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+namespace omtt::regex
+{
+
+/*
+ * Keeps the compiled patterns of all tests, so a pattern used by many
+ * tests is compiled once and its DFA states are reused.
+ */
+class PatternCache
+{
+public:
+    Regex &  Get(const std::string_view &pattern, Mode mode);
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<Regex>>  fRegexes;
+};
+
+}  // omtt::regex
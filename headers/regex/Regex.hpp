@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/regex/detail/Program.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+namespace omtt::regex
+{
+
+enum class Mode
+{
+    WHOLE_TEXT,
+    SEARCH
+};
+
+/*
+ * Throws SyntaxException when the pattern is not valid.
+ */
+void
+checkSyntax(const std::string_view &pattern);
+
+/*
+ * Compiled pattern. The NFA is turned lazily into a DFA while texts are
+ * matched, the DFA states are kept for the next texts. When there are too
+ * many DFA states the NFA is simulated directly, so matching is always
+ * linear in the text size.
+ */
+class Regex
+{
+public:
+                   Regex(const std::string_view &pattern, Mode mode);
+
+    Mode           GetMode() const;
+
+private:
+    friend class Matcher;
+
+    struct StateKey
+    {
+        std::vector<std::uint32_t> instructions;
+        bool isAtLineStart;
+
+        bool operator==(const StateKey &other) const;
+    };
+
+    struct StateKeyHash
+    {
+        std::size_t operator()(const StateKey &key) const;
+    };
+
+    struct Step
+    {
+        StateKey next;
+        bool isDecided;
+    };
+
+    static constexpr std::int32_t UNKNOWN = -1;
+    static constexpr std::int32_t DECIDED = -2;
+    static constexpr std::int32_t UNCACHED = -3;
+
+    std::int32_t   _StartState();
+    std::int32_t   _ComputeTransition(std::uint32_t state, unsigned char byte);
+    std::int32_t   _FindOrAddState(StateKey &&key);
+    std::int32_t   _FindState(const StateKey &key) const;
+    bool           _IsDecidedState(const StateKey &key) const;
+    Step           _Step(const StateKey &key, unsigned char byte);
+    bool           _IsMatchAtEnd(const StateKey &key);
+    StateKey       _StartKey();
+    void           _NewVisitMark();
+    void           _AddClosure(std::uint32_t instruction,
+                               bool isAtLineStart,
+                               bool isAtLineEnd,
+                               std::vector<std::uint32_t> &instructions);
+
+private:
+    const Mode                                                fMode;
+    const detail::Program                                     fProgram;
+    std::array<std::uint16_t, 256>                            fByteClass;
+    std::size_t                                               fClassCount;
+    std::vector<StateKey>                                     fStates;
+    std::vector<std::int32_t>                                 fTransitions;
+    std::unordered_map<StateKey, std::int32_t, StateKeyHash>  fStateIndexes;
+    std::vector<std::uint32_t>                                fVisited;
+    std::uint32_t                                             fVisitMark;
+    std::vector<std::uint32_t>                                fStack;
+    std::vector<std::uint32_t>                                fExpanded;
+};
+
+}  // omtt::regex
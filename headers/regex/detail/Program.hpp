@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::regex::detail
+{
+
+typedef std::bitset<256> ByteSet;
+
+struct Instruction
+{
+    enum class Kind : std::uint8_t
+    {
+        BYTES,
+        SPLIT,
+        LINE_BEGIN,
+        LINE_END,
+        MATCH
+    };
+
+    Kind kind;
+    std::uint32_t out;
+    std::uint32_t out1;
+    std::uint32_t byteSet;
+};
+
+/*
+ * Thompson NFA, executed without backtracking.
+ */
+struct Program
+{
+    std::vector<Instruction> instructions;
+    std::vector<ByteSet> byteSets;
+    std::uint32_t start;
+};
+
+Program
+compile(const std::string_view &pattern);
+
+}  // omtt::regex::detail
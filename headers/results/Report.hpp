@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/Verdict.hpp"
+#include "headers/logger/Logger.hpp"
+#include "headers/results/ResultsLog.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace omtt::results
+{
+
+struct ReportFilter
+{
+    std::optional<Verdict> verdict;
+
+    // a part of the test path, empty matches all tests
+    std::string pathText;
+
+    std::optional<detail::CauseKind> causeKind;
+};
+
+// the kinds are named like the enumerators, e.g. EXIT_CODE
+std::optional<detail::CauseKind>
+cause_kind_from_name(const std::string_view &name);
+
+bool
+is_reported(const TestResult &result, const ReportFilter &filter);
+
+// replays the logged tests matching the filter to the logger, returns the number of failed ones
+TestPaths::size_type
+render_report(const ResultsLog &log, const ReportFilter &filter, logger::Logger &logger);
+
+}  // omtt::results
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "headers/Path.hpp"
+#include "headers/ResourceUsage.hpp"
+#include "headers/Verdict.hpp"
+#include "headers/results/detail/Format.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+namespace omtt::results
+{
+
+struct TestResult
+{
+    std::uint64_t number;
+    std::uint64_t numberOfTests;
+    std::string_view path;
+    Verdict verdict;
+    int exitCode;
+    std::chrono::nanoseconds duration;
+    ResourceUsage resources;
+    std::string_view errors;
+    std::vector<std::string_view> causes;
+
+    // only the kinds of the first causes are logged
+    std::vector<detail::CauseKind> causeKinds;
+};
+
+/*
+ * Memory mapped results log written with the --results-log option. The
+ * records after the last complete one, e.g. left by an interrupted run,
+ * are ignored.
+ */
+class ResultsLog
+{
+public:
+    explicit                       ResultsLog(const Path &logFilePath);
+                                   ~ResultsLog();
+
+                                   ResultsLog(const ResultsLog &) = delete;
+    ResultsLog &                   operator=(const ResultsLog &) = delete;
+
+    std::string_view               GetSutPath() const;
+    std::uint64_t                  GetTestsCount() const;
+    TestResult                     GetTest(const std::uint64_t index) const;
+
+private:
+    struct Mapping
+    {
+        void *address;
+        size_t size;
+    };
+
+private:
+    static Mapping                 _Map(const Path &path);
+    static void                    _Unmap(const Mapping &mapping);
+    bool                           _IsHeaderValid();
+    bool                           _IsRecordValid(const detail::Record &record) const;
+    bool                           _AreCausesValid(const detail::Record &record) const;
+    std::string_view               _Text(const std::uint64_t offset, const std::uint64_t length) const;
+
+private:
+    Mapping                        fLog;
+    Mapping                        fContext;
+    const detail::Header *         fHeader;
+    const detail::Record *         fRecords;
+    std::uint64_t                  fRecordsCount;
+};
+
+}  // omtt::results
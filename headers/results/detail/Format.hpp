@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace omtt::results::detail
+{
+
+/*
+ * Results log layout (native byte order, every part 8 bytes aligned):
+ *
+ *   Header
+ *   Record[]                         one per executed test, appended
+ *
+ * The texts are kept in the context file, next to the log:
+ *
+ *   char[]                           SUT path, test paths, error outputs
+ *   { uint64 length; char[length] }  cause messages of the failed tests
+ */
+
+constexpr char MAGIC[8] = {'O', 'M', 'T', 'T', 'R', '\0', '\0', '\0'};
+constexpr std::uint32_t FORMAT_VERSION = 3;
+
+constexpr const char *CONTEXT_FILE_SUFFIX = ".context";
+
+// the values are kept in the logs, new kinds get the next free value
+enum class CauseKind : std::uint8_t
+{
+    NONE = 0,
+    EMPTY_OUTPUT = 1,
+    EXIT_CODE = 2,
+    FULL_OUTPUT = 3,
+    PARTIAL_OUTPUT = 4,
+    SUCCESSFUL_EXIT = 5,
+    FAILURE_EXIT = 6,
+    OUTPUT_FILE = 7,
+    OUTPUT_MATCHES = 8,
+    IN_OUTPUT_MATCHES = 9,
+    OUTPUT_TEMPLATE = 10,
+    IN_OUTPUT_IN_ORDER = 11,
+    OUTPUT_LINES_UNORDERED = 12,
+    OUTPUT_JSON = 13,
+    OUTPUT_WITH_TOLERANCE = 14,
+    OUTPUT_DIFF = 15,
+    OUTPUT_SIZE = 16,
+    OUTPUT_LINE_COUNT = 17,
+    OUTPUT_STARTS_WITH = 18,
+    OUTPUT_SHA256 = 19,
+    INPUT_FILE = 20
+};
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t recordSize;
+    std::uint64_t sutOffset;
+    std::uint64_t sutLength;
+};
+
+struct Record
+{
+    std::uint64_t number;
+    std::uint64_t numberOfTests;
+    std::uint64_t pathOffset;
+    std::uint64_t pathLength;
+    std::uint64_t errorsOffset;
+    std::uint64_t errorsLength;
+    std::uint64_t causesOffset;
+    std::uint64_t causesLength;
+    std::int64_t durationNsec;
+    std::int64_t wallTimeNsec;
+    std::int64_t userTimeUsec;
+    std::int64_t systemTimeUsec;
+    std::int64_t maxResidentSetSizeKb;
+    std::int64_t minorPageFaults;
+    std::int64_t majorPageFaults;
+    std::int64_t voluntaryContextSwitches;
+    std::int64_t involuntaryContextSwitches;
+    std::int32_t exitCode;
+    std::uint32_t causesCount;
+    std::uint8_t verdict;
+
+    // the kinds of the first causes, the unused ones are NONE
+    CauseKind causeKinds[7];
+};
+
+static_assert(sizeof(Header) == 32, "unexpected results log header size");
+static_assert(sizeof(Record) == 152, "unexpected results log record size");
+
+}  // omtt::results::detail
@@ -16,7 +16,11 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
@@ -49,6 +53,12 @@ enum class WriteOptions
     IGNORE_EPIPE_EAGAIN
 };
 
+struct FileStatus
+{
+    const off_t size;
+    const struct timespec modificationTime;
+};
+
 const Pipe
 MakePipe(const PipeOptions option = PipeOptions::NONE);
 
@@ -58,6 +68,9 @@ Read(int fd, void *buf, size_t count);
 ssize_t
 Write(int fd, const void *buf, size_t count, WriteOptions options = WriteOptions::NONE);
 
+ssize_t
+WriteVector(int fd, const struct iovec *iov, int iovcnt);
+
 void
 Close(int fd);
 
@@ -67,6 +80,9 @@ Fork();
 int
 WaitPid(pid_t pid, int *wstatus, int options);
 
+int
+Wait4(pid_t pid, int *wstatus, int options, struct rusage *rusage);
+
 void
 DuplicateFd(int oldFd, int newFd);
 
@@ -79,6 +95,9 @@ Terminate(const int status);
 void
 SigAction(int signum, const struct sigaction *act, struct sigaction *oldact);
 
+void
+ThreadSignalMask(int how, const sigset_t *set, sigset_t *oldset);
+
 #ifdef HAVE_SIGHANDLER_T
 using signal_handler = sighandler_t;
 #else
@@ -97,4 +116,55 @@ Fcntl(int fd, int cmd, int arg);
 void
 Kill(pid_t pid, int sig);
 
+int
+Open(const std::string &path, int flags, mode_t mode = 0);
+
+const FileStatus
+Stat(const std::string &path);
+
+const FileStatus
+FileStat(int fd);
+
+void *
+Mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset);
+
+void
+Munmap(void *addr, size_t length);
+
+void
+Rename(const std::string &oldPath, const std::string &newPath);
+
+int
+OpenAt(int dirFd, const std::string &path, int flags, mode_t mode = 0);
+
+int
+MakeTemporaryFile(std::string &pathTemplate);
+
+void
+Unlink(const std::string &path);
+
+void
+FileTruncate(int fd, off_t length);
+
+off_t
+Seek(int fd, off_t offset, int whence);
+
+ssize_t
+PositionalRead(int fd, void *buf, size_t count, off_t offset);
+
+#ifdef HAVE_MEMFD_CREATE
+int
+MemfdCreate(const std::string &name, unsigned int flags);
+#endif
+
+#ifdef HAVE_COPY_FILE_RANGE
+ssize_t
+CopyFileRange(int inFd, off_t *inOffset, int outFd, size_t count);
+#endif
+
+#ifdef HAVE_SYS_SENDFILE_H
+ssize_t
+SendFile(int outFd, int inFd, off_t *offset, size_t count);
+#endif
+
 }  // omtt::system::unix
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/OutputDispatcher.hpp"
+
+#include <algorithm>
+#include <utility>
+
+
+namespace omtt
+{
+
+OutputDispatcher::OutputDispatcher(const TestData &testData,
+                                   const expectation::PreparationContext &context)
+    :
+    fIsOutputKept(false)
+{
+    if (!testData.normalization.empty()) {
+        fFilters.emplace(testData.normalization);
+    }
+
+    std::vector<std::string_view> partialOutputs;
+
+    for (const auto &expectation : testData.expectations) {
+        auto *partialOutputExpectation = dynamic_cast<expectation::PartialOutputExpectation*>(expectation.get());
+
+        if (partialOutputExpectation != nullptr
+            && partialOutputExpectation->GetStream() == expectation::Stream::OUTPUT) {
+            partialOutputExpectation->UseExternalSearch();
+            fPartialOutputExpectations.push_back(partialOutputExpectation);
+            partialOutputs.push_back(partialOutputExpectation->GetContent());
+        }
+
+        expectation->Prepare(context);
+
+        auto *streamingExpectation = dynamic_cast<expectation::StreamingExpectation*>(expectation.get());
+
+        if (streamingExpectation != nullptr) {
+            fStreamingExpectations.push_back(streamingExpectation);
+        }
+
+        if (expectation->NeedsWholeOutput()) {
+            fIsOutputKept = true;
+        }
+    }
+
+    if (!partialOutputs.empty()) {
+        fPartialOutputMatcher.emplace(partialOutputs);
+        _MarkFoundPartialOutputs();
+    }
+}
+
+void
+OutputDispatcher::OnOutput(const std::string_view &chunk)
+{
+    if (!_NeedsOutput()) {
+        return;
+    }
+
+    const std::string_view normalized = fNormalizer.Normalize(chunk);
+
+    if (!fFilters) {
+        _Dispatch(normalized);
+        return;
+    }
+
+    // the buffer keeps its capacity, so the chunks are filtered without allocations
+    fFilteredChunk.assign(normalized);
+    fFilters->Apply(fFilteredChunk, [this](const std::string_view &piece) {
+        _Dispatch(piece);
+    });
+}
+
+std::string
+OutputDispatcher::TakeOutput()
+{
+    return std::move(fOutput);
+}
+
+void
+OutputDispatcher::_Dispatch(const std::string_view &normalized)
+{
+    if (fIsOutputKept) {
+        fOutput.append(normalized);
+    }
+
+    for (auto *expectation : fStreamingExpectations) {
+        expectation->Consume(normalized);
+    }
+
+    fStreamingExpectations.erase(std::remove_if(fStreamingExpectations.begin(),
+                                                fStreamingExpectations.end(),
+                                                [](const auto *expectation) {
+                                                    return !expectation->NeedsMoreOutput();
+                                                }),
+                                 fStreamingExpectations.end());
+
+    if (fPartialOutputMatcher && fPartialOutputMatcher->Feed(normalized)) {
+        _MarkFoundPartialOutputs();
+    }
+}
+
+bool
+OutputDispatcher::_NeedsOutput() const
+{
+    return fIsOutputKept
+           || !fStreamingExpectations.empty()
+           || (fPartialOutputMatcher && !fPartialOutputMatcher->AreAllFound());
+}
+
+void
+OutputDispatcher::_MarkFoundPartialOutputs()
+{
+    for (std::size_t i = 0; i < fPartialOutputExpectations.size(); ++i) {
+        if (fPartialOutputMatcher->IsFound(i)) {
+            fPartialOutputExpectations[i]->MarkFound();
+        }
+    }
+}
+
+}  // omtt
@@ -9,10 +9,12 @@
 #include "headers/RunProcess.hpp"
 #include "headers/system/Unix.hpp"
 #include "headers/exception/SutExecutionException.hpp"
+#include "headers/exception/InputFileException.hpp"
 #include "headers/exception/SignalReceivedException.hpp"
 #include "headers/ErrorCodes.hpp"
 
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <iostream>
 #include <limits>
@@ -61,6 +63,69 @@ WriteAllDataToFd(const int fd, const std::string_view &buf)
     }
 }
 
+std::optional<int>
+OpenInputFile(const std::optional<std::string> &inputFilePath)
+{
+    if (!inputFilePath.has_value()) {
+        return std::nullopt;
+    }
+
+    try {
+        return system::unix::Open(*inputFilePath, O_RDONLY | O_CLOEXEC);
+    }
+    catch (const std::exception &ex) {
+        throw exception::InputFileException(*inputFilePath, ex.what());
+    }
+}
+
+// the input file is closed also when the SUT doesn't start
+class InputFile
+{
+public:
+    explicit InputFile(const std::optional<std::string> &inputFilePath)
+        :
+        fFd(OpenInputFile(inputFilePath))
+    {
+    }
+
+    InputFile(const InputFile &) = delete;
+    InputFile &operator=(const InputFile &) = delete;
+
+    ~InputFile()
+    {
+        try {
+            Close();
+        }
+        catch (const std::exception &) {
+        }
+    }
+
+    bool
+    IsOpen() const
+    {
+        return fFd.has_value();
+    }
+
+    int
+    GetFd() const
+    {
+        return *fFd;
+    }
+
+    void
+    Close()
+    {
+        if (fFd.has_value()) {
+            const int fd = *fFd;
+            fFd.reset();
+            system::unix::Close(fd);
+        }
+    }
+
+private:
+    std::optional<int> fFd;
+};
+
 void
 SetSignalHandling(const int signum)
 {
@@ -94,6 +159,25 @@ ExitCode(const int wstatus)
     }
 }
 
+std::chrono::microseconds
+ToDuration(const struct timeval &time)
+{
+    return std::chrono::seconds(time.tv_sec) + std::chrono::microseconds(time.tv_usec);
+}
+
+ResourceUsage
+ToResourceUsage(const struct rusage &usage, const std::chrono::nanoseconds wallTime)
+{
+    return {wallTime,
+            ToDuration(usage.ru_utime),
+            ToDuration(usage.ru_stime),
+            usage.ru_maxrss,
+            usage.ru_minflt,
+            usage.ru_majflt,
+            usage.ru_nvcsw,
+            usage.ru_nivcsw};
+}
+
 bool
 IsAbleToRead(const struct pollfd &pfd)
 {
@@ -133,8 +217,13 @@ RunProcessSignalHandler(const int signum, siginfo_t *info, void *ucontext)
 ProcessResults
 RunProcess(const std::string &path,
            const std::vector<std::string> &options,
-           const std::string_view &input)
+           const std::string_view &inputText,
+           const std::optional<std::string> &inputFilePath,
+           OutputObserver *outputObserver)
 {
+    InputFile inputFile(inputFilePath);
+    const std::string_view input = inputFile.IsOpen() ? std::string_view() : inputText;
+
     signalReceived = 0;
     const int signals[] = {SIGHUP, SIGINT, SIGTERM, SIGUSR1, SIGUSR2};
     for (auto sig : signals) {
@@ -149,9 +238,12 @@ RunProcess(const std::string &path,
     const auto toParentInternalErrorsPipe = system::unix::MakePipe(system::unix::PipeOptions::CLOSE_ON_EXEC);
     const auto toParentErrorsPipe = system::unix::MakePipe();
 
+    const auto startTime = std::chrono::steady_clock::now();
     const auto childrenPid = system::unix::Fork();
 
     if (IsParentProcess(childrenPid)) {
+        inputFile.Close();
+
         system::unix::Close(toParentPipe.writeEnd);
         system::unix::Close(toChildPipe.readEnd);
         system::unix::Close(toParentInternalErrorsPipe.writeEnd);
@@ -170,6 +262,7 @@ RunProcess(const std::string &path,
         std::string internalErrors;
         DataBuffer buf;
         int processExitStatus;
+        struct rusage usage{};
         bool isProcessRunning = true;
         bool isToChildPipeWriteEndClosed = false;
         bool systemBuffersMayStillHaveData = false;
@@ -183,7 +276,12 @@ RunProcess(const std::string &path,
             if (IsAbleToRead(fds[0])) {
                 const int readBytes = ReadToBuffer(fds[0].fd, buf);
                 if (readBytes > 0) {
-                    results.output += buf.data();
+                    if (outputObserver != nullptr) {
+                        outputObserver->OnOutput(std::string_view(buf.data(), readBytes));
+                    }
+                    else {
+                        results.output += buf.data();
+                    }
                     systemBuffersMayStillHaveData = true;
                 }
             }
@@ -214,8 +312,12 @@ RunProcess(const std::string &path,
             }
 
             if (isProcessRunning) {
-                const int pidOfProcessWithChangedStatus = system::unix::WaitPid(childrenPid, &processExitStatus, WNOHANG);
+                const int pidOfProcessWithChangedStatus = system::unix::Wait4(childrenPid, &processExitStatus, WNOHANG, &usage);
                 isProcessRunning = (pidOfProcessWithChangedStatus == 0);
+
+                if (!isProcessRunning) {
+                    results.resources = ToResourceUsage(usage, std::chrono::steady_clock::now() - startTime);
+                }
                 systemBuffersMayStillHaveData = true;
             }
         } while ((isProcessRunning || systemBuffersMayStillHaveData)
@@ -247,7 +349,13 @@ RunProcess(const std::string &path,
             system::unix::Close(toParentInternalErrorsPipe.readEnd);
             system::unix::Close(toParentErrorsPipe.readEnd);
 
-            RedirectPipe(toChildPipe.readEnd, static_cast<int>(system::unix::FdId::STDIN));
+            if (inputFile.IsOpen()) {
+                system::unix::Close(toChildPipe.readEnd);
+                RedirectPipe(inputFile.GetFd(), static_cast<int>(system::unix::FdId::STDIN));
+            }
+            else {
+                RedirectPipe(toChildPipe.readEnd, static_cast<int>(system::unix::FdId::STDIN));
+            }
             RedirectPipe(toParentPipe.writeEnd, static_cast<int>(system::unix::FdId::STDOUT));
             RedirectPipe(toParentErrorsPipe.writeEnd, static_cast<int>(system::unix::FdId::STDERR));
 
@@ -12,14 +12,47 @@
 namespace omtt
 {
 
+namespace
+{
+
+bool
+are_satisfied(const TestData &testData,
+              const ProcessResults &processResults,
+              const expectation::Expectation::Cost cost)
+{
+    for (const auto &expectation : testData.expectations) {
+        if (expectation->GetCost() == cost && !expectation->IsSatisfied(processResults)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
 TestExecutionSummary
 ValidateExpectationsAndSutResults(const TestData &testData,
-                                  const ProcessResults &processResults)
+                                  const ProcessResults &processResults,
+                                  const ValidationMode mode)
 {
     TestExecutionSummary summary;
+
+    if (mode == ValidationMode::VERDICT_ONLY) {
+        const bool isPassed = are_satisfied(testData, processResults, expectation::Expectation::Cost::CHEAP)
+                              && are_satisfied(testData, processResults, expectation::Expectation::Cost::EXPENSIVE);
+
+        summary.verdict = isPassed ? Verdict::PASS : Verdict::FAIL;
+        return summary;
+    }
+
     summary.verdict = Verdict::PASS;
 
     for (const auto &expectation : testData.expectations) {
+        if (expectation->IsSatisfied(processResults)) {
+            continue;
+        }
+
         auto validationResult = expectation->Validate(processResults);
 
         if (!validationResult.isSatisfied()) {
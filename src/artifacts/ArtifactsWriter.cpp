@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/artifacts/ArtifactsWriter.hpp"
+#include "headers/exception/FileWriteException.hpp"
+#include "headers/system/Unix.hpp"
+#include "headers/system/exception/SystemException.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+
+
+namespace omtt::artifacts
+{
+
+namespace
+{
+
+constexpr mode_t ARTIFACT_MODE = 0644;
+
+void
+write_all(const int fd, const std::string_view &text)
+{
+    std::size_t written = 0;
+    while (written < text.size()) {
+        written += system::unix::Write(fd, text.data() + written, text.size() - written);
+    }
+}
+
+bool
+is_kernel_copy_unsupported(const system::unix::exception::SystemException &ex)
+{
+    const int error = ex.code().value();
+    return error == EXDEV || error == EINVAL || error == ENOSYS || error == EOPNOTSUPP;
+}
+
+// copies the file from the offset to the current output file position
+void
+copy_file(const int inFd, const int outFd, off_t offset, const off_t size)
+{
+#ifdef HAVE_COPY_FILE_RANGE
+    try {
+        while (offset < size) {
+            if (system::unix::CopyFileRange(inFd, &offset, outFd, size - offset) == 0) {
+                return;
+            }
+        }
+        return;
+    }
+    catch (const system::unix::exception::SystemException &ex) {
+        // e.g. from the memfd to other file system, sendfile handles it
+        if (!is_kernel_copy_unsupported(ex)) {
+            throw;
+        }
+    }
+#endif
+
+#ifdef HAVE_SYS_SENDFILE_H
+    try {
+        while (offset < size) {
+            if (system::unix::SendFile(outFd, inFd, &offset, size - offset) == 0) {
+                return;
+            }
+        }
+        return;
+    }
+    catch (const system::unix::exception::SystemException &ex) {
+        if (!is_kernel_copy_unsupported(ex)) {
+            throw;
+        }
+    }
+#endif
+
+    std::array<char, 64 * 1024> buffer;
+    while (offset < size) {
+        const auto count = std::min<off_t>(buffer.size(), size - offset);
+        const ssize_t bytes = system::unix::PositionalRead(inFd, buffer.data(), count, offset);
+        if (bytes == 0) {
+            return;
+        }
+
+        write_all(outFd, std::string_view(buffer.data(), bytes));
+        offset += bytes;
+    }
+}
+
+// closes the file also when the writing fails
+template<class WriteFunction>
+void
+write_file(const int fd, const WriteFunction &write)
+{
+    try {
+        write(fd);
+    }
+    catch (...) {
+        close(fd);
+        throw;
+    }
+
+    system::unix::Close(fd);
+}
+
+}
+
+std::string
+artifact_name(const Path &testName)
+{
+    std::string name;
+    name.reserve(testName.size());
+
+    for (const char c : testName) {
+        if (c == '%') {
+            name += "%25";
+        }
+        else if (c == '/') {
+            name += "%2F";
+        }
+        else {
+            name += c;
+        }
+    }
+
+    return name;
+}
+
+ArtifactsWriter::ArtifactsWriter(const Path &directoryPath)
+    :
+    fDirectoryPath(directoryPath),
+    fDirectoryFd(-1),
+    fSpillFd(-1),
+    fSpillSize(0),
+    fObserver(nullptr)
+{
+    try {
+        fDirectoryFd = system::unix::Open(fDirectoryPath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    }
+    catch (const std::exception &ex) {
+        throw exception::FileWriteException("failed to open artifacts directory: " + fDirectoryPath + ": " + ex.what());
+    }
+
+    try {
+        fSpillFd = _CreateSpillFile();
+    }
+    catch (...) {
+        system::unix::Close(fDirectoryFd);
+        throw;
+    }
+}
+
+ArtifactsWriter::~ArtifactsWriter()
+{
+    close(fSpillFd);
+    close(fDirectoryFd);
+}
+
+OutputObserver &
+ArtifactsWriter::Record(OutputObserver &observer)
+{
+    fOutput.clear();
+
+    if (fSpillSize > 0) {
+        system::unix::FileTruncate(fSpillFd, 0);
+        system::unix::Seek(fSpillFd, 0, SEEK_SET);
+        fSpillSize = 0;
+    }
+
+    fObserver = &observer;
+    return *this;
+}
+
+void
+ArtifactsWriter::OnOutput(const std::string_view &chunk)
+{
+    if (fSpillSize == 0 && fOutput.size() + chunk.size() <= MEMORY_OUTPUT_SIZE) {
+        fOutput.append(chunk);
+    }
+    else {
+        // the copies use the offsets, they don't move the file position
+        if (!fOutput.empty()) {
+            write_all(fSpillFd, fOutput);
+            fSpillSize += fOutput.size();
+            fOutput.clear();
+        }
+
+        write_all(fSpillFd, chunk);
+        fSpillSize += chunk.size();
+    }
+
+    fObserver->OnOutput(chunk);
+}
+
+void
+ArtifactsWriter::Save(const Path &testName,
+                      const std::string_view &errors,
+                      const std::string_view &input,
+                      const std::optional<Path> &inputFilePath)
+{
+    write_file(_CreateArtifact(testName, ".stdout"),
+               [&](const int fd) {
+                   if (fSpillSize > 0) {
+                       copy_file(fSpillFd, fd, 0, fSpillSize);
+                   }
+                   else {
+                       write_all(fd, fOutput);
+                   }
+               });
+
+    write_file(_CreateArtifact(testName, ".stderr"),
+               [&](const int fd) { write_all(fd, errors); });
+
+    write_file(_CreateArtifact(testName, ".input"),
+               [&](const int fd) {
+                   if (!inputFilePath.has_value()) {
+                       write_all(fd, input);
+                       return;
+                   }
+
+                   const int inputFileFd = system::unix::Open(*inputFilePath, O_RDONLY | O_CLOEXEC);
+                   write_file(inputFileFd,
+                              [&](const int) { copy_file(inputFileFd, fd, 0, system::unix::FileStat(inputFileFd).size); });
+               });
+}
+
+int
+ArtifactsWriter::_CreateSpillFile()
+{
+#ifdef HAVE_MEMFD_CREATE
+    try {
+        return system::unix::MemfdCreate("omtt-output", MFD_CLOEXEC);
+    }
+    catch (const system::unix::exception::SystemException &ex) {
+        if (ex.code().value() != ENOSYS) {
+            throw;
+        }
+    }
+#endif
+
+    // unlinked file in the artifacts directory, removed when it's closed
+    std::string path = fDirectoryPath + "/.omtt-output-XXXXXX";
+    const int fd = system::unix::MakeTemporaryFile(path);
+    system::unix::Unlink(path);
+    system::unix::Fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return fd;
+}
+
+int
+ArtifactsWriter::_CreateArtifact(const Path &testName, const char *suffix)
+{
+    return system::unix::OpenAt(fDirectoryFd,
+                                artifact_name(testName) + suffix,
+                                O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                                ARTIFACT_MODE);
+}
+
+}  // omtt::artifacts
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/cache/TestCache.hpp"
+#include "headers/cache/RecordingLexer.hpp"
+#include "headers/cache/TokenReplay.hpp"
+#include "headers/cache/detail/Hash.hpp"
+#include "headers/exception/FileWriteException.hpp"
+#include "headers/lexer/Lexer.hpp"
+#include "headers/parser/Parser.hpp"
+#include "headers/system/Unix.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+
+namespace omtt::cache
+{
+
+namespace
+{
+
+bool
+is_known_token_kind(const std::uint32_t kind)
+{
+    return kind <= static_cast<std::uint32_t>(lexer::TokenKind::COMMENT);
+}
+
+bool
+are_tokens_in_buffer(const detail::TokenRecord *begin,
+                     const detail::TokenRecord *end,
+                     const std::string &buffer)
+{
+    return std::all_of(begin, end,
+                       [&](const detail::TokenRecord &record) {
+                           return is_known_token_kind(record.kind)
+                                  && record.offset <= buffer.size()
+                                  && record.length <= buffer.size() - record.offset;
+                       });
+}
+
+detail::Entry
+current_entry(const Path &testFilePath)
+{
+    const auto status = system::unix::Stat(testFilePath);
+
+    detail::Entry entry{};
+    entry.pathHash = detail::hash(testFilePath);
+    entry.pathLength = testFilePath.length();
+    entry.fileSize = status.size;
+    entry.modificationTimeSec = status.modificationTime.tv_sec;
+    entry.modificationTimeNsec = status.modificationTime.tv_nsec;
+    return entry;
+}
+
+template<class T>
+void
+write_items(std::ofstream &file, const T *items, const std::uint64_t count)
+{
+    file.write(reinterpret_cast<const char *>(items), count * sizeof(T));
+}
+
+}
+
+TestCache::TestCache(const Path &cacheFilePath)
+    :
+    fCacheFilePath(cacheFilePath),
+    fMapping(nullptr),
+    fMappingSize(0),
+    fHeader(nullptr),
+    fEntries(nullptr),
+    fTokens(nullptr),
+    fStrings(nullptr)
+{
+    try {
+        _Map();
+    }
+    catch (const std::exception &) {
+        // missing or unreadable cache is the same as an empty one
+    }
+
+    if (fMapping != nullptr && !_IsMappingValid()) {
+        system::unix::Munmap(fMapping, fMappingSize);
+        fMapping = nullptr;
+        fHeader = nullptr;
+    }
+}
+
+TestCache::~TestCache()
+{
+    if (fMapping != nullptr) {
+        system::unix::Munmap(fMapping, fMappingSize);
+    }
+}
+
+std::vector<TestData>
+TestCache::Parse(const Path &testFilePath, const std::string &testFileBuffer)
+{
+    detail::Entry current = current_entry(testFilePath);
+    const detail::Entry *entry = _FindEntry(testFilePath, current.pathHash);
+
+    // the buffer size is checked too, the file could be changed after it was read
+    if (entry != nullptr
+        && _IsEntryUpToDate(*entry, current)
+        && entry->fileSize == testFileBuffer.size()
+        && are_tokens_in_buffer(fTokens + entry->firstToken,
+                                fTokens + entry->firstToken + entry->tokensCount,
+                                testFileBuffer)) {
+        TokenReplay replay(testFileBuffer,
+                           fTokens + entry->firstToken,
+                           fTokens + entry->firstToken + entry->tokensCount);
+        parser::Parser<TokenReplay> parser(replay);
+
+        return parser.parseAll();
+    }
+
+    lexer::Lexer lexer(testFileBuffer);
+    RecordingLexer<lexer::Lexer> recordingLexer(lexer, testFileBuffer);
+    parser::Parser<RecordingLexer<lexer::Lexer>> parser(recordingLexer);
+
+    std::vector<TestData> tests = parser.parseAll();
+
+    current.testsCount = tests.size();
+    fUpdatedEntries[testFilePath] = {current, std::move(recordingLexer.GetRecords())};
+
+    return tests;
+}
+
+std::optional<std::size_t>
+TestCache::FindTestsCount(const Path &testFilePath) const
+{
+    detail::Entry current;
+    try {
+        current = current_entry(testFilePath);
+    }
+    catch (const std::exception &) {
+        // the missing file is reported when it is read
+        return std::nullopt;
+    }
+
+    const detail::Entry *entry = _FindEntry(testFilePath, current.pathHash);
+
+    if (entry == nullptr || !_IsEntryUpToDate(*entry, current)) {
+        return std::nullopt;
+    }
+
+    return entry->testsCount;
+}
+
+void
+TestCache::Save()
+{
+    if (fUpdatedEntries.empty()) {
+        return;
+    }
+
+    std::vector<detail::Entry> entries;
+    std::vector<detail::TokenRecord> tokens;
+    std::string strings;
+
+    const auto append = [&](detail::Entry entry,
+                            const std::string_view &path,
+                            const detail::TokenRecord *begin,
+                            const detail::TokenRecord *end) {
+        entry.pathOffset = strings.size();
+        entry.pathLength = path.size();
+        entry.firstToken = tokens.size();
+        entry.tokensCount = end - begin;
+        strings.append(path);
+        tokens.insert(tokens.end(), begin, end);
+        entries.push_back(entry);
+    };
+
+    if (fHeader != nullptr) {
+        for (std::uint32_t i = 0; i < fHeader->entriesCount; ++i) {
+            const detail::Entry &entry = fEntries[i];
+            const std::string_view path = _EntryPath(entry);
+
+            if (fUpdatedEntries.count(std::string(path)) == 0) {
+                append(entry, path,
+                       fTokens + entry.firstToken,
+                       fTokens + entry.firstToken + entry.tokensCount);
+            }
+        }
+    }
+
+    for (const auto &[path, updated] : fUpdatedEntries) {
+        append(updated.entry, path,
+               updated.tokens.data(),
+               updated.tokens.data() + updated.tokens.size());
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const detail::Entry &a, const detail::Entry &b) {
+                  return a.pathHash < b.pathHash;
+              });
+
+    strings.resize((strings.size() + 7) & ~std::string::size_type(7), '\0');
+
+    detail::Header header{};
+    std::memcpy(header.magic, detail::MAGIC, sizeof(header.magic));
+    header.version = detail::FORMAT_VERSION;
+    header.entriesCount = entries.size();
+    header.tokensCount = tokens.size();
+    header.stringsSize = strings.size();
+
+    const Path temporaryPath = fCacheFilePath + ".tmp";
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!file.good()) {
+        throw exception::FileWriteException("failed to open file: " + temporaryPath);
+    }
+
+    write_items(file, &header, 1);
+    write_items(file, entries.data(), entries.size());
+    write_items(file, tokens.data(), tokens.size());
+    file.write(strings.data(), strings.size());
+    file.close();
+
+    if (!file.good()) {
+        throw exception::FileWriteException("failed to write file: " + temporaryPath);
+    }
+
+    system::unix::Rename(temporaryPath, fCacheFilePath);
+}
+
+void
+TestCache::_Map()
+{
+    const int fd = system::unix::Open(fCacheFilePath, O_RDONLY | O_CLOEXEC);
+
+    try {
+        const auto status = system::unix::FileStat(fd);
+
+        if (status.size >= static_cast<off_t>(sizeof(detail::Header))) {
+            fMappingSize = status.size;
+            fMapping = system::unix::Mmap(nullptr, fMappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+    }
+    catch (...) {
+        system::unix::Close(fd);
+        throw;
+    }
+
+    system::unix::Close(fd);
+}
+
+bool
+TestCache::_IsMappingValid()
+{
+    const char * const begin = static_cast<const char *>(fMapping);
+    fHeader = reinterpret_cast<const detail::Header *>(begin);
+
+    if (std::memcmp(fHeader->magic, detail::MAGIC, sizeof(detail::MAGIC)) != 0
+        || fHeader->version != detail::FORMAT_VERSION) {
+        return false;
+    }
+
+    const std::uint64_t entriesSize = fHeader->entriesCount * sizeof(detail::Entry);
+    const std::uint64_t tokensSize = fHeader->tokensCount * sizeof(detail::TokenRecord);
+    const std::uint64_t available = fMappingSize - sizeof(detail::Header);
+
+    if (fHeader->tokensCount > available / sizeof(detail::TokenRecord)
+        || fHeader->stringsSize > available
+        || entriesSize + tokensSize + fHeader->stringsSize != available) {
+        return false;
+    }
+
+    fEntries = reinterpret_cast<const detail::Entry *>(begin + sizeof(detail::Header));
+    fTokens = reinterpret_cast<const detail::TokenRecord *>(begin + sizeof(detail::Header) + entriesSize);
+    fStrings = begin + sizeof(detail::Header) + entriesSize + tokensSize;
+
+    return std::all_of(fEntries, fEntries + fHeader->entriesCount,
+                       [&](const detail::Entry &entry) {
+                           return entry.pathOffset <= fHeader->stringsSize
+                                  && entry.pathLength <= fHeader->stringsSize - entry.pathOffset
+                                  && entry.firstToken <= fHeader->tokensCount
+                                  && entry.tokensCount <= fHeader->tokensCount - entry.firstToken;
+                       });
+}
+
+const detail::Entry *
+TestCache::_FindEntry(const Path &testFilePath, const std::uint64_t pathHash) const
+{
+    if (fHeader == nullptr) {
+        return nullptr;
+    }
+
+    const detail::Entry * const end = fEntries + fHeader->entriesCount;
+    const detail::Entry *entry = std::lower_bound(fEntries, end, pathHash,
+                                                  [](const detail::Entry &e, const std::uint64_t h) {
+                                                      return e.pathHash < h;
+                                                  });
+
+    for (; entry != end && entry->pathHash == pathHash; ++entry) {
+        if (_EntryPath(*entry) == testFilePath) {
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+bool
+TestCache::_IsEntryUpToDate(const detail::Entry &entry, const detail::Entry &current)
+{
+    return entry.fileSize == current.fileSize
+           && entry.modificationTimeSec == current.modificationTimeSec
+           && entry.modificationTimeNsec == current.modificationTimeNsec;
+}
+
+std::string_view
+TestCache::_EntryPath(const detail::Entry &entry) const
+{
+    return std::string_view(fStrings + entry.pathOffset, entry.pathLength);
+}
+
+}  // omtt::cache
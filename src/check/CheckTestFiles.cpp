@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/check/CheckTestFiles.hpp"
+#include "headers/ReadFile.hpp"
+#include "headers/lexer/Lexer.hpp"
+#include "headers/lexer/exception/UnexpectedCharacterException.hpp"
+#include "headers/parser/Parser.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+
+namespace omtt::check
+{
+
+namespace
+{
+
+/*
+ * Remembers where the last token begins, parser exceptions refer to it.
+ */
+class PositionTrackingLexer
+{
+public:
+    PositionTrackingLexer(lexer::Lexer &lexer, const std::string &inputBuffer)
+        :
+        fLexer(lexer),
+        fInputBuffer(inputBuffer),
+        fPosition(0)
+    {
+    }
+
+    std::optional<const lexer::Token>
+    FindNextToken()
+    {
+        auto token = fLexer.FindNextToken();
+
+        if (token.has_value()) {
+            fPosition = token->value.data() - fInputBuffer.data();
+        }
+        else {
+            fPosition = fInputBuffer.size();
+        }
+
+        return token;
+    }
+
+    std::string::size_type
+    GetPosition() const
+    {
+        return fPosition;
+    }
+
+private:
+    lexer::Lexer &fLexer;
+    const std::string &fInputBuffer;
+    std::string::size_type fPosition;
+};
+
+struct FileResult
+{
+    TestPaths::size_type testsCount = 0;
+    std::optional<CheckError> error;
+};
+
+FileResult
+check_test_file(const Path &testFilePath)
+{
+    FileResult result;
+    std::string buffer;
+
+    try {
+        buffer = readFile(testFilePath);
+    }
+    catch (std::exception &ex) {
+        result.error = CheckError{testFilePath, std::nullopt, ex.what()};
+        return result;
+    }
+
+    lexer::Lexer lexer(buffer);
+    PositionTrackingLexer trackingLexer(lexer, buffer);
+    parser::Parser<PositionTrackingLexer> parser(trackingLexer);
+
+    try {
+        result.testsCount = parser.parseAll().size();
+    }
+    catch (lexer::exception::UnexpectedCharacterException &ex) {
+        result.error = CheckError{testFilePath, ex.GetPosition(), ex.what()};
+    }
+    catch (std::exception &ex) {
+        result.error = CheckError{testFilePath, trackingLexer.GetPosition(), ex.what()};
+    }
+
+    return result;
+}
+
+}
+
+
+CheckSummary
+CheckTestFiles(const TestPaths &testFiles, unsigned threadsCount)
+{
+    std::vector<FileResult> results(testFiles.size());
+    std::atomic<TestPaths::size_type> nextFile(0);
+
+    const auto worker = [&]() {
+        for (auto i = nextFile++; i < testFiles.size(); i = nextFile++) {
+            results[i] = check_test_file(testFiles[i]);
+        }
+    };
+
+    threadsCount = std::clamp<TestPaths::size_type>(threadsCount, 1, std::max<TestPaths::size_type>(testFiles.size(), 1));
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount - 1);
+    for (unsigned i = 1; i < threadsCount; ++i) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    CheckSummary summary{0, {}};
+    for (auto &result : results) {
+        summary.testsCount += result.testsCount;
+
+        if (result.error.has_value()) {
+            summary.errors.push_back(std::move(*result.error));
+        }
+    }
+
+    return summary;
+}
+
+}  // omtt::check
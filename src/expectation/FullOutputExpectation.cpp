@@ -7,11 +7,13 @@
  */
 
 #include "headers/expectation/FullOutputExpectation.hpp"
+#include "headers/expectation/detail/FirstDifference.hpp"
+#include "headers/expectation/detail/LineDiff.hpp"
 #include "headers/expectation/validation/FullOutputCause.hpp"
+#include "headers/expectation/validation/OutputDiffCause.hpp"
 
-#include <algorithm>
 #include <string>
-#include <string_view>
+#include <utility>
 
 
 namespace omtt::expectation
@@ -20,29 +22,48 @@ namespace omtt::expectation
 namespace
 {
 
-std::string::size_type
-find_first_difference_position(const std::string_view &expectedOutput, const std::string &output)
-{
-    auto diff = std::mismatch(output.begin(), output.end(), expectedOutput.begin());
-    return std::distance(output.begin(), diff.first);
+// bounds the time and memory of the line differences search
+constexpr std::size_t MAX_LINE_DIFF_EDIT_DISTANCE = 1000;
+
 }
 
+void
+FullOutputExpectation::Prepare(const PreparationContext &context)
+{
+    // the cause will contain line differences, when the outputs are not too different
+    fIsLineDiffShown = context.isLineDiffShown;
 }
 
 validation::ValidationResult
 FullOutputExpectation::Validate(const ProcessResults &processResults)
 {
-    if (fExpectedOutput == processResults.output) {
+    const std::string &output = streamText(processResults, fStream);
+
+    const auto difference = detail::find_first_difference(fExpectedOutput, output);
+    if (!difference) {
         return {std::nullopt};
     }
-    else {
-        const auto differencePosition = find_first_difference_position(fExpectedOutput,
-                                                                       processResults.output);
 
-        return {expectation::validation::FullOutputCause{differencePosition,
-                                                         fExpectedOutput,
-                                                         processResults.output}};
+    if (fIsLineDiffShown) {
+        auto hunks = detail::diff_lines(fExpectedOutput, output, MAX_LINE_DIFF_EDIT_DISTANCE);
+
+        if (hunks.has_value()) {
+            return {expectation::validation::OutputDiffCause{std::move(*hunks), fStream}};
+        }
     }
+
+    return {expectation::validation::FullOutputCause{difference->position,
+                                                     difference->line,
+                                                     difference->column,
+                                                     fExpectedOutput,
+                                                     output,
+                                                     fStream}};
+}
+
+bool
+FullOutputExpectation::IsSatisfied(const ProcessResults &processResults)
+{
+    return streamText(processResults, fStream) == fExpectedOutput;
 }
 
 }  // omtt::expectation
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/InOutputInOrderExpectation.hpp"
+#include "headers/expectation/validation/InOutputInOrderCause.hpp"
+
+#include <cstring>
+
+
+namespace omtt::expectation
+{
+
+namespace
+{
+
+std::vector<std::uint32_t>
+prefix_function(const std::string_view &text)
+{
+    std::vector<std::uint32_t> prefix(text.size(), 0);
+
+    for (std::string_view::size_type i = 1; i < text.size(); ++i) {
+        std::uint32_t matched = prefix[i - 1];
+        while (matched > 0 && text[i] != text[matched]) {
+            matched = prefix[matched - 1];
+        }
+        if (text[i] == text[matched]) {
+            ++matched;
+        }
+        prefix[i] = matched;
+    }
+
+    return prefix;
+}
+
+}
+
+InOutputInOrderExpectation::InOutputInOrderExpectation(const std::string_view &expectedTexts)
+    :
+    fExpectedTexts(expectedTexts),
+    fCurrentText(0),
+    fMatched(0),
+    fPosition(0),
+    fSearchStart(0)
+{
+    std::string_view::size_type lineBegin = 0;
+
+    while (lineBegin < expectedTexts.size()) {
+        auto lineEnd = expectedTexts.find('\n', lineBegin);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = expectedTexts.size();
+        }
+
+        // empty lines are found everywhere
+        if (lineEnd > lineBegin) {
+            fTexts.push_back(expectedTexts.substr(lineBegin, lineEnd - lineBegin));
+            fPrefixes.push_back(prefix_function(fTexts.back()));
+        }
+
+        lineBegin = lineEnd + 1;
+    }
+}
+
+void
+InOutputInOrderExpectation::Prepare(const PreparationContext &)
+{
+    fCurrentText = 0;
+    fMatched = 0;
+    fPosition = 0;
+    fSearchStart = 0;
+}
+
+void
+InOutputInOrderExpectation::Consume(const std::string_view &outputChunk)
+{
+    const char *current = outputChunk.data();
+    const char *const end = current + outputChunk.size();
+
+    while (current != end && fCurrentText < fTexts.size()) {
+        const std::string_view &text = fTexts[fCurrentText];
+        const auto &prefix = fPrefixes[fCurrentText];
+
+        if (fMatched == 0) {
+            // skips quickly to the first byte of the text
+            const void *found = std::memchr(current, text.front(), end - current);
+            if (found == nullptr) {
+                break;
+            }
+            current = static_cast<const char *>(found);
+        }
+
+        while (fMatched > 0 && *current != text[fMatched]) {
+            fMatched = prefix[fMatched - 1];
+        }
+        if (*current == text[fMatched]) {
+            ++fMatched;
+        }
+        ++current;
+
+        if (fMatched == text.size()) {
+            fSearchStart = fPosition + (current - outputChunk.data());
+            _NextText();
+        }
+    }
+
+    fPosition += outputChunk.size();
+}
+
+validation::ValidationResult
+InOutputInOrderExpectation::Validate(const ProcessResults &)
+{
+    if (fCurrentText == fTexts.size()) {
+        return {std::nullopt};
+    }
+
+    return {validation::InOutputInOrderCause{fTexts[fCurrentText],
+                                             fCurrentText + 1,
+                                             fTexts.size(),
+                                             fSearchStart}};
+}
+
+void
+InOutputInOrderExpectation::_NextText()
+{
+    ++fCurrentText;
+    fMatched = 0;
+}
+
+}  // omtt::expectation
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/InOutputMatchesExpectation.hpp"
+#include "headers/expectation/validation/InOutputMatchesCause.hpp"
+
+
+namespace omtt::expectation
+{
+
+InOutputMatchesExpectation::InOutputMatchesExpectation(const std::string_view &pattern)
+    :
+    fPattern(pattern)
+{
+}
+
+void
+InOutputMatchesExpectation::Prepare(const PreparationContext &context)
+{
+    fMatcher.emplace(context.patternCache.Get(fPattern, regex::Mode::SEARCH));
+}
+
+void
+InOutputMatchesExpectation::Consume(const std::string_view &outputChunk)
+{
+    fMatcher->Feed(outputChunk);
+}
+
+validation::ValidationResult
+InOutputMatchesExpectation::Validate(const ProcessResults &)
+{
+    if (fMatcher->Finish()) {
+        return {std::nullopt};
+    }
+
+    return {validation::InOutputMatchesCause{fPattern}};
+}
+
+}  // omtt::expectation
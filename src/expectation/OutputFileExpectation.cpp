@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputFileExpectation.hpp"
+#include "headers/expectation/validation/OutputFileCause.hpp"
+#include "headers/expectation/detail/FirstDifference.hpp"
+#include "headers/exception/FileReadException.hpp"
+#include "headers/system/Unix.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace omtt::expectation
+{
+
+namespace
+{
+
+// the file is filtered in chunks, like the SUT output
+constexpr size_t NORMALIZATION_CHUNK_SIZE = 64 * 1024;
+
+}
+
+OutputFileExpectation::OutputFileExpectation(const std::string_view &expectedOutputFile,
+                                             const normalize::Filters &normalization)
+    :
+    fExpectedOutputFile(expectedOutputFile),
+    fNormalization(normalization),
+    fMapping(nullptr),
+    fMappingSize(0),
+    fMappingPosition(0),
+    fExpected(nullptr),
+    fExpectedSize(0),
+    fExpectedPosition(0),
+    fOutputPosition(0),
+    fOutputLine(1),
+    fOutputLineBegin(0)
+{
+}
+
+OutputFileExpectation::~OutputFileExpectation()
+{
+    _Unmap();
+}
+
+void
+OutputFileExpectation::Prepare(const PreparationContext &context)
+{
+    _Unmap();
+
+    fMappingPosition = 0;
+    fLfNormalizer = LfNormalizer();
+    fNormalizer.reset();
+    fNormalizedContent.clear();
+    fExpected = nullptr;
+    fExpectedSize = 0;
+    fExpectedPosition = 0;
+    fOutputPosition = 0;
+    fOutputLine = 1;
+    fOutputLineBegin = 0;
+    fExpectedContext.clear();
+    fOutputContext.Reset();
+
+    const Path path = resolvePath(context.testFilePath, fExpectedOutputFile);
+
+    try {
+        const int fd = system::unix::Open(path, O_RDONLY | O_CLOEXEC);
+
+        try {
+            const auto status = system::unix::FileStat(fd);
+            if (status.size > 0) {
+                fMapping = static_cast<const char *>(system::unix::Mmap(nullptr, status.size, PROT_READ, MAP_PRIVATE, fd, 0));
+                fMappingSize = status.size;
+            }
+        }
+        catch (...) {
+            system::unix::Close(fd);
+            throw;
+        }
+
+        system::unix::Close(fd);
+    }
+    catch (const std::exception &ex) {
+        throw exception::FileReadException("failed to open expected output file '" + path + "': " + ex.what());
+    }
+
+    fExpected = fMapping;
+    fExpectedSize = fMappingSize;
+
+    if (!fNormalization.empty()) {
+        fNormalizer.emplace(fNormalization);
+        fExpected = fNormalizedContent.data();
+        fExpectedSize = 0;
+    }
+}
+
+void
+OutputFileExpectation::Consume(const std::string_view &outputChunk)
+{
+    std::string_view chunk = outputChunk;
+
+    if (fOutputContext.IsStarted()) {
+        fOutputContext.Collect(chunk);
+        return;
+    }
+
+    while (!chunk.empty()) {
+        if (fExpectedPosition == fExpectedSize) {
+            if (fNormalizer) {
+                // the compared part of the filtered file is released
+                fNormalizedContent.clear();
+                fExpectedPosition = 0;
+                fExpectedSize = 0;
+            }
+
+            if (!_NormalizeNextChunk()) {
+                _MarkDifference();
+                Consume(chunk);
+                return;
+            }
+        }
+
+        const char *expected = fExpected + fExpectedPosition;
+        const size_t length = std::min(fExpectedSize - fExpectedPosition, chunk.size());
+        const void *cr = std::memchr(expected, '\r', length);
+        const size_t plainLength = (cr != nullptr) ? static_cast<const char *>(cr) - expected : length;
+
+        if (plainLength > 0) {
+            const auto difference = detail::find_first_difference(std::string_view(expected, plainLength),
+                                                                  chunk.substr(0, plainLength));
+            const size_t matched = difference.has_value() ? difference->position : plainLength;
+
+            _Remember(chunk.substr(0, matched));
+            fExpectedPosition += matched;
+            chunk.remove_prefix(matched);
+
+            if (matched < plainLength) {
+                _MarkDifference();
+                Consume(chunk);
+                return;
+            }
+
+            continue;
+        }
+
+        // CR and CR LF in the expected output are the same as LF in the normalized output
+        if (chunk.front() != '\n') {
+            _MarkDifference();
+            Consume(chunk);
+            return;
+        }
+
+        ++fExpectedPosition;
+        if (fExpectedPosition < fExpectedSize && fExpected[fExpectedPosition] == '\n') {
+            ++fExpectedPosition;
+        }
+
+        _Remember(chunk.substr(0, 1));
+        chunk.remove_prefix(1);
+    }
+}
+
+validation::ValidationResult
+OutputFileExpectation::Validate(const ProcessResults &)
+{
+    if (!fOutputContext.IsStarted()
+        && (fExpectedPosition < fExpectedSize || _NormalizeNextChunk())) {
+        _MarkDifference();
+    }
+
+    if (!fOutputContext.IsStarted()) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputFileCause{fExpectedOutputFile,
+                                        fOutputPosition,
+                                        fOutputLine,
+                                        fOutputPosition - fOutputLineBegin + 1,
+                                        fOutputContext.GetPosition(),
+                                        fExpectedContext,
+                                        fOutputContext.GetContext()}};
+}
+
+bool
+OutputFileExpectation::IsSatisfied(const ProcessResults &)
+{
+    return !fOutputContext.IsStarted()
+           && fExpectedPosition == fExpectedSize
+           && !_NormalizeNextChunk();
+}
+
+void
+OutputFileExpectation::_Unmap()
+{
+    if (fMapping != nullptr) {
+        system::unix::Munmap(const_cast<char *>(fMapping), fMappingSize);
+        fMapping = nullptr;
+        fMappingSize = 0;
+    }
+}
+
+bool
+OutputFileExpectation::_NormalizeNextChunk()
+{
+    // without the filters the whole mapping is compared
+    if (!fNormalizer) {
+        return false;
+    }
+
+    const size_t previousSize = fNormalizedContent.size();
+
+    // a chunk of spaces may be filtered to nothing, the next one is read then
+    while (fNormalizedContent.size() == previousSize && fMappingPosition < fMappingSize) {
+        const size_t length = std::min(NORMALIZATION_CHUNK_SIZE, fMappingSize - fMappingPosition);
+
+        fFilteredChunk.assign(fLfNormalizer.Normalize(std::string_view(fMapping + fMappingPosition, length)));
+        fMappingPosition += length;
+
+        fNormalizer->Apply(fFilteredChunk, [this](const std::string_view &piece) {
+            fNormalizedContent.append(piece);
+        });
+    }
+
+    fExpected = fNormalizedContent.data();
+    fExpectedSize = fNormalizedContent.size();
+
+    return fNormalizedContent.size() > previousSize;
+}
+
+void
+OutputFileExpectation::_Remember(const std::string_view &matchedOutput)
+{
+    fOutputContext.Remember(matchedOutput);
+
+    const auto newLines = detail::count_new_lines(matchedOutput);
+    if (newLines > 0) {
+        fOutputLine += newLines;
+        fOutputLineBegin = fOutputPosition + matchedOutput.rfind('\n') + 1;
+    }
+
+    fOutputPosition += matchedOutput.size();
+}
+
+void
+OutputFileExpectation::_MarkDifference()
+{
+    fOutputContext.Start();
+    fExpectedContext = fOutputContext.GetTail();
+
+    const auto contextSize = fExpectedContext.size() + detail::OutputContext::SIZE + 1;
+    for (size_t i = fExpectedPosition; fExpectedContext.size() < contextSize; ++i) {
+        if (i == fExpectedSize && !_NormalizeNextChunk()) {
+            break;
+        }
+
+        if (fExpected[i] == '\r') {
+            fExpectedContext += '\n';
+            if (i + 1 < fExpectedSize && fExpected[i + 1] == '\n') {
+                ++i;
+            }
+        }
+        else {
+            fExpectedContext += fExpected[i];
+        }
+    }
+}
+
+}  // omtt::expectation
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputJsonExpectation.hpp"
+#include "headers/expectation/validation/OutputJsonCause.hpp"
+
+
+namespace omtt::expectation
+{
+
+OutputJsonExpectation::OutputJsonExpectation(const std::string_view &expectedOutput)
+    :
+    fExpectedOutput(expectedOutput),
+    fExpected(json::parse(expectedOutput))
+{
+}
+
+void
+OutputJsonExpectation::Prepare(const PreparationContext &)
+{
+    fParser.reset();
+    fComparison.emplace(fExpected);
+    fParser.emplace(*fComparison);
+}
+
+void
+OutputJsonExpectation::Consume(const std::string_view &outputChunk)
+{
+    // the rest of the output doesn't change the first difference
+    if (fComparison->HasDifference() || fParser->HasError()) {
+        return;
+    }
+
+    if (!fParser->Feed(outputChunk)) {
+        fComparison->SetInvalidOutput(fParser->GetError());
+    }
+}
+
+validation::ValidationResult
+OutputJsonExpectation::Validate(const ProcessResults &)
+{
+    _Finish();
+
+    const auto &difference = fComparison->GetDifference();
+    if (!difference) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputJsonCause{difference->pointer, difference->expected, difference->actual}};
+}
+
+bool
+OutputJsonExpectation::IsSatisfied(const ProcessResults &)
+{
+    _Finish();
+
+    return !fComparison->HasDifference();
+}
+
+void
+OutputJsonExpectation::_Finish()
+{
+    if (!fComparison->HasDifference() && !fParser->HasError() && !fParser->Finish()) {
+        fComparison->SetInvalidOutput(fParser->GetError());
+    }
+}
+
+}  // omtt::expectation
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputLineCountExpectation.hpp"
+#include "headers/expectation/validation/OutputLineCountCause.hpp"
+
+#include <algorithm>
+
+
+namespace omtt::expectation
+{
+
+OutputLineCountExpectation::OutputLineCountExpectation(const Comparison comparison,
+                                                       const std::uint64_t expectedLineCount)
+    :
+    fComparison(comparison),
+    fExpectedLineCount(expectedLineCount),
+    fNewLines(0),
+    fIsLastLineOpen(false)
+{
+}
+
+void
+OutputLineCountExpectation::Prepare(const PreparationContext &)
+{
+    fNewLines = 0;
+    fIsLastLineOpen = false;
+}
+
+void
+OutputLineCountExpectation::Consume(const std::string_view &outputChunk)
+{
+    if (outputChunk.empty()) {
+        return;
+    }
+
+    fNewLines += std::count(outputChunk.begin(), outputChunk.end(), '\n');
+    fIsLastLineOpen = (outputChunk.back() != '\n');
+}
+
+bool
+OutputLineCountExpectation::NeedsMoreOutput() const
+{
+    // the lines are counted up to the end in other cases, to report them
+    return fComparison != Comparison::AT_LEAST || _LineCount() < fExpectedLineCount;
+}
+
+validation::ValidationResult
+OutputLineCountExpectation::Validate(const ProcessResults &)
+{
+    const auto lineCount = _LineCount();
+
+    if (isWithinLimit(lineCount, fComparison, fExpectedLineCount)) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputLineCountCause{fComparison, fExpectedLineCount, lineCount}};
+}
+
+std::uint64_t
+OutputLineCountExpectation::_LineCount() const
+{
+    return fNewLines + (fIsLastLineOpen ? 1 : 0);
+}
+
+}  // omtt::expectation
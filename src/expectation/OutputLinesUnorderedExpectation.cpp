@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputLinesUnorderedExpectation.hpp"
+#include "headers/expectation/validation/OutputLinesUnorderedCause.hpp"
+
+#include <algorithm>
+
+
+namespace omtt::expectation
+{
+
+namespace
+{
+
+constexpr std::size_t MAX_LISTED_LINES = 10;
+
+// calls the function for each line, the new line at the end doesn't begin a next one
+template<class Function>
+void
+for_each_line(const std::string_view &text, Function function)
+{
+    std::string_view::size_type lineBegin = 0;
+
+    while (lineBegin < text.size()) {
+        auto lineEnd = text.find('\n', lineBegin);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = text.size();
+        }
+
+        function(text.substr(lineBegin, lineEnd - lineBegin));
+        lineBegin = lineEnd + 1;
+    }
+}
+
+}
+
+OutputLinesUnorderedExpectation::OutputLinesUnorderedExpectation(const std::string_view &expectedOutput)
+    :
+    fExpectedOutput(expectedOutput)
+{
+}
+
+void
+OutputLinesUnorderedExpectation::Prepare(const PreparationContext &)
+{
+    fLines.emplace();
+    fPartialLine.clear();
+
+    for_each_line(fExpectedOutput, [this](const std::string_view &line) { fLines->Add(line); });
+}
+
+void
+OutputLinesUnorderedExpectation::Consume(const std::string_view &outputChunk)
+{
+    std::string_view rest = outputChunk;
+
+    if (!fPartialLine.empty()) {
+        const auto lineEnd = rest.find('\n');
+        if (lineEnd == std::string_view::npos) {
+            fPartialLine.append(rest);
+            return;
+        }
+
+        fPartialLine.append(rest.substr(0, lineEnd));
+        fLines->Remove(fPartialLine);
+        fPartialLine.clear();
+        rest.remove_prefix(lineEnd + 1);
+    }
+
+    auto lineEnd = rest.find('\n');
+    while (lineEnd != std::string_view::npos) {
+        fLines->Remove(rest.substr(0, lineEnd));
+        rest.remove_prefix(lineEnd + 1);
+        lineEnd = rest.find('\n');
+    }
+
+    fPartialLine.assign(rest);
+}
+
+validation::ValidationResult
+OutputLinesUnorderedExpectation::Validate(const ProcessResults &)
+{
+    _RemovePartialLine();
+
+    std::vector<validation::OutputLinesUnorderedCause::Line> missingLines, extraLines;
+    std::uint64_t missingLinesCount = 0, extraLinesCount = 0;
+
+    for (const auto &entry : fLines->GetEntries()) {
+        if (entry.count > 0) {
+            missingLinesCount += entry.count;
+            if (missingLines.size() < MAX_LISTED_LINES) {
+                missingLines.push_back({entry.line, static_cast<std::uint64_t>(entry.count)});
+            }
+        }
+        else if (entry.count < 0) {
+            extraLinesCount += -entry.count;
+            if (extraLines.size() < MAX_LISTED_LINES) {
+                extraLines.push_back({entry.line, static_cast<std::uint64_t>(-entry.count)});
+            }
+        }
+    }
+
+    if (missingLinesCount == 0 && extraLinesCount == 0) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputLinesUnorderedCause{std::move(missingLines),
+                                                  missingLinesCount,
+                                                  std::move(extraLines),
+                                                  extraLinesCount}};
+}
+
+bool
+OutputLinesUnorderedExpectation::IsSatisfied(const ProcessResults &)
+{
+    _RemovePartialLine();
+
+    const auto &entries = fLines->GetEntries();
+    return std::all_of(entries.begin(), entries.end(), [](const auto &entry) { return entry.count == 0; });
+}
+
+void
+OutputLinesUnorderedExpectation::_RemovePartialLine()
+{
+    // the last line doesn't have to end with the new line
+    if (!fPartialLine.empty()) {
+        fLines->Remove(fPartialLine);
+        fPartialLine.clear();
+    }
+}
+
+}  // omtt::expectation
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputMatchesExpectation.hpp"
+#include "headers/expectation/validation/OutputMatchesCause.hpp"
+
+
+namespace omtt::expectation
+{
+
+OutputMatchesExpectation::OutputMatchesExpectation(const std::string_view &pattern)
+    :
+    fPattern(pattern)
+{
+}
+
+void
+OutputMatchesExpectation::Prepare(const PreparationContext &context)
+{
+    fMatcher.emplace(context.patternCache.Get(fPattern, regex::Mode::WHOLE_TEXT));
+    fOutputContext.Reset();
+}
+
+void
+OutputMatchesExpectation::Consume(const std::string_view &outputChunk)
+{
+    if (fOutputContext.IsStarted()) {
+        fOutputContext.Collect(outputChunk);
+        return;
+    }
+
+    const std::size_t consumed = fMatcher->Feed(outputChunk);
+    fOutputContext.Remember(outputChunk.substr(0, consumed));
+
+    if (fMatcher->IsDecided()) {
+        fOutputContext.Start();
+        fOutputContext.Collect(outputChunk.substr(consumed));
+    }
+}
+
+validation::ValidationResult
+OutputMatchesExpectation::Validate(const ProcessResults &)
+{
+    if (fMatcher->Finish()) {
+        return {std::nullopt};
+    }
+
+    if (!fOutputContext.IsStarted()) {
+        fOutputContext.Start();
+    }
+
+    return {validation::OutputMatchesCause{fPattern,
+                                           fMatcher->GetMatchedPrefixSize(),
+                                           fOutputContext.GetPosition(),
+                                           fOutputContext.GetContext()}};
+}
+
+bool
+OutputMatchesExpectation::IsSatisfied(const ProcessResults &)
+{
+    return fMatcher->Finish();
+}
+
+}  // omtt::expectation
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputSha256Expectation.hpp"
+#include "headers/expectation/exception/DigestSyntaxException.hpp"
+#include "headers/expectation/validation/OutputSha256Cause.hpp"
+
+
+namespace omtt::expectation
+{
+
+namespace
+{
+
+detail::Sha256::Digest
+parse_expected_digest(const std::string_view &digest)
+{
+    const auto parsed = detail::parse_digest(digest);
+    if (!parsed) {
+        throw exception::DigestSyntaxException(digest);
+    }
+
+    return *parsed;
+}
+
+}
+
+OutputSha256Expectation::OutputSha256Expectation(const std::string_view &expectedDigest)
+    :
+    fExpectedDigest(parse_expected_digest(expectedDigest)),
+    fSize(0)
+{
+}
+
+void
+OutputSha256Expectation::Prepare(const PreparationContext &)
+{
+    fSha256.Reset();
+    fSize = 0;
+    fHead.clear();
+    fTail.clear();
+}
+
+void
+OutputSha256Expectation::Consume(const std::string_view &outputChunk)
+{
+    fSha256.Update(outputChunk);
+    fSize += outputChunk.size();
+
+    if (fHead.size() < SAMPLE_SIZE) {
+        fHead.append(outputChunk.substr(0, SAMPLE_SIZE - fHead.size()));
+    }
+
+    if (outputChunk.size() >= SAMPLE_SIZE) {
+        fTail.assign(outputChunk.substr(outputChunk.size() - SAMPLE_SIZE));
+    }
+    else {
+        fTail.append(outputChunk);
+        if (fTail.size() > SAMPLE_SIZE) {
+            fTail.erase(0, fTail.size() - SAMPLE_SIZE);
+        }
+    }
+}
+
+validation::ValidationResult
+OutputSha256Expectation::Validate(const ProcessResults &)
+{
+    const auto digest = fSha256.GetDigest();
+
+    if (digest == fExpectedDigest) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputSha256Cause{detail::to_hex(fExpectedDigest),
+                                          detail::to_hex(digest),
+                                          fSize,
+                                          fHead,
+                                          fTail}};
+}
+
+bool
+OutputSha256Expectation::IsSatisfied(const ProcessResults &)
+{
+    return fSha256.GetDigest() == fExpectedDigest;
+}
+
+}  // omtt::expectation
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputSizeExpectation.hpp"
+#include "headers/expectation/validation/OutputSizeCause.hpp"
+
+
+namespace omtt::expectation
+{
+
+OutputSizeExpectation::OutputSizeExpectation(const Comparison comparison,
+                                             const std::uint64_t expectedSize)
+    :
+    fComparison(comparison),
+    fExpectedSize(expectedSize),
+    fSize(0)
+{
+}
+
+void
+OutputSizeExpectation::Prepare(const PreparationContext &)
+{
+    fSize = 0;
+}
+
+void
+OutputSizeExpectation::Consume(const std::string_view &outputChunk)
+{
+    fSize += outputChunk.size();
+}
+
+bool
+OutputSizeExpectation::NeedsMoreOutput() const
+{
+    // the size is counted up to the end in other cases, to report it
+    return fComparison != Comparison::AT_LEAST || fSize < fExpectedSize;
+}
+
+validation::ValidationResult
+OutputSizeExpectation::Validate(const ProcessResults &)
+{
+    if (isWithinLimit(fSize, fComparison, fExpectedSize)) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputSizeCause{fComparison, fExpectedSize, fSize}};
+}
+
+}  // omtt::expectation
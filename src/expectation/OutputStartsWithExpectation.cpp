@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputStartsWithExpectation.hpp"
+#include "headers/expectation/validation/OutputStartsWithCause.hpp"
+
+#include <algorithm>
+
+
+namespace omtt::expectation
+{
+
+OutputStartsWithExpectation::OutputStartsWithExpectation(const std::string_view &expectedBeginning)
+    :
+    fExpectedBeginning(expectedBeginning),
+    fMatched(0)
+{
+}
+
+void
+OutputStartsWithExpectation::Prepare(const PreparationContext &)
+{
+    fMatched = 0;
+    fOutputContext.Reset();
+}
+
+void
+OutputStartsWithExpectation::Consume(const std::string_view &outputChunk)
+{
+    if (fOutputContext.IsStarted()) {
+        fOutputContext.Collect(outputChunk);
+        return;
+    }
+
+    const auto length = std::min(fExpectedBeginning.size() - fMatched, outputChunk.size());
+    const auto difference = std::mismatch(outputChunk.begin(),
+                                          outputChunk.begin() + length,
+                                          fExpectedBeginning.begin() + fMatched);
+    const auto matched = static_cast<std::string_view::size_type>(difference.first - outputChunk.begin());
+
+    fOutputContext.Remember(outputChunk.substr(0, matched));
+    fMatched += matched;
+
+    if (matched < length) {
+        fOutputContext.Start();
+        fOutputContext.Collect(outputChunk.substr(matched));
+    }
+}
+
+bool
+OutputStartsWithExpectation::NeedsMoreOutput() const
+{
+    if (fOutputContext.IsStarted()) {
+        return !fOutputContext.IsCollected();
+    }
+
+    return fMatched < fExpectedBeginning.size();
+}
+
+validation::ValidationResult
+OutputStartsWithExpectation::Validate(const ProcessResults &)
+{
+    if (!fOutputContext.IsStarted() && fMatched == fExpectedBeginning.size()) {
+        return {std::nullopt};
+    }
+
+    if (!fOutputContext.IsStarted()) {
+        fOutputContext.Start();
+    }
+
+    return {validation::OutputStartsWithCause{fExpectedBeginning,
+                                              fMatched,
+                                              fOutputContext.GetPosition(),
+                                              fOutputContext.GetContext()}};
+}
+
+}  // omtt::expectation
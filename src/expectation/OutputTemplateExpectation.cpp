@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputTemplateExpectation.hpp"
+#include "headers/expectation/validation/OutputTemplateCause.hpp"
+
+
+namespace omtt::expectation
+{
+
+validation::ValidationResult
+OutputTemplateExpectation::Validate(const ProcessResults &processResults)
+{
+    const auto mismatch = fTemplate.Match(processResults.output);
+
+    if (!mismatch.has_value()) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputTemplateCause{mismatch->outputPosition,
+                                            mismatch->templatePosition,
+                                            fSource,
+                                            processResults.output}};
+}
+
+bool
+OutputTemplateExpectation::IsSatisfied(const ProcessResults &processResults)
+{
+    return !fTemplate.Match(processResults.output).has_value();
+}
+
+}  // omtt::expectation
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/OutputWithToleranceExpectation.hpp"
+#include "headers/expectation/exception/ToleranceSyntaxException.hpp"
+#include "headers/expectation/validation/OutputWithToleranceCause.hpp"
+
+
+namespace omtt::expectation
+{
+
+namespace
+{
+
+double
+parse_tolerance(const std::string_view &tolerance)
+{
+    const auto value = detail::parse_number(tolerance);
+    if (!value || *value < 0) {
+        throw exception::ToleranceSyntaxException(tolerance);
+    }
+
+    return *value;
+}
+
+}
+
+OutputWithToleranceExpectation::OutputWithToleranceExpectation(const std::string_view &expectedOutput,
+                                                               const std::string_view &absoluteTolerance,
+                                                               const std::string_view &relativeTolerance)
+    :
+    fExpectedOutput(expectedOutput),
+    fTolerance{parse_tolerance(absoluteTolerance), parse_tolerance(relativeTolerance)}
+{
+}
+
+validation::ValidationResult
+OutputWithToleranceExpectation::Validate(const ProcessResults &processResults)
+{
+    const std::string_view output(processResults.output);
+
+    const auto mismatch = detail::compare_with_tolerance(fExpectedOutput, output, fTolerance);
+    if (!mismatch) {
+        return {std::nullopt};
+    }
+
+    return {validation::OutputWithToleranceCause{
+        mismatch->expectedPosition,
+        mismatch->outputPosition,
+        fExpectedOutput.substr(mismatch->expectedPosition, mismatch->expectedNumberSize),
+        output.substr(mismatch->outputPosition, mismatch->outputNumberSize),
+        fExpectedOutput,
+        output}};
+}
+
+bool
+OutputWithToleranceExpectation::IsSatisfied(const ProcessResults &processResults)
+{
+    return !detail::compare_with_tolerance(fExpectedOutput, processResults.output, fTolerance).has_value();
+}
+
+}  // omtt::expectation
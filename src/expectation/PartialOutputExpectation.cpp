@@ -20,13 +20,15 @@ namespace omtt::expectation
 validation::ValidationResult
 PartialOutputExpectation::Validate(const ProcessResults &processResults)
 {
-    const auto pos = processResults.output.find(fExpectedPartialOutput);
+    const bool isFound = fIsSearchedExternally
+                         ? fIsFound
+                         : streamText(processResults, fStream).find(fExpectedPartialOutput) != std::string::npos;
 
-    if (pos != std::string::npos) {
+    if (isFound) {
         return {std::nullopt};
     }
     else {
-        return {validation::PartialOutputCause{fExpectedPartialOutput}};
+        return {validation::PartialOutputCause{fExpectedPartialOutput, fStream}};
     }
 }
 
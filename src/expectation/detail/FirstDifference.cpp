@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/FirstDifference.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+constexpr std::uint64_t NEW_LINES = 0x0a0a0a0a0a0a0a0aull;
+constexpr std::uint64_t LOW_BITS = 0x7f7f7f7f7f7f7f7full;
+
+std::uint64_t
+load_word(const char *data)
+{
+    std::uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+// the highest bit is set exactly in the bytes which are new lines
+std::size_t
+count_word_new_lines(const std::uint64_t word)
+{
+    const std::uint64_t zeros = word ^ NEW_LINES;
+    const std::uint64_t marks = ~(((zeros & LOW_BITS) + LOW_BITS) | zeros | LOW_BITS);
+    return std::bitset<64>(marks).count();
+}
+
+}
+
+std::optional<Difference>
+find_first_difference(const std::string_view &expected,
+                      const std::string_view &output)
+{
+    const std::string_view::size_type size = std::min(expected.size(), output.size());
+    std::string_view::size_type position = 0;
+    std::string_view::size_type newLines = 0;
+
+    for (; position + sizeof(std::uint64_t) <= size; position += sizeof(std::uint64_t)) {
+        const std::uint64_t word = load_word(output.data() + position);
+        if (word != load_word(expected.data() + position)) {
+            break;
+        }
+        newLines += count_word_new_lines(word);
+    }
+
+    while (position < size && expected[position] == output[position]) {
+        newLines += (output[position] == '\n') ? 1 : 0;
+        ++position;
+    }
+
+    if (position == size && expected.size() == output.size()) {
+        return std::nullopt;
+    }
+
+    const auto lineBegin = (position == 0) ? std::string_view::npos : output.rfind('\n', position - 1);
+    const auto column = (lineBegin == std::string_view::npos) ? position + 1 : position - lineBegin;
+
+    return Difference{position, newLines + 1, column};
+}
+
+std::string_view::size_type
+count_new_lines(const std::string_view &text)
+{
+    std::string_view::size_type position = 0;
+    std::string_view::size_type newLines = 0;
+
+    for (; position + sizeof(std::uint64_t) <= text.size(); position += sizeof(std::uint64_t)) {
+        newLines += count_word_new_lines(load_word(text.data() + position));
+    }
+
+    for (; position < text.size(); ++position) {
+        newLines += (text[position] == '\n') ? 1 : 0;
+    }
+
+    return newLines;
+}
+
+}  // omtt::expectation::detail
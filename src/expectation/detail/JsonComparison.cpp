@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/JsonComparison.hpp"
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+const std::string NOTHING = "nothing";
+
+void
+append_pointer_token(std::string &pointer, const std::string_view &token)
+{
+    pointer.push_back('/');
+
+    for (const char c : token) {
+        if (c == '~') {
+            pointer += "~0";
+        }
+        else if (c == '/') {
+            pointer += "~1";
+        }
+        else {
+            pointer.push_back(c);
+        }
+    }
+}
+
+}
+
+JsonComparison::JsonComparison(const json::Value &expected)
+    :
+    fExpected(expected),
+    fDepth(0)
+{
+}
+
+void
+JsonComparison::OnNull()
+{
+    const json::Value *expected = _BeginValue("null");
+    if (expected != nullptr && expected->kind != json::Value::Kind::NULL_VALUE) {
+        _SetDifference(json::describe(*expected), "null");
+    }
+}
+
+void
+JsonComparison::OnBoolean(const bool value)
+{
+    const std::string_view actual = value ? "true" : "false";
+
+    const json::Value *expected = _BeginValue(actual);
+    if (expected != nullptr
+        && (expected->kind != json::Value::Kind::BOOLEAN || expected->boolean != value)) {
+        _SetDifference(json::describe(*expected), std::string(actual));
+    }
+}
+
+void
+JsonComparison::OnNumber(const std::string_view &number)
+{
+    const json::Value *expected = _BeginValue(number);
+    if (expected != nullptr
+        && (expected->kind != json::Value::Kind::NUMBER
+            || expected->canonicalNumber != json::canonical_number(number))) {
+        _SetDifference(json::describe(*expected), std::string(number));
+    }
+}
+
+void
+JsonComparison::OnString(const std::string_view &value)
+{
+    if (fDifference) {
+        return;
+    }
+
+    // the string is described only when it's needed
+    const json::Value *expected = _BeginValue({});
+    if (fDifference) {
+        fDifference->actual = json::describe_string(value);
+    }
+    else if (expected->kind != json::Value::Kind::STRING || expected->text != value) {
+        _SetDifference(json::describe(*expected), json::describe_string(value));
+    }
+}
+
+void
+JsonComparison::OnKey(const std::string_view &key)
+{
+    if (fDifference) {
+        return;
+    }
+
+    Frame &frame = fFrames[fDepth - 1];
+    frame.key.assign(key);
+    frame.index = frame.expected->FindMember(key);
+
+    if (frame.index != json::Value::NOT_FOUND) {
+        if (frame.seenMembers[frame.index]) {
+            _SetDifference("one member", "duplicated member");
+            return;
+        }
+        frame.seenMembers[frame.index] = true;
+    }
+}
+
+void
+JsonComparison::OnObjectBegin()
+{
+    _BeginContainer(json::Value::Kind::OBJECT, "object");
+}
+
+void
+JsonComparison::OnObjectEnd()
+{
+    if (fDifference) {
+        return;
+    }
+
+    Frame &frame = fFrames[fDepth - 1];
+    for (std::size_t i = 0; i < frame.seenMembers.size(); ++i) {
+        if (!frame.seenMembers[i]) {
+            frame.key = frame.expected->keys[i];
+            _SetDifference(json::describe(frame.expected->items[i]), NOTHING);
+            return;
+        }
+    }
+
+    --fDepth;
+}
+
+void
+JsonComparison::OnArrayBegin()
+{
+    _BeginContainer(json::Value::Kind::ARRAY, "array");
+}
+
+void
+JsonComparison::OnArrayEnd()
+{
+    if (fDifference) {
+        return;
+    }
+
+    Frame &frame = fFrames[fDepth - 1];
+    if (frame.index < frame.expected->items.size()) {
+        const json::Value &missing = frame.expected->items[frame.index];
+        ++frame.index;
+        _SetDifference(json::describe(missing), NOTHING);
+        return;
+    }
+
+    --fDepth;
+}
+
+void
+JsonComparison::SetInvalidOutput(const std::string &error)
+{
+    if (fDifference) {
+        return;
+    }
+
+    // the value pointed by the current position, when it's known
+    const json::Value *expected = &fExpected;
+    if (fDepth > 0) {
+        const Frame &frame = fFrames[fDepth - 1];
+        expected = frame.expected;
+
+        if (frame.expected->kind == json::Value::Kind::OBJECT && frame.index != json::Value::NOT_FOUND) {
+            expected = &frame.expected->items[frame.index];
+        }
+        else if (frame.expected->kind == json::Value::Kind::ARRAY
+                 && frame.index > 0 && frame.index <= frame.expected->items.size()) {
+            expected = &frame.expected->items[frame.index - 1];
+        }
+    }
+
+    _SetDifference(json::describe(*expected), "invalid JSON (" + error + ")");
+}
+
+bool
+JsonComparison::HasDifference() const
+{
+    return fDifference.has_value();
+}
+
+const std::optional<JsonComparison::Difference> &
+JsonComparison::GetDifference() const
+{
+    return fDifference;
+}
+
+const json::Value *
+JsonComparison::_BeginValue(const std::string_view actual)
+{
+    if (fDifference) {
+        return nullptr;
+    }
+
+    const json::Value *expected = &fExpected;
+
+    if (fDepth > 0) {
+        Frame &frame = fFrames[fDepth - 1];
+
+        if (frame.expected->kind == json::Value::Kind::ARRAY) {
+            const std::size_t index = frame.index++;
+            expected = (index < frame.expected->items.size()) ? &frame.expected->items[index] : nullptr;
+        }
+        else {
+            expected = (frame.index != json::Value::NOT_FOUND) ? &frame.expected->items[frame.index] : nullptr;
+        }
+    }
+
+    if (expected == nullptr) {
+        _SetDifference(NOTHING, std::string(actual));
+    }
+
+    return expected;
+}
+
+void
+JsonComparison::_BeginContainer(const json::Value::Kind kind, const std::string_view actual)
+{
+    const json::Value *expected = _BeginValue(actual);
+    if (expected == nullptr) {
+        return;
+    }
+
+    if (expected->kind != kind) {
+        _SetDifference(json::describe(*expected), std::string(actual));
+        return;
+    }
+
+    if (fFrames.size() == fDepth) {
+        fFrames.emplace_back();
+    }
+
+    Frame &frame = fFrames[fDepth++];
+    frame.expected = expected;
+    frame.index = (kind == json::Value::Kind::ARRAY) ? 0 : json::Value::NOT_FOUND;
+    frame.seenMembers.assign(expected->keys.size(), false);
+}
+
+void
+JsonComparison::_SetDifference(std::string expected, std::string actual)
+{
+    fDifference = Difference{_Pointer(), std::move(expected), std::move(actual)};
+}
+
+std::string
+JsonComparison::_Pointer() const
+{
+    std::string pointer;
+
+    for (std::size_t i = 0; i < fDepth; ++i) {
+        const Frame &frame = fFrames[i];
+
+        if (frame.expected->kind == json::Value::Kind::ARRAY) {
+            const std::size_t index = (frame.index > 0) ? frame.index - 1 : 0;
+            append_pointer_token(pointer, std::to_string(index));
+        }
+        else {
+            append_pointer_token(pointer, frame.key);
+        }
+    }
+
+    return pointer;
+}
+
+}  // omtt::expectation::detail
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/LineDiff.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <unordered_map>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+typedef std::ptrdiff_t Index;
+
+std::vector<std::string_view>
+split_lines(const std::string_view &text)
+{
+    std::vector<std::string_view> lines;
+    std::string_view::size_type begin = 0;
+
+    while (begin < text.size()) {
+        auto end = text.find('\n', begin);
+        end = (end == std::string_view::npos) ? text.size() : end + 1;
+
+        lines.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+
+    return lines;
+}
+
+/*
+ * Lines are compared by numbers given to the same texts, the deleted and
+ * inserted lines are marked while the middle snakes are found.
+ */
+class EditScript
+{
+public:
+    EditScript(const std::vector<std::string_view> &expectedLines,
+               const std::vector<std::string_view> &outputLines,
+               const std::size_t maxEditDistance)
+        :
+        fMaxEditDistance(static_cast<Index>(maxEditDistance)),
+        fMaxSteps(static_cast<Index>(maxEditDistance / 2 + 1)),
+        fDeleted(expectedLines.size(), false),
+        fInserted(outputLines.size(), false)
+    {
+        std::unordered_map<std::string_view, std::uint32_t> numbers;
+
+        const auto number = [&numbers](const std::string_view &line) {
+            return numbers.emplace(line, static_cast<std::uint32_t>(numbers.size())).first->second;
+        };
+
+        fExpected.reserve(expectedLines.size());
+        for (const auto &line : expectedLines) {
+            fExpected.push_back(number(line));
+        }
+
+        fOutput.reserve(outputLines.size());
+        for (const auto &line : outputLines) {
+            fOutput.push_back(number(line));
+        }
+    }
+
+    // false when the edit distance is over the limit
+    bool
+    Find()
+    {
+        const auto expectedSize = static_cast<Index>(fExpected.size());
+        const auto outputSize = static_cast<Index>(fOutput.size());
+
+        if (std::abs(expectedSize - outputSize) > fMaxEditDistance) {
+            return false;
+        }
+
+        fForward.assign(2 * fMaxSteps + 3, 0);
+        fBackward.assign(2 * fMaxSteps + 3, 0);
+
+        return _Compare(0, expectedSize, 0, outputSize);
+    }
+
+    bool
+    IsDeleted(const std::size_t expectedLine) const
+    {
+        return fDeleted[expectedLine];
+    }
+
+    bool
+    IsInserted(const std::size_t outputLine) const
+    {
+        return fInserted[outputLine];
+    }
+
+private:
+    struct Snake
+    {
+        Index  expectedBegin;
+        Index  outputBegin;
+        Index  expectedEnd;
+        Index  outputEnd;
+        Index  editDistance;
+    };
+
+    bool
+    _Compare(Index expectedBegin, Index expectedEnd, Index outputBegin, Index outputEnd)
+    {
+        while (expectedBegin < expectedEnd && outputBegin < outputEnd
+               && fExpected[expectedBegin] == fOutput[outputBegin]) {
+            ++expectedBegin;
+            ++outputBegin;
+        }
+
+        while (expectedBegin < expectedEnd && outputBegin < outputEnd
+               && fExpected[expectedEnd - 1] == fOutput[outputEnd - 1]) {
+            --expectedEnd;
+            --outputEnd;
+        }
+
+        if (expectedBegin == expectedEnd || outputBegin == outputEnd) {
+            std::fill(fDeleted.begin() + expectedBegin, fDeleted.begin() + expectedEnd, true);
+            std::fill(fInserted.begin() + outputBegin, fInserted.begin() + outputEnd, true);
+            return true;
+        }
+
+        const auto snake = _FindMiddleSnake(expectedBegin, expectedEnd, outputBegin, outputEnd);
+        if (!snake || snake->editDistance > fMaxEditDistance) {
+            return false;
+        }
+
+        return _Compare(expectedBegin, snake->expectedBegin, outputBegin, snake->outputBegin)
+               && _Compare(snake->expectedEnd, expectedEnd, snake->outputEnd, outputEnd);
+    }
+
+    /*
+     * Searches the shortest paths from both ends at the same time, the
+     * diagonal where they meet splits the texts in two smaller problems.
+     */
+    std::optional<Snake>
+    _FindMiddleSnake(const Index expectedBegin, const Index expectedEnd,
+                     const Index outputBegin, const Index outputEnd)
+    {
+        const Index n = expectedEnd - expectedBegin;
+        const Index m = outputEnd - outputBegin;
+        const Index delta = n - m;
+        const bool isDeltaOdd = (delta % 2 != 0);
+        const Index maxSteps = std::min((n + m + 1) / 2, fMaxSteps);
+
+        _Forward(1) = 0;
+        _Backward(1) = 0;
+
+        for (Index d = 0; d <= maxSteps; ++d) {
+            for (Index k = -d; k <= d; k += 2) {
+                Index x = (k == -d || (k != d && _Forward(k - 1) < _Forward(k + 1)))
+                          ? _Forward(k + 1)
+                          : _Forward(k - 1) + 1;
+                Index y = x - k;
+                const Index snakeX = x;
+                const Index snakeY = y;
+
+                while (x < n && y < m && fExpected[expectedBegin + x] == fOutput[outputBegin + y]) {
+                    ++x;
+                    ++y;
+                }
+                _Forward(k) = x;
+
+                const Index backwardK = delta - k;
+                if (isDeltaOdd && backwardK >= -(d - 1) && backwardK <= d - 1
+                    && x + _Backward(backwardK) >= n) {
+                    return Snake{expectedBegin + snakeX, outputBegin + snakeY,
+                                 expectedBegin + x, outputBegin + y,
+                                 2 * d - 1};
+                }
+            }
+
+            for (Index k = -d; k <= d; k += 2) {
+                Index x = (k == -d || (k != d && _Backward(k - 1) < _Backward(k + 1)))
+                          ? _Backward(k + 1)
+                          : _Backward(k - 1) + 1;
+                Index y = x - k;
+                const Index snakeX = x;
+                const Index snakeY = y;
+
+                while (x < n && y < m && fExpected[expectedEnd - 1 - x] == fOutput[outputEnd - 1 - y]) {
+                    ++x;
+                    ++y;
+                }
+                _Backward(k) = x;
+
+                const Index forwardK = delta - k;
+                if (!isDeltaOdd && forwardK >= -d && forwardK <= d
+                    && x + _Forward(forwardK) >= n) {
+                    return Snake{expectedEnd - x, outputEnd - y,
+                                 expectedEnd - snakeX, outputEnd - snakeY,
+                                 2 * d};
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    Index &
+    _Forward(const Index k)
+    {
+        return fForward[fMaxSteps + 1 + k];
+    }
+
+    Index &
+    _Backward(const Index k)
+    {
+        return fBackward[fMaxSteps + 1 + k];
+    }
+
+private:
+    const Index                 fMaxEditDistance;
+    const Index                 fMaxSteps;
+    std::vector<std::uint32_t>  fExpected;
+    std::vector<std::uint32_t>  fOutput;
+    std::vector<bool>           fDeleted;
+    std::vector<bool>           fInserted;
+    std::vector<Index>          fForward;
+    std::vector<Index>          fBackward;
+};
+
+void
+append_lines(DiffHunk &hunk,
+             const DiffLine::Kind kind,
+             const std::vector<std::string_view> &lines,
+             const std::size_t begin,
+             const std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i) {
+        hunk.lines.push_back({kind, lines[i]});
+    }
+
+    if (kind != DiffLine::Kind::INSERTED) {
+        hunk.expectedCount += end - begin;
+    }
+    if (kind != DiffLine::Kind::DELETED) {
+        hunk.outputCount += end - begin;
+    }
+}
+
+}
+
+std::optional<std::vector<DiffHunk>>
+diff_lines(const std::string_view &expected,
+           const std::string_view &output,
+           const std::size_t maxEditDistance,
+           const std::size_t contextLines)
+{
+    const std::vector<std::string_view> expectedLines = split_lines(expected);
+    const std::vector<std::string_view> outputLines = split_lines(output);
+
+    EditScript script(expectedLines, outputLines, maxEditDistance);
+    if (!script.Find()) {
+        return std::nullopt;
+    }
+
+    std::vector<DiffHunk> hunks;
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+    while (true) {
+        const std::size_t commonBegin = i;
+        while (i < expectedLines.size() && j < outputLines.size()
+               && !script.IsDeleted(i) && !script.IsInserted(j)) {
+            ++i;
+            ++j;
+        }
+
+        const bool isFinished = (i == expectedLines.size() && j == outputLines.size());
+        const std::size_t common = i - commonBegin;
+
+        if (!hunks.empty() && (isFinished || common > 2 * contextLines)) {
+            append_lines(hunks.back(), DiffLine::Kind::COMMON, expectedLines,
+                         commonBegin, commonBegin + std::min(common, contextLines));
+        }
+        else if (!hunks.empty()) {
+            append_lines(hunks.back(), DiffLine::Kind::COMMON, expectedLines, commonBegin, i);
+        }
+
+        if (isFinished) {
+            break;
+        }
+
+        if (hunks.empty() || common > 2 * contextLines) {
+            const std::size_t leading = std::min(i, contextLines);
+            hunks.push_back({i - leading, 0, j - leading, 0, {}});
+            append_lines(hunks.back(), DiffLine::Kind::COMMON, expectedLines, i - leading, i);
+        }
+
+        const std::size_t deletedBegin = i;
+        while (i < expectedLines.size() && script.IsDeleted(i)) {
+            ++i;
+        }
+        append_lines(hunks.back(), DiffLine::Kind::DELETED, expectedLines, deletedBegin, i);
+
+        const std::size_t insertedBegin = j;
+        while (j < outputLines.size() && script.IsInserted(j)) {
+            ++j;
+        }
+        append_lines(hunks.back(), DiffLine::Kind::INSERTED, outputLines, insertedBegin, j);
+    }
+
+    return hunks;
+}
+
+}  // omtt::expectation::detail
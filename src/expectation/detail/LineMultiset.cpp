@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/LineMultiset.hpp"
+
+#include <functional>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+constexpr std::uint32_t EMPTY_SLOT = UINT32_MAX;
+constexpr std::size_t INITIAL_SLOTS = 64;
+
+}
+
+LineMultiset::LineMultiset()
+    :
+    fSlots(INITIAL_SLOTS, EMPTY_SLOT)
+{
+}
+
+void
+LineMultiset::Add(const std::string_view &line)
+{
+    ++fEntries[_FindOrInsert(line, false)].count;
+}
+
+void
+LineMultiset::Remove(const std::string_view &line)
+{
+    --fEntries[_FindOrInsert(line, true)].count;
+}
+
+const std::vector<LineMultiset::Entry> &
+LineMultiset::GetEntries() const
+{
+    return fEntries;
+}
+
+std::uint32_t
+LineMultiset::_FindOrInsert(const std::string_view &line, const bool copyLine)
+{
+    const std::size_t hash = std::hash<std::string_view>{}(line);
+    const std::size_t mask = fSlots.size() - 1;
+
+    std::size_t slot = hash & mask;
+    while (fSlots[slot] != EMPTY_SLOT) {
+        const Entry &entry = fEntries[fSlots[slot]];
+        if (entry.hash == hash && entry.line == line) {
+            return fSlots[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    std::string_view storedLine = line;
+    if (copyLine) {
+        storedLine = fCopiedLines.emplace_back(line);
+    }
+
+    const auto index = static_cast<std::uint32_t>(fEntries.size());
+    fEntries.push_back({storedLine, 0, hash});
+    fSlots[slot] = index;
+
+    // keeps the table at most half full, so the probe sequences stay short
+    if (fEntries.size() * 2 > fSlots.size()) {
+        _Grow();
+    }
+
+    return index;
+}
+
+void
+LineMultiset::_Grow()
+{
+    fSlots.assign(fSlots.size() * 2, EMPTY_SLOT);
+    const std::size_t mask = fSlots.size() - 1;
+
+    for (std::uint32_t index = 0; index < fEntries.size(); ++index) {
+        std::size_t slot = fEntries[index].hash & mask;
+        while (fSlots[slot] != EMPTY_SLOT) {
+            slot = (slot + 1) & mask;
+        }
+        fSlots[slot] = index;
+    }
+}
+
+}  // omtt::expectation::detail
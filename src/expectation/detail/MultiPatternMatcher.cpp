@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/MultiPatternMatcher.hpp"
+
+#include <queue>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+constexpr std::uint32_t ROOT = 0;
+
+}
+
+MultiPatternMatcher::MultiPatternMatcher(const std::vector<std::string_view> &patterns)
+    :
+    fClassCount(1),
+    fRemaining(0),
+    fState(ROOT)
+{
+    // bytes not used in any pattern share the class 0, which always leads to the root
+    fByteClass.fill(0);
+    for (const auto &pattern : patterns) {
+        for (const unsigned char ch : pattern) {
+            if (fByteClass[ch] == 0) {
+                fByteClass[ch] = static_cast<std::uint16_t>(fClassCount++);
+            }
+        }
+    }
+
+    fTransitions.assign(fClassCount, ROOT);
+    fIsTerminal.push_back(true);
+
+    for (const auto &pattern : patterns) {
+        fPatternStates.push_back(_Insert(pattern));
+    }
+
+    _Build();
+
+    // the empty pattern is found in any text
+    fIsFound.assign(fIsTerminal.size(), false);
+    fIsFound[ROOT] = true;
+}
+
+bool
+MultiPatternMatcher::Feed(const std::string_view &chunk)
+{
+    const std::size_t remainingBefore = fRemaining;
+    std::uint32_t state = fState;
+
+    for (const unsigned char ch : chunk) {
+        if (fRemaining == 0) {
+            break;
+        }
+
+        state = fTransitions[state * fClassCount + fByteClass[ch]];
+
+        if (fHasPendingOutput[state]) {
+            _Report(state);
+        }
+    }
+
+    fState = state;
+    return fRemaining != remainingBefore;
+}
+
+bool
+MultiPatternMatcher::IsFound(std::size_t patternIndex) const
+{
+    return fIsFound[fPatternStates[patternIndex]];
+}
+
+bool
+MultiPatternMatcher::AreAllFound() const
+{
+    return fRemaining == 0;
+}
+
+std::uint32_t
+MultiPatternMatcher::_Insert(const std::string_view &pattern)
+{
+    std::uint32_t state = ROOT;
+
+    for (const unsigned char ch : pattern) {
+        std::uint32_t &next = fTransitions[state * fClassCount + fByteClass[ch]];
+
+        if (next == ROOT) {
+            next = static_cast<std::uint32_t>(fIsTerminal.size());
+            fIsTerminal.push_back(false);
+            fTransitions.resize(fTransitions.size() + fClassCount, ROOT);
+        }
+
+        state = fTransitions[state * fClassCount + fByteClass[ch]];
+    }
+
+    if (!fIsTerminal[state]) {
+        fIsTerminal[state] = true;
+        ++fRemaining;
+    }
+
+    return state;
+}
+
+void
+MultiPatternMatcher::_Build()
+{
+    const std::size_t stateCount = fIsTerminal.size();
+    std::vector<std::uint32_t> failure(stateCount, ROOT);
+    fOutputLink.assign(stateCount, ROOT);
+    fHasPendingOutput.assign(stateCount, false);
+
+    std::queue<std::uint32_t> states;
+    states.push(ROOT);
+
+    // breadth first, so the failure state always has a complete row already
+    while (!states.empty()) {
+        const std::uint32_t state = states.front();
+        states.pop();
+
+        for (std::size_t byteClass = 0; byteClass < fClassCount; ++byteClass) {
+            std::uint32_t &next = fTransitions[state * fClassCount + byteClass];
+            const std::uint32_t fallback = (state == ROOT) ? ROOT : fTransitions[failure[state] * fClassCount + byteClass];
+
+            if (next == ROOT) {
+                next = fallback;
+                continue;
+            }
+
+            failure[next] = fallback;
+            fOutputLink[next] = fIsTerminal[fallback] ? fallback : fOutputLink[fallback];
+            fHasPendingOutput[next] = fIsTerminal[next] || fOutputLink[next] != ROOT;
+            states.push(next);
+        }
+    }
+}
+
+void
+MultiPatternMatcher::_Report(std::uint32_t state)
+{
+    fHasPendingOutput[state] = false;
+
+    // when a found state is reached, all states linked after it are found too
+    for (std::uint32_t output = fIsTerminal[state] ? state : fOutputLink[state];
+         output != ROOT && !fIsFound[output];
+         output = fOutputLink[output]) {
+        fIsFound[output] = true;
+        --fRemaining;
+    }
+}
+
+}  // omtt::expectation::detail
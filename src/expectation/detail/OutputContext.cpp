@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/OutputContext.hpp"
+
+
+namespace omtt::expectation::detail
+{
+
+OutputContext::OutputContext()
+    :
+    fIsStarted(false)
+{
+}
+
+void
+OutputContext::Reset()
+{
+    fTail.clear();
+    fContext.clear();
+    fIsStarted = false;
+}
+
+void
+OutputContext::Remember(const std::string_view &output)
+{
+    if (output.size() >= SIZE) {
+        fTail.assign(output.substr(output.size() - SIZE));
+    }
+    else {
+        fTail.append(output);
+        if (fTail.size() > SIZE) {
+            fTail.erase(0, fTail.size() - SIZE);
+        }
+    }
+}
+
+void
+OutputContext::Start()
+{
+    fIsStarted = true;
+    fContext = fTail;
+}
+
+void
+OutputContext::Collect(const std::string_view &output)
+{
+    const auto collected = fContext.size() - fTail.size();
+    if (collected < SIZE + 1) {
+        fContext.append(output.substr(0, SIZE + 1 - collected));
+    }
+}
+
+bool
+OutputContext::IsStarted() const
+{
+    return fIsStarted;
+}
+
+bool
+OutputContext::IsCollected() const
+{
+    return fIsStarted && fContext.size() - fTail.size() >= SIZE + 1;
+}
+
+const std::string &
+OutputContext::GetTail() const
+{
+    return fTail;
+}
+
+const std::string &
+OutputContext::GetContext() const
+{
+    return fContext;
+}
+
+std::string::size_type
+OutputContext::GetPosition() const
+{
+    return fTail.size();
+}
+
+}  // omtt::expectation::detail
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/OutputTemplate.hpp"
+#include "headers/expectation/exception/TemplateSyntaxException.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+typedef std::string_view::size_type size_type;
+
+constexpr std::string_view PLACEHOLDER_BEGIN = "{{";
+constexpr std::string_view PLACEHOLDER_END = "}}";
+
+bool
+is_digit(const char c)
+{
+    return std::isdigit(static_cast<unsigned char>(c));
+}
+
+bool
+is_hex_digit(const char c)
+{
+    return std::isxdigit(static_cast<unsigned char>(c));
+}
+
+// only names made of these characters are treated as placeholders,
+// so other texts in double braces are matched literally
+bool
+looks_like_placeholder_name(const std::string_view &name)
+{
+    return !name.empty()
+           && std::all_of(name.begin(), name.end(),
+                          [](const char c) { return std::islower(static_cast<unsigned char>(c)) || c == '*'; });
+}
+
+}
+
+/*
+ * Matches the template blocks against one output, remembering the
+ * furthest difference.
+ */
+class OutputTemplateMatching
+{
+public:
+    typedef std::vector<std::vector<OutputTemplate::Element>> Blocks;
+
+    OutputTemplateMatching(const std::string_view &output, const size_type templateSize)
+        :
+        fOutput(output),
+        fTemplateSize(templateSize)
+    {
+    }
+
+    std::optional<OutputTemplate::Mismatch>
+    Match(const Blocks &blocks)
+    {
+        auto position = _MatchBlock(blocks.front(), 0, 0);
+
+        for (Blocks::size_type i = 1; position.has_value() && i < blocks.size(); ++i) {
+            const bool isLast = (i + 1 == blocks.size());
+            position = _FindBlock(blocks[i], *position, isLast);
+        }
+
+        if (!position.has_value()) {
+            return fMismatch;
+        }
+
+        if (blocks.size() == 1 && *position != fOutput.size()) {
+            return OutputTemplate::Mismatch{*position, fTemplateSize};
+        }
+
+        return std::nullopt;
+    }
+
+private:
+    std::optional<size_type>
+    _FindBlock(const OutputTemplate::Block &block, const size_type from, const bool isLast)
+    {
+        // the template ends with {{*}}
+        if (block.empty()) {
+            return fOutput.size();
+        }
+
+        const auto &first = block.front();
+        size_type candidate = _FindCandidate(first, from);
+
+        while (candidate != std::string_view::npos) {
+            const size_type firstEnd = *_MatchElement(first, candidate);
+            const auto end = _MatchBlock(block, 1, firstEnd);
+
+            if (end.has_value()) {
+                if (!isLast || *end == fOutput.size()) {
+                    return end;
+                }
+
+                _Remember(*end, fTemplateSize);
+            }
+
+            // all positions in the same run of digits end at the same place
+            const size_type next = (first.kind == OutputTemplate::Element::Kind::TEXT) ? candidate + 1 : firstEnd;
+            candidate = _FindCandidate(first, next);
+        }
+
+        _Remember(from, first.templatePosition);
+        return std::nullopt;
+    }
+
+    std::optional<size_type>
+    _MatchBlock(const OutputTemplate::Block &block, const size_type firstElement, size_type position)
+    {
+        for (auto i = firstElement; i < block.size(); ++i) {
+            const auto end = _MatchElement(block[i], position);
+            if (!end.has_value()) {
+                return std::nullopt;
+            }
+
+            position = *end;
+        }
+
+        return position;
+    }
+
+    std::optional<size_type>
+    _MatchElement(const OutputTemplate::Element &element, const size_type position)
+    {
+        switch (element.kind) {
+            case OutputTemplate::Element::Kind::TEXT:
+                return _MatchText(element, position);
+
+            case OutputTemplate::Element::Kind::INTEGER:
+                return _MatchDigits(element, position, _SkipSign(position), is_digit);
+
+            case OutputTemplate::Element::Kind::HEX:
+                return _MatchDigits(element, position, _SkipHexPrefix(position), is_hex_digit);
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<size_type>
+    _MatchText(const OutputTemplate::Element &element, const size_type position)
+    {
+        const std::string_view rest = fOutput.substr(position);
+        const auto size = std::min(rest.size(), element.text.size());
+        const auto difference = std::mismatch(element.text.begin(), element.text.begin() + size, rest.begin());
+        const auto matched = static_cast<size_type>(difference.first - element.text.begin());
+
+        if (matched == element.text.size()) {
+            return position + matched;
+        }
+
+        _Remember(position + matched, element.templatePosition + matched);
+        return std::nullopt;
+    }
+
+    template<class DigitPredicate>
+    std::optional<size_type>
+    _MatchDigits(const OutputTemplate::Element &element,
+                 const size_type position,
+                 const size_type digitsBegin,
+                 DigitPredicate isDigit)
+    {
+        const auto digitsEnd = std::find_if_not(fOutput.begin() + digitsBegin, fOutput.end(), isDigit);
+        const auto end = static_cast<size_type>(digitsEnd - fOutput.begin());
+
+        if (end == digitsBegin) {
+            _Remember(position, element.templatePosition);
+            return std::nullopt;
+        }
+
+        return end;
+    }
+
+    size_type
+    _SkipSign(const size_type position) const
+    {
+        if (position + 1 < fOutput.size() && fOutput[position] == '-' && is_digit(fOutput[position + 1])) {
+            return position + 1;
+        }
+
+        return position;
+    }
+
+    size_type
+    _SkipHexPrefix(const size_type position) const
+    {
+        if (position + 2 < fOutput.size()
+            && fOutput[position] == '0'
+            && (fOutput[position + 1] == 'x' || fOutput[position + 1] == 'X')
+            && is_hex_digit(fOutput[position + 2])) {
+            return position + 2;
+        }
+
+        return position;
+    }
+
+    size_type
+    _FindCandidate(const OutputTemplate::Element &element, const size_type from) const
+    {
+        if (from > fOutput.size()) {
+            return std::string_view::npos;
+        }
+
+        auto found = fOutput.end();
+        switch (element.kind) {
+            case OutputTemplate::Element::Kind::TEXT:
+                return fOutput.find(element.text, from);
+
+            case OutputTemplate::Element::Kind::INTEGER:
+                found = std::find_if(fOutput.begin() + from, fOutput.end(), is_digit);
+                if (found != fOutput.end() && found != fOutput.begin() + from && *(found - 1) == '-') {
+                    --found;
+                }
+                break;
+
+            case OutputTemplate::Element::Kind::HEX:
+                found = std::find_if(fOutput.begin() + from, fOutput.end(), is_hex_digit);
+                break;
+        }
+
+        return (found != fOutput.end()) ? static_cast<size_type>(found - fOutput.begin()) : std::string_view::npos;
+    }
+
+    void
+    _Remember(const size_type outputPosition, const size_type templatePosition)
+    {
+        if (!fMismatch.has_value() || outputPosition > fMismatch->outputPosition) {
+            fMismatch = OutputTemplate::Mismatch{outputPosition, templatePosition};
+        }
+    }
+
+private:
+    const std::string_view                   fOutput;
+    const size_type                          fTemplateSize;
+    std::optional<OutputTemplate::Mismatch>  fMismatch;
+};
+
+OutputTemplate::OutputTemplate(const std::string_view &source)
+    :
+    fSize(source.size()),
+    fBlocks(1)
+{
+    size_type textBegin = 0;
+    size_type searchFrom = 0;
+
+    while (true) {
+        const size_type begin = source.find(PLACEHOLDER_BEGIN, searchFrom);
+        if (begin == std::string_view::npos) {
+            break;
+        }
+
+        const size_type nameBegin = begin + PLACEHOLDER_BEGIN.size();
+        const size_type end = source.find(PLACEHOLDER_END, nameBegin);
+        if (end == std::string_view::npos) {
+            break;
+        }
+
+        const std::string_view name = source.substr(nameBegin, end - nameBegin);
+        const std::string_view placeholder = source.substr(begin, end + PLACEHOLDER_END.size() - begin);
+
+        if (!looks_like_placeholder_name(name)) {
+            searchFrom = begin + 1;
+            continue;
+        }
+
+        _AddText(source, textBegin, begin);
+
+        if (name == "*") {
+            // {{*}}{{*}} is the same as {{*}}
+            if (!(fBlocks.size() > 1 && fBlocks.back().empty())) {
+                fBlocks.emplace_back();
+            }
+        }
+        else if (name == "int") {
+            _AddElement({Element::Kind::INTEGER, placeholder, begin});
+        }
+        else if (name == "hex") {
+            _AddElement({Element::Kind::HEX, placeholder, begin});
+        }
+        else {
+            throw exception::TemplateSyntaxException(placeholder, begin);
+        }
+
+        textBegin = searchFrom = begin + placeholder.size();
+    }
+
+    _AddText(source, textBegin, source.size());
+}
+
+std::optional<OutputTemplate::Mismatch>
+OutputTemplate::Match(const std::string_view &output) const
+{
+    OutputTemplateMatching matching(output, fSize);
+    return matching.Match(fBlocks);
+}
+
+void
+OutputTemplate::_AddText(const std::string_view &source, const size_type begin, const size_type end)
+{
+    if (begin < end) {
+        _AddElement({Element::Kind::TEXT, source.substr(begin, end - begin), begin});
+    }
+}
+
+void
+OutputTemplate::_AddElement(Element &&element)
+{
+    fBlocks.back().push_back(std::move(element));
+}
+
+}  // omtt::expectation::detail
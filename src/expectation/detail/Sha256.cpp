@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/expectation/detail/Sha256.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+constexpr std::array<std::uint32_t, 64> ROUND_CONSTANTS = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+constexpr std::array<std::uint32_t, 8> INITIAL_STATE = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+inline std::uint32_t
+rotate_right(const std::uint32_t value, const int bits)
+{
+    return (value >> bits) | (value << (32 - bits));
+}
+
+inline std::uint32_t
+load_big_endian(const unsigned char *bytes)
+{
+    return (static_cast<std::uint32_t>(bytes[0]) << 24)
+           | (static_cast<std::uint32_t>(bytes[1]) << 16)
+           | (static_cast<std::uint32_t>(bytes[2]) << 8)
+           | static_cast<std::uint32_t>(bytes[3]);
+}
+
+int
+hex_value(const char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+}
+
+Sha256::Sha256()
+{
+    Reset();
+}
+
+void
+Sha256::Reset()
+{
+    fState = INITIAL_STATE;
+    fBuffered = 0;
+    fLength = 0;
+}
+
+void
+Sha256::Update(const std::string_view &chunk)
+{
+    const auto *data = reinterpret_cast<const unsigned char *>(chunk.data());
+    std::size_t size = chunk.size();
+
+    fLength += size;
+
+    if (fBuffered > 0) {
+        const std::size_t copied = std::min(BLOCK_SIZE - fBuffered, size);
+        std::memcpy(fBuffer.data() + fBuffered, data, copied);
+        fBuffered += copied;
+        data += copied;
+        size -= copied;
+
+        if (fBuffered < BLOCK_SIZE) {
+            return;
+        }
+
+        _Compress(fBuffer.data());
+        fBuffered = 0;
+    }
+
+    for (; size >= BLOCK_SIZE; data += BLOCK_SIZE, size -= BLOCK_SIZE) {
+        _Compress(data);
+    }
+
+    std::memcpy(fBuffer.data(), data, size);
+    fBuffered = size;
+}
+
+Sha256::Digest
+Sha256::GetDigest() const
+{
+    Sha256 padded(*this);
+
+    const std::uint64_t lengthInBits = fLength * 8;
+
+    // the text is followed by one bit, zeros and its length
+    std::array<unsigned char, BLOCK_SIZE + 8> padding{};
+    padding[0] = 0x80;
+    const std::size_t zeros = (fBuffered < 56) ? (56 - fBuffered) : (BLOCK_SIZE + 56 - fBuffered);
+    for (int i = 0; i < 8; ++i) {
+        padding[zeros + i] = static_cast<unsigned char>(lengthInBits >> (56 - 8 * i));
+    }
+    padded.Update(std::string_view(reinterpret_cast<const char *>(padding.data()), zeros + 8));
+
+    Digest digest;
+    for (std::size_t i = 0; i < padded.fState.size(); ++i) {
+        digest[4 * i] = static_cast<std::uint8_t>(padded.fState[i] >> 24);
+        digest[4 * i + 1] = static_cast<std::uint8_t>(padded.fState[i] >> 16);
+        digest[4 * i + 2] = static_cast<std::uint8_t>(padded.fState[i] >> 8);
+        digest[4 * i + 3] = static_cast<std::uint8_t>(padded.fState[i]);
+    }
+
+    return digest;
+}
+
+void
+Sha256::_Compress(const unsigned char *block)
+{
+    std::array<std::uint32_t, 64> schedule;
+
+    for (int i = 0; i < 16; ++i) {
+        schedule[i] = load_big_endian(block + 4 * i);
+    }
+    for (int i = 16; i < 64; ++i) {
+        const std::uint32_t s0 = rotate_right(schedule[i - 15], 7) ^ rotate_right(schedule[i - 15], 18) ^ (schedule[i - 15] >> 3);
+        const std::uint32_t s1 = rotate_right(schedule[i - 2], 17) ^ rotate_right(schedule[i - 2], 19) ^ (schedule[i - 2] >> 10);
+        schedule[i] = schedule[i - 16] + s0 + schedule[i - 7] + s1;
+    }
+
+    std::uint32_t a = fState[0], b = fState[1], c = fState[2], d = fState[3];
+    std::uint32_t e = fState[4], f = fState[5], g = fState[6], h = fState[7];
+
+    for (int i = 0; i < 64; ++i) {
+        const std::uint32_t s1 = rotate_right(e, 6) ^ rotate_right(e, 11) ^ rotate_right(e, 25);
+        const std::uint32_t choice = (e & f) ^ (~e & g);
+        const std::uint32_t t1 = h + s1 + choice + ROUND_CONSTANTS[i] + schedule[i];
+        const std::uint32_t s0 = rotate_right(a, 2) ^ rotate_right(a, 13) ^ rotate_right(a, 22);
+        const std::uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        const std::uint32_t t2 = s0 + majority;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    fState[0] += a;
+    fState[1] += b;
+    fState[2] += c;
+    fState[3] += d;
+    fState[4] += e;
+    fState[5] += f;
+    fState[6] += g;
+    fState[7] += h;
+}
+
+std::string
+to_hex(const Sha256::Digest &digest)
+{
+    constexpr const char *digits = "0123456789abcdef";
+
+    std::string hex;
+    hex.reserve(2 * digest.size());
+    for (const std::uint8_t byte : digest) {
+        hex += digits[byte >> 4];
+        hex += digits[byte & 0x0f];
+    }
+
+    return hex;
+}
+
+std::optional<Sha256::Digest>
+parse_digest(const std::string_view &text)
+{
+    Sha256::Digest digest;
+
+    if (text.size() != 2 * digest.size()) {
+        return std::nullopt;
+    }
+
+    for (std::size_t i = 0; i < digest.size(); ++i) {
+        const int high = hex_value(text[2 * i]);
+        const int low = hex_value(text[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return std::nullopt;
+        }
+        digest[i] = static_cast<std::uint8_t>(high << 4 | low);
+    }
+
+    return digest;
+}
+
+}  // omtt::expectation::detail
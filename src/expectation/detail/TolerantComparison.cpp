@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "config.h"
+
+#include "headers/expectation/detail/TolerantComparison.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef HAVE_FLOATING_POINT_FROM_CHARS
+#include <charconv>
+#else
+#include <cerrno>
+#include <cstdlib>
+#include <string>
+#endif
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+typedef std::string_view::size_type size_type;
+
+bool
+is_digit(const char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+size_type
+digits_size(const std::string_view &text, size_type i)
+{
+    const size_type begin = i;
+    while (i < text.size() && is_digit(text[i])) {
+        ++i;
+    }
+    return i - begin;
+}
+
+// numbers are not searched inside words, like "x64" or "v1.2"
+bool
+can_begin_number(const std::string_view &text, const size_type i)
+{
+    if (i == 0) {
+        return true;
+    }
+
+    const char previous = text[i - 1];
+    return !(is_digit(previous)
+             || (previous >= 'a' && previous <= 'z')
+             || (previous >= 'A' && previous <= 'Z')
+             || previous == '_' || previous == '.');
+}
+
+size_type
+number_size_at(const std::string_view &text, const size_type i)
+{
+    if (!can_begin_number(text, i)) {
+        return 0;
+    }
+
+    return number_size(text.substr(i));
+}
+
+}
+
+size_type
+number_size(const std::string_view &text)
+{
+    size_type i = 0;
+
+    if (i < text.size() && text[i] == '-') {
+        ++i;
+    }
+
+    const size_type integerSize = digits_size(text, i);
+    i += integerSize;
+
+    size_type fractionSize = 0;
+    if (i + 1 < text.size() && text[i] == '.' && is_digit(text[i + 1])) {
+        fractionSize = digits_size(text, i + 1);
+        i += 1 + fractionSize;
+    }
+
+    if (integerSize == 0 && fractionSize == 0) {
+        return 0;
+    }
+
+    if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+        size_type exponent = i + 1;
+        if (exponent < text.size() && (text[exponent] == '-' || text[exponent] == '+')) {
+            ++exponent;
+        }
+
+        const size_type exponentSize = digits_size(text, exponent);
+        if (exponentSize > 0) {
+            i = exponent + exponentSize;
+        }
+    }
+
+    return i;
+}
+
+std::optional<double>
+parse_number(const std::string_view &text)
+{
+    if (text.empty() || number_size(text) != text.size()) {
+        return std::nullopt;
+    }
+
+#ifdef HAVE_FLOATING_POINT_FROM_CHARS
+    double value = 0;
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+        return std::nullopt;
+    }
+    return value;
+#else
+    const std::string copy(text);
+    char *end = nullptr;
+
+    errno = 0;
+    const double value = std::strtod(copy.c_str(), &end);
+    if (errno == ERANGE || end != copy.c_str() + copy.size()) {
+        return std::nullopt;
+    }
+    return value;
+#endif
+}
+
+bool
+is_within_tolerance(const double expected, const double actual, const Tolerance &tolerance)
+{
+    const double difference = std::fabs(expected - actual);
+
+    return difference <= tolerance.absolute
+           || difference <= tolerance.relative * std::max(std::fabs(expected), std::fabs(actual));
+}
+
+std::optional<ToleranceMismatch>
+compare_with_tolerance(const std::string_view &expected,
+                       const std::string_view &output,
+                       const Tolerance &tolerance)
+{
+    size_type i = 0, j = 0;
+
+    while (i < expected.size() && j < output.size()) {
+        const size_type expectedNumberSize = number_size_at(expected, i);
+        const size_type outputNumberSize = (expectedNumberSize > 0) ? number_size_at(output, j) : 0;
+
+        if (expectedNumberSize > 0 && outputNumberSize > 0) {
+            const auto expectedNumber = expected.substr(i, expectedNumberSize);
+            const auto outputNumber = output.substr(j, outputNumberSize);
+            const auto expectedValue = parse_number(expectedNumber);
+            const auto outputValue = parse_number(outputNumber);
+
+            // numbers out of the double range have to be written the same way
+            const bool isMatching = (expectedValue && outputValue)
+                                    ? is_within_tolerance(*expectedValue, *outputValue, tolerance)
+                                    : expectedNumber == outputNumber;
+            if (!isMatching) {
+                return ToleranceMismatch{i, j, expectedNumberSize, outputNumberSize};
+            }
+
+            i += expectedNumberSize;
+            j += outputNumberSize;
+            continue;
+        }
+
+        if (expected[i] != output[j]) {
+            return ToleranceMismatch{i, j, 0, 0};
+        }
+
+        ++i;
+        ++j;
+    }
+
+    if (i != expected.size() || j != output.size()) {
+        return ToleranceMismatch{i, j, 0, 0};
+    }
+
+    return std::nullopt;
+}
+
+}  // omtt::expectation::detail
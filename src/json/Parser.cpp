@@ -0,0 +1,583 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/json/Parser.hpp"
+
+
+namespace omtt::json
+{
+
+namespace
+{
+
+typedef std::string_view::size_type size_type;
+
+bool
+is_white_space(const char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+bool
+is_digit(const char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// bytes which end the plain part of a string
+bool
+is_special_in_string(const char c)
+{
+    return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+}
+
+int
+hex_digit_value(const char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+std::string
+describe(const char c)
+{
+    if (static_cast<unsigned char>(c) < 0x20 || static_cast<unsigned char>(c) >= 0x7f) {
+        constexpr char digits[] = "0123456789abcdef";
+        const auto byte = static_cast<unsigned char>(c);
+        return std::string("byte 0x") + digits[byte >> 4] + digits[byte & 0xf];
+    }
+
+    return std::string("character '") + c + "'";
+}
+
+}
+
+Parser::Parser(Handler &handler)
+    :
+    fHandler(handler),
+    fState(State::VALUE),
+    fOffset(0),
+    fIsKey(false),
+    fNumberState(NumberState::START),
+    fEscapeState(EscapeState::NONE),
+    fCodeUnit(0),
+    fCodeUnitDigits(0),
+    fHighSurrogate(0),
+    fLiteralSize(0)
+{
+}
+
+bool
+Parser::Feed(const std::string_view &chunk)
+{
+    size_type i = 0;
+
+    while (i < chunk.size()) {
+        switch (fState) {
+            case State::STRING:
+                i = _ReadString(chunk, i);
+                break;
+
+            case State::NUMBER:
+                i = _ReadNumber(chunk, i);
+                break;
+
+            case State::LITERAL:
+                i = _ReadLiteral(chunk, i);
+                break;
+
+            case State::ERROR:
+                return false;
+
+            default:
+                i = _ReadStructural(chunk, i);
+                break;
+        }
+    }
+
+    fOffset += chunk.size();
+    return fState != State::ERROR;
+}
+
+bool
+Parser::Finish()
+{
+    if (fState == State::NUMBER && _IsNumberComplete()) {
+        _EmitNumber();
+    }
+
+    if (fState != State::END && fState != State::ERROR) {
+        _SetError("unexpected end of text", 0);
+    }
+
+    return fState != State::ERROR;
+}
+
+bool
+Parser::HasError() const
+{
+    return fState == State::ERROR;
+}
+
+const std::string &
+Parser::GetError() const
+{
+    return fError;
+}
+
+size_type
+Parser::_ReadStructural(const std::string_view &chunk, size_type i)
+{
+    while (i < chunk.size() && is_white_space(chunk[i])) {
+        ++i;
+    }
+    if (i == chunk.size()) {
+        return i;
+    }
+
+    const char c = chunk[i];
+    switch (fState) {
+        case State::VALUE_OR_ARRAY_END:
+            if (c == ']') {
+                _EndContainer(c);
+                return i + 1;
+            }
+            [[fallthrough]];
+
+        case State::VALUE:
+            if (c == '{' || c == '[' || c == '"') {
+                _BeginValue(c);
+                return i + 1;
+            }
+            if (c == '-' || is_digit(c) || c == 't' || c == 'f' || c == 'n') {
+                // the first byte is read again by the token reader
+                _BeginValue(c);
+                return i;
+            }
+            break;
+
+        case State::KEY_OR_OBJECT_END:
+            if (c == '}') {
+                _EndContainer(c);
+                return i + 1;
+            }
+            [[fallthrough]];
+
+        case State::KEY:
+            if (c == '"') {
+                fState = State::STRING;
+                fIsKey = true;
+                fToken.clear();
+                return i + 1;
+            }
+            _SetError("expected member name, got " + describe(c), i);
+            return i;
+
+        case State::COLON:
+            if (c == ':') {
+                fState = State::VALUE;
+                return i + 1;
+            }
+            _SetError("expected ':', got " + describe(c), i);
+            return i;
+
+        case State::COMMA_OR_END:
+            if (c == ',') {
+                fState = (fContainers.back() == '{') ? State::KEY : State::VALUE;
+                return i + 1;
+            }
+            if ((c == '}' && fContainers.back() == '{') || (c == ']' && fContainers.back() == '[')) {
+                _EndContainer(c);
+                return i + 1;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    _SetError("unexpected " + describe(c), i);
+    return i;
+}
+
+void
+Parser::_BeginValue(const char character)
+{
+    switch (character) {
+        case '{':
+            fContainers.push_back('{');
+            fState = State::KEY_OR_OBJECT_END;
+            fHandler.OnObjectBegin();
+            break;
+
+        case '[':
+            fContainers.push_back('[');
+            fState = State::VALUE_OR_ARRAY_END;
+            fHandler.OnArrayBegin();
+            break;
+
+        case '"':
+            fState = State::STRING;
+            fIsKey = false;
+            fToken.clear();
+            break;
+
+        case 't':
+            fState = State::LITERAL;
+            fLiteral = "true";
+            fLiteralSize = 0;
+            break;
+
+        case 'f':
+            fState = State::LITERAL;
+            fLiteral = "false";
+            fLiteralSize = 0;
+            break;
+
+        case 'n':
+            fState = State::LITERAL;
+            fLiteral = "null";
+            fLiteralSize = 0;
+            break;
+
+        default:
+            fState = State::NUMBER;
+            fNumberState = NumberState::START;
+            fToken.clear();
+            break;
+    }
+}
+
+void
+Parser::_EndContainer(const char character)
+{
+    fContainers.pop_back();
+
+    if (character == '}') {
+        fHandler.OnObjectEnd();
+    }
+    else {
+        fHandler.OnArrayEnd();
+    }
+
+    _AfterValue();
+}
+
+void
+Parser::_AfterValue()
+{
+    fState = fContainers.empty() ? State::END : State::COMMA_OR_END;
+}
+
+size_type
+Parser::_ReadString(const std::string_view &chunk, size_type i)
+{
+    while (i < chunk.size()) {
+        if (fEscapeState != EscapeState::NONE) {
+            _ReadEscape(chunk[i]);
+            if (fState == State::ERROR) {
+                _SetError("invalid escape sequence in string", i);
+                return i;
+            }
+            ++i;
+            continue;
+        }
+
+        // the plain part of the string is copied at once
+        size_type end = i;
+        while (end < chunk.size() && !is_special_in_string(chunk[end])) {
+            ++end;
+        }
+        if (end > i) {
+            _FlushHighSurrogate();
+            fToken.append(chunk.data() + i, end - i);
+            i = end;
+        }
+        if (i == chunk.size()) {
+            break;
+        }
+
+        const char c = chunk[i];
+        if (c == '\\') {
+            fEscapeState = EscapeState::BACKSLASH;
+            ++i;
+        }
+        else if (c == '"') {
+            _FlushHighSurrogate();
+            if (fIsKey) {
+                fState = State::COLON;
+                fHandler.OnKey(fToken);
+            }
+            else {
+                _AfterValue();
+                fHandler.OnString(fToken);
+            }
+            return i + 1;
+        }
+        else {
+            _SetError("unescaped " + describe(c) + " in string", i);
+            return i;
+        }
+    }
+
+    return i;
+}
+
+void
+Parser::_ReadEscape(const char character)
+{
+    if (fEscapeState == EscapeState::UNICODE) {
+        const int digit = hex_digit_value(character);
+        if (digit < 0) {
+            fState = State::ERROR;
+            return;
+        }
+
+        fCodeUnit = fCodeUnit * 16 + digit;
+        if (++fCodeUnitDigits == 4) {
+            fEscapeState = EscapeState::NONE;
+            _AppendCodeUnit(fCodeUnit);
+        }
+        return;
+    }
+
+    fEscapeState = EscapeState::NONE;
+
+    char unescaped;
+    switch (character) {
+        case '"': unescaped = '"'; break;
+        case '\\': unescaped = '\\'; break;
+        case '/': unescaped = '/'; break;
+        case 'b': unescaped = '\b'; break;
+        case 'f': unescaped = '\f'; break;
+        case 'n': unescaped = '\n'; break;
+        case 'r': unescaped = '\r'; break;
+        case 't': unescaped = '\t'; break;
+        case 'u':
+            fEscapeState = EscapeState::UNICODE;
+            fCodeUnit = 0;
+            fCodeUnitDigits = 0;
+            return;
+        default:
+            fState = State::ERROR;
+            return;
+    }
+
+    _FlushHighSurrogate();
+    fToken.push_back(unescaped);
+}
+
+void
+Parser::_AppendCodeUnit(const std::uint32_t codeUnit)
+{
+    const bool isHighSurrogate = (codeUnit >= 0xD800 && codeUnit <= 0xDBFF);
+    const bool isLowSurrogate = (codeUnit >= 0xDC00 && codeUnit <= 0xDFFF);
+
+    if (isLowSurrogate && fHighSurrogate != 0) {
+        _AppendCodePoint(0x10000 + ((fHighSurrogate - 0xD800) << 10) + (codeUnit - 0xDC00));
+        fHighSurrogate = 0;
+        return;
+    }
+
+    _FlushHighSurrogate();
+
+    if (isHighSurrogate) {
+        fHighSurrogate = codeUnit;
+    }
+    else {
+        _AppendCodePoint(codeUnit);
+    }
+}
+
+void
+Parser::_AppendCodePoint(const std::uint32_t codePoint)
+{
+    if (codePoint < 0x80) {
+        fToken.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800) {
+        fToken.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        fToken.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000) {
+        fToken.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        fToken.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        fToken.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else {
+        fToken.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        fToken.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        fToken.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        fToken.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+void
+Parser::_FlushHighSurrogate()
+{
+    // a surrogate without its pair is kept as it is, the same way in both compared texts
+    if (fHighSurrogate != 0) {
+        _AppendCodePoint(fHighSurrogate);
+        fHighSurrogate = 0;
+    }
+}
+
+size_type
+Parser::_ReadNumber(const std::string_view &chunk, size_type i)
+{
+    const size_type begin = i;
+
+    for (; i < chunk.size(); ++i) {
+        const char c = chunk[i];
+        bool isAccepted = true;
+
+        switch (fNumberState) {
+            case NumberState::START:
+                if (c == '-' && fToken.empty() && i == begin) {
+                    break;
+                }
+                if (c == '0') {
+                    fNumberState = NumberState::ZERO;
+                }
+                else if (is_digit(c)) {
+                    fNumberState = NumberState::INTEGER;
+                }
+                else {
+                    isAccepted = false;
+                }
+                break;
+
+            case NumberState::INTEGER:
+                if (is_digit(c)) {
+                    break;
+                }
+                [[fallthrough]];
+
+            case NumberState::ZERO:
+                if (c == '.') {
+                    fNumberState = NumberState::DOT;
+                }
+                else if (c == 'e' || c == 'E') {
+                    fNumberState = NumberState::EXPONENT;
+                }
+                else {
+                    isAccepted = false;
+                }
+                break;
+
+            case NumberState::DOT:
+            case NumberState::FRACTION:
+                if (is_digit(c)) {
+                    fNumberState = NumberState::FRACTION;
+                }
+                else if ((c == 'e' || c == 'E') && fNumberState == NumberState::FRACTION) {
+                    fNumberState = NumberState::EXPONENT;
+                }
+                else {
+                    isAccepted = false;
+                }
+                break;
+
+            case NumberState::EXPONENT:
+                if (c == '+' || c == '-') {
+                    fNumberState = NumberState::EXPONENT_SIGN;
+                }
+                else if (is_digit(c)) {
+                    fNumberState = NumberState::EXPONENT_DIGITS;
+                }
+                else {
+                    isAccepted = false;
+                }
+                break;
+
+            case NumberState::EXPONENT_SIGN:
+            case NumberState::EXPONENT_DIGITS:
+                if (is_digit(c)) {
+                    fNumberState = NumberState::EXPONENT_DIGITS;
+                }
+                else {
+                    isAccepted = false;
+                }
+                break;
+        }
+
+        if (!isAccepted) {
+            fToken.append(chunk.data() + begin, i - begin);
+
+            if (!_IsNumberComplete()) {
+                _SetError("invalid number", i);
+                return i;
+            }
+
+            // the byte after the number is read by the structural reader
+            _EmitNumber();
+            return i;
+        }
+    }
+
+    fToken.append(chunk.data() + begin, i - begin);
+    return i;
+}
+
+bool
+Parser::_IsNumberComplete() const
+{
+    return fNumberState == NumberState::ZERO
+           || fNumberState == NumberState::INTEGER
+           || fNumberState == NumberState::FRACTION
+           || fNumberState == NumberState::EXPONENT_DIGITS;
+}
+
+void
+Parser::_EmitNumber()
+{
+    _AfterValue();
+    fHandler.OnNumber(fToken);
+}
+
+size_type
+Parser::_ReadLiteral(const std::string_view &chunk, size_type i)
+{
+    while (i < chunk.size() && fLiteralSize < fLiteral.size()) {
+        if (chunk[i] != fLiteral[fLiteralSize]) {
+            _SetError("invalid literal, expected '" + std::string(fLiteral) + "'", i);
+            return i;
+        }
+        ++fLiteralSize;
+        ++i;
+    }
+
+    if (fLiteralSize == fLiteral.size()) {
+        _AfterValue();
+        if (fLiteral == "null") {
+            fHandler.OnNull();
+        }
+        else {
+            fHandler.OnBoolean(fLiteral == "true");
+        }
+    }
+
+    return i;
+}
+
+void
+Parser::_SetError(const std::string &message, const size_type i)
+{
+    fState = State::ERROR;
+    fError = message + " at byte " + std::to_string(fOffset + i);
+}
+
+}  // omtt::json
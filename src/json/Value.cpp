@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/json/Value.hpp"
+#include "headers/json/Parser.hpp"
+#include "headers/json/exception/SyntaxException.hpp"
+
+#include <algorithm>
+
+
+namespace omtt::json
+{
+
+namespace
+{
+
+constexpr std::string::size_type MAX_DESCRIPTION_SIZE = 40;
+constexpr std::int64_t MAX_EXPONENT = INT64_C(1) << 60;
+
+class ValueBuilder : public Handler
+{
+public:
+    void
+    OnNull() override
+    {
+        _Add({Value::Kind::NULL_VALUE, false, {}, {}, {}, {}, {}});
+    }
+
+    void
+    OnBoolean(const bool value) override
+    {
+        _Add({Value::Kind::BOOLEAN, value, {}, {}, {}, {}, {}});
+    }
+
+    void
+    OnNumber(const std::string_view &number) override
+    {
+        _Add({Value::Kind::NUMBER, false, std::string(number), canonical_number(number), {}, {}, {}});
+    }
+
+    void
+    OnString(const std::string_view &value) override
+    {
+        _Add({Value::Kind::STRING, false, std::string(value), {}, {}, {}, {}});
+    }
+
+    void
+    OnKey(const std::string_view &key) override
+    {
+        fOpened.back().keys.emplace_back(key);
+    }
+
+    void
+    OnObjectBegin() override
+    {
+        fOpened.push_back({Value::Kind::OBJECT, false, {}, {}, {}, {}, {}});
+    }
+
+    void
+    OnObjectEnd() override
+    {
+        Value &object = fOpened.back();
+
+        object.sortedMembers.resize(object.keys.size());
+        for (std::uint32_t i = 0; i < object.sortedMembers.size(); ++i) {
+            object.sortedMembers[i] = i;
+        }
+        std::stable_sort(object.sortedMembers.begin(), object.sortedMembers.end(),
+                         [&object](const std::uint32_t a, const std::uint32_t b) {
+                             return object.keys[a] < object.keys[b];
+                         });
+
+        for (std::size_t i = 1; i < object.sortedMembers.size(); ++i) {
+            const std::string &key = object.keys[object.sortedMembers[i]];
+            if (key == object.keys[object.sortedMembers[i - 1]]) {
+                throw exception::SyntaxException("duplicated member " + describe_string(key));
+            }
+        }
+
+        _Close();
+    }
+
+    void
+    OnArrayBegin() override
+    {
+        fOpened.push_back({Value::Kind::ARRAY, false, {}, {}, {}, {}, {}});
+    }
+
+    void
+    OnArrayEnd() override
+    {
+        _Close();
+    }
+
+    Value &&
+    TakeRoot()
+    {
+        return std::move(fRoot);
+    }
+
+private:
+    void
+    _Close()
+    {
+        Value value = std::move(fOpened.back());
+        fOpened.pop_back();
+        _Add(std::move(value));
+    }
+
+    void
+    _Add(Value &&value)
+    {
+        if (fOpened.empty()) {
+            fRoot = std::move(value);
+        }
+        else {
+            fOpened.back().items.push_back(std::move(value));
+        }
+    }
+
+private:
+    std::vector<Value>  fOpened;
+    Value               fRoot;
+};
+
+}
+
+std::size_t
+Value::FindMember(const std::string_view &key) const
+{
+    const auto found = std::lower_bound(sortedMembers.begin(), sortedMembers.end(), key,
+                                        [this](const std::uint32_t member, const std::string_view &searched) {
+                                            return keys[member] < searched;
+                                        });
+
+    if (found == sortedMembers.end() || keys[*found] != key) {
+        return NOT_FOUND;
+    }
+
+    return *found;
+}
+
+Value
+parse(const std::string_view &text)
+{
+    ValueBuilder builder;
+    Parser parser(builder);
+
+    if (!parser.Feed(text) || !parser.Finish()) {
+        throw exception::SyntaxException(parser.GetError());
+    }
+
+    return builder.TakeRoot();
+}
+
+std::string
+canonical_number(const std::string_view &number)
+{
+    std::string::size_type i = 0;
+
+    const bool isNegative = (number[i] == '-');
+    if (isNegative) {
+        ++i;
+    }
+
+    std::string digits;
+    std::int64_t pointPosition = 0;
+
+    for (; i < number.size() && number[i] >= '0' && number[i] <= '9'; ++i) {
+        digits.push_back(number[i]);
+        ++pointPosition;
+    }
+
+    if (i < number.size() && number[i] == '.') {
+        for (++i; i < number.size() && number[i] >= '0' && number[i] <= '9'; ++i) {
+            digits.push_back(number[i]);
+        }
+    }
+
+    if (i < number.size() && (number[i] == 'e' || number[i] == 'E')) {
+        ++i;
+        const bool isExponentNegative = (number[i] == '-');
+        if (number[i] == '-' || number[i] == '+') {
+            ++i;
+        }
+
+        std::int64_t exponent = 0;
+        for (; i < number.size(); ++i) {
+            exponent = std::min(exponent * 10 + (number[i] - '0'), MAX_EXPONENT);
+        }
+        pointPosition += isExponentNegative ? -exponent : exponent;
+    }
+
+    const auto firstNonZero = digits.find_first_not_of('0');
+    if (firstNonZero == std::string::npos) {
+        return "0";
+    }
+
+    pointPosition -= static_cast<std::int64_t>(firstNonZero);
+    digits.erase(digits.find_last_not_of('0') + 1);
+    digits.erase(0, firstNonZero);
+
+    return (isNegative ? "-" : "") + digits + "e" + std::to_string(pointPosition);
+}
+
+std::string
+describe(const Value &value)
+{
+    switch (value.kind) {
+        case Value::Kind::NULL_VALUE:
+            return "null";
+        case Value::Kind::BOOLEAN:
+            return value.boolean ? "true" : "false";
+        case Value::Kind::NUMBER:
+            return value.text;
+        case Value::Kind::STRING:
+            return describe_string(value.text);
+        case Value::Kind::ARRAY:
+            return "array";
+        case Value::Kind::OBJECT:
+            return "object";
+    }
+
+    return "";
+}
+
+std::string
+describe_string(const std::string_view &value)
+{
+    std::string description = "\"";
+
+    for (const char c : value.substr(0, MAX_DESCRIPTION_SIZE)) {
+        if (c == '"' || c == '\\') {
+            description.push_back('\\');
+            description.push_back(c);
+        }
+        else if (c == '\n') {
+            description += "\\n";
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            constexpr char digits[] = "0123456789abcdef";
+            description += "\\u00";
+            description.push_back(digits[(c >> 4) & 0xf]);
+            description.push_back(digits[c & 0xf]);
+        }
+        else {
+            description.push_back(c);
+        }
+    }
+
+    description += (value.size() > MAX_DESCRIPTION_SIZE) ? "...\"" : "\"";
+    return description;
+}
+
+}  // omtt::json
@@ -27,13 +27,39 @@ namespace
 {
 
 bool
-starts_with(const std::string_view &text, const std::string &value)
+starts_with(const std::string_view &text, const std::string_view &value)
 {
     return text.substr(0, value.length()) == value;
 }
 
 bool
-ends_with(const std::string_view &text, const std::string &value)
+is_clause_keyword(const std::string_view &word)
+{
+    return word == "FILE" || word == "MATCHES" || word == "SHA256";
+}
+
+// clause keywords followed by lines, not by the rest of the line
+bool
+is_block_clause_keyword(const std::string_view &word)
+{
+    return word == "TEMPLATE"
+           || word == "WITH"
+           || word == "IN" || word == "ORDER"
+           || word == "LINES" || word == "UNORDERED"
+           || word == "JSON"
+           || word == "SIZE" || word == "STARTS"
+           || word == "AT" || word == "LEAST" || word == "MOST";
+}
+
+// clause keywords followed by arguments in the same line and by lines
+bool
+is_clause_with_arguments_keyword(const std::string_view &word)
+{
+    return word == "TOLERANCE";
+}
+
+bool
+ends_with(const std::string_view &text, const std::string_view &value)
 {
     return text.length() >= value.length()
            && text.compare(text.length() - value.length(), value.length(), value) == 0;
@@ -45,7 +71,7 @@ prepare_unexpected_character_exception(const char character,
 {
     std::stringstream stream;
     stream << "Unexpected character '" << character << "' at " << position << " byte.";
-    return exception::UnexpectedCharacterException(stream.str());
+    return exception::UnexpectedCharacterException(stream.str(), position);
 }
 
 void
@@ -97,6 +123,15 @@ Lexer::FindNextToken()
         case State::READ_LINES_UP_TO_EXPECT:
             return _HandleReadingLinesUpToExpectState();
 
+        case State::READ_CLAUSE:
+            return _HandleReadingClauseState();
+
+        case State::READ_CLAUSE_ARGUMENTS:
+            return _HandleReadingClauseArgumentsState();
+
+        case State::READ_REST_OF_LINE:
+            return _HandleReadingRestOfLineState();
+
         case State::READ_INTEGER:
             return _HandleReadingInteger();
 
@@ -131,14 +166,12 @@ Lexer::_HandleReadingKeywordsState(Lexer::ReadingKeywordsStateOptions options)
 
     if (options == Lexer::ReadingKeywordsStateOptions::MOVE_TO_READING_LINES_STATE_AFTER_INPUT_OUTPUT
         && (word == "INPUT" || word == "OUTPUT")) {
-        _SwitchStateTo(State::READ_LINES_UP_TO_EXPECT);
-        _ConsumeWhiteCharactersWithoutNewLine();
-        _ConsumeNewLineCharacter();
+        _SwitchToReadingLinesOrClause();
     }
     if (word == "CODE") {
         _SwitchStateTo(State::READ_INTEGER);
     }
-    if (word == "EXPECT") {
+    if (word == "EXPECT" || word == "RUN") {
         _SwitchStateTo(State::READ_KEYWORDS_AND_MOVE_TO_READING_LINES);
     }
 
@@ -147,11 +180,18 @@ Lexer::_HandleReadingKeywordsState(Lexer::ReadingKeywordsStateOptions options)
         || word == "INPUT"
         || word == "EXPECT"
         || word == "OUTPUT"
+        || word == "ERROR"
         || word == "EXIT"
         || word == "CODE"
         || word == "IN"
         || word == "SUCCESS"
-        || word == "FAILURE") {
+        || word == "FAILURE"
+        || word == "NORMALIZE"
+        || word == "TRIM"
+        || word == "SQUEEZE"
+        || word == "MASK"
+        || word == "INT"
+        || word == "HEX") {
         return Token{TokenKind::KEYWORD, word};
     }
     else if (word == "EMPTY") {
@@ -176,7 +216,7 @@ Lexer::_HandleReadingLinesUpToExpectState()
     const PositionInBuffer beginOfLines = fCurrentPosition;
     const PositionInBuffer beginOfLinesWithNewLine = fCurrentPosition - 1;
 
-    auto endOfLines = fInputBuffer.find("\nEXPECT", beginOfLinesWithNewLine);
+    auto endOfLines = _FindEndOfLines(beginOfLinesWithNewLine);
     if (endOfLines == std::string::npos) {
         endOfLines = fInputBuffer.size();
     }
@@ -189,6 +229,84 @@ Lexer::_HandleReadingLinesUpToExpectState()
     return _ConsumeAndGetTokenWithText(beginOfLines, endOfLines);
 }
 
+std::optional<const Token>
+Lexer::_HandleReadingClauseState()
+{
+    _ConsumeWhiteCharactersWithoutNewLine();
+
+    if (_IsAtEndOfLine()) {
+        _ConsumeNewLineCharacter();
+        _SwitchStateTo(State::READ_LINES_UP_TO_EXPECT);
+        return _HandleReadingLinesUpToExpectState();
+    }
+
+    const PositionInBuffer wordBegin = fCurrentPosition;
+    const std::string_view word = _ReadNextWord();
+
+    if (is_clause_keyword(word)) {
+        _SwitchStateTo(State::READ_REST_OF_LINE);
+        return Token{TokenKind::KEYWORD, word};
+    }
+
+    if (is_block_clause_keyword(word)) {
+        _SwitchStateTo(State::READ_CLAUSE);
+        return Token{TokenKind::KEYWORD, word};
+    }
+
+    if (is_clause_with_arguments_keyword(word)) {
+        _SwitchStateTo(State::READ_CLAUSE_ARGUMENTS);
+        return Token{TokenKind::KEYWORD, word};
+    }
+
+    // the count ends the clause, it's not followed by lines
+    if (std::isdigit(static_cast<unsigned char>(word.front()))) {
+        throw_when_word_is_not_a_number(word, wordBegin);
+        _SwitchStateTo(State::READ_KEYWORDS_AND_MOVE_TO_READING_LINES);
+        return Token{TokenKind::INTEGER, word};
+    }
+
+    throw prepare_unexpected_character_exception(word.front(), wordBegin);
+}
+
+std::optional<const Token>
+Lexer::_HandleReadingClauseArgumentsState()
+{
+    _ConsumeWhiteCharactersWithoutNewLine();
+
+    if (_IsAtEndOfLine()) {
+        _ConsumeNewLineCharacter();
+        _SwitchStateTo(State::READ_LINES_UP_TO_EXPECT);
+        return _HandleReadingLinesUpToExpectState();
+    }
+
+    return Token{TokenKind::TEXT, _ReadNextWord()};
+}
+
+std::optional<const Token>
+Lexer::_HandleReadingRestOfLineState()
+{
+    _ConsumeWhiteCharactersWithoutNewLine();
+
+    const PositionInBuffer beginOfLine = fCurrentPosition;
+    PositionInBuffer endOfLine = std::min(fInputBuffer.find('\n', beginOfLine), fInputBuffer.size());
+    while (endOfLine > beginOfLine
+           && (fInputBuffer[endOfLine - 1] == ' ' || fInputBuffer[endOfLine - 1] == '\t')) {
+        --endOfLine;
+    }
+
+    auto token = _ConsumeAndGetTokenWithText(beginOfLine, endOfLine);
+
+    _ConsumeWhiteCharactersWithoutNewLine();
+    _ConsumeNewLineCharacter();
+    _SwitchStateTo(State::READ_KEYWORDS_AND_MOVE_TO_READING_LINES);
+
+    if (endOfLine == beginOfLine) {
+        return FindNextToken();
+    }
+
+    return token;
+}
+
 std::optional<const Token>
 Lexer::_HandleReadingInteger()
 {
@@ -210,6 +328,27 @@ Lexer::_HandleReadingInteger()
     }
 }
 
+Lexer::PositionInBuffer
+Lexer::_FindEndOfLines(const Lexer::PositionInBuffer begin) const
+{
+    const std::string_view buffer(fInputBuffer);
+    PositionInBuffer newLine = buffer.find('\n', begin);
+
+    while (newLine != std::string_view::npos) {
+        const std::string_view nextLine = buffer.substr(newLine + 1);
+
+        if (starts_with(nextLine, "EXPECT")
+            || (starts_with(nextLine, "RUN")
+                && (nextLine.length() == 3 || nextLine[3] == '\n'))) {
+            return newLine;
+        }
+
+        newLine = buffer.find('\n', newLine + 1);
+    }
+
+    return std::string_view::npos;
+}
+
 void
 Lexer::_SwitchStateTo(const State newState)
 {
@@ -257,6 +396,34 @@ Lexer::_ConsumeWhiteCharactersWithoutNewLine()
                                           [](auto c) { return c != ' ' && c != '\t'; });
 }
 
+bool
+Lexer::_IsAtEndOfLine() const
+{
+    return fCurrentPosition >= fInputBuffer.size()
+           || fInputBuffer[fCurrentPosition] == '\n';
+}
+
+void
+Lexer::_SwitchToReadingLinesOrClause()
+{
+    _ConsumeWhiteCharactersWithoutNewLine();
+
+    if (_IsAtEndOfLine()) {
+        _ConsumeNewLineCharacter();
+        _SwitchStateTo(State::READ_LINES_UP_TO_EXPECT);
+        return;
+    }
+
+    const PositionInBuffer wordEnd = _FindNextWhiteCharPosition(fCurrentPosition);
+    const std::string_view word(fInputBuffer.data() + fCurrentPosition, wordEnd - fCurrentPosition);
+
+    if (!is_clause_keyword(word) && !is_block_clause_keyword(word)) {
+        throw prepare_unexpected_character_exception(word.front(), fCurrentPosition);
+    }
+
+    _SwitchStateTo(State::READ_CLAUSE);
+}
+
 void
 Lexer::_ConsumeNewLineCharacter()
 {
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/AsyncLogger.hpp"
+#include "headers/system/Unix.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+
+namespace omtt::logger
+{
+
+namespace
+{
+
+// events written with one writev call
+constexpr std::size_t MAX_BATCH_EVENTS = 64;
+
+// bigger event buffers are released after the write
+constexpr std::size_t MAX_KEPT_EVENT_CAPACITY = 1024 * 1024;
+
+}
+
+AsyncLogger::EventBuffer::int_type
+AsyncLogger::EventBuffer::overflow(const int_type c)
+{
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        fText += traits_type::to_char_type(c);
+    }
+
+    return traits_type::not_eof(c);
+}
+
+std::streamsize
+AsyncLogger::EventBuffer::xsputn(const char *s, const std::streamsize count)
+{
+    fText.append(s, static_cast<std::size_t>(count));
+    return count;
+}
+
+AsyncLogger::AsyncLogger(const LoggerFactory &createLogger,
+                         const int fd,
+                         const std::size_t capacity)
+    :
+    fEventStream(&fEventBuffer),
+    fLogger(createLogger(fEventStream)),
+    fFd(fd),
+    fSlots(std::max<std::size_t>(capacity, 1)),
+    fHead(0),
+    fTail(0),
+    fIsWriterWaiting(false),
+    fIsProducerWaiting(false),
+    fIsStopped(false)
+{
+    // the signals are handled by the thread running the tests
+    sigset_t allSignals, previousSignals;
+    sigfillset(&allSignals);
+    system::unix::ThreadSignalMask(SIG_BLOCK, &allSignals, &previousSignals);
+
+    fWriter = std::thread(&AsyncLogger::_Write, this);
+
+    system::unix::ThreadSignalMask(SIG_SETMASK, &previousSignals, nullptr);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    _Stop();
+    fWriter.join();
+}
+
+void
+AsyncLogger::SutPath(const std::string &path)
+{
+    fLogger->SutPath(path);
+    _Publish();
+}
+
+void
+AsyncLogger::BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                                const omtt::TestPaths::size_type numberOfTests,
+                                const omtt::Path &testPath)
+{
+    fLogger->BeginTestExecution(executedTests, numberOfTests, testPath);
+    _Publish();
+}
+
+void
+AsyncLogger::EndTestExecution(const omtt::ProcessResults &processResults,
+                              const omtt::TestExecutionSummary &summary)
+{
+    fLogger->EndTestExecution(processResults, summary);
+    _Publish();
+}
+
+void
+AsyncLogger::OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                               const omtt::TestPaths::size_type numberOfTestsPassed,
+                               const omtt::TestPaths::size_type numberOfTestsFailed)
+{
+    fLogger->OverallStatistics(executedTests, numberOfTestsPassed, numberOfTestsFailed);
+    _Publish();
+}
+
+void
+AsyncLogger::Flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(fMutex);
+        fIsProducerWaiting.store(true);
+        fProducerWakeUp.wait(lock, [this] { return fHead.load() == fTail.load(std::memory_order_relaxed); });
+        fIsProducerWaiting.store(false);
+    }
+
+    if (fWriteError) {
+        std::rethrow_exception(std::exchange(fWriteError, nullptr));
+    }
+}
+
+void
+AsyncLogger::_Publish()
+{
+    std::string &text = fEventBuffer.Text();
+    if (text.empty()) {
+        return;
+    }
+
+    _WaitForFreeSlot();
+
+    // the strings are swapped, their memory is reused by the next events
+    const std::size_t tail = fTail.load(std::memory_order_relaxed);
+    fSlots[tail % fSlots.size()].swap(text);
+    text.clear();
+
+    fTail.store(tail + 1);
+    _WakeUpWriter();
+}
+
+void
+AsyncLogger::_WaitForFreeSlot()
+{
+    const auto hasFreeSlot = [this] {
+        return fTail.load(std::memory_order_relaxed) - fHead.load() < fSlots.size();
+    };
+
+    if (hasFreeSlot()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(fMutex);
+    fIsProducerWaiting.store(true);
+    fProducerWakeUp.wait(lock, hasFreeSlot);
+    fIsProducerWaiting.store(false);
+}
+
+void
+AsyncLogger::_WakeUpWriter()
+{
+    // the flag and the indexes are sequentially consistent, a sleeping writer can't miss the event
+    if (fIsWriterWaiting.load()) {
+        std::lock_guard<std::mutex> lock(fMutex);
+        fWriterWakeUp.notify_one();
+    }
+}
+
+void
+AsyncLogger::_Write()
+{
+    while (true) {
+        const std::size_t head = fHead.load(std::memory_order_relaxed);
+        const std::size_t tail = std::min(fTail.load(), head + MAX_BATCH_EVENTS);
+
+        if (head == tail) {
+            std::unique_lock<std::mutex> lock(fMutex);
+            fIsWriterWaiting.store(true);
+            fWriterWakeUp.wait(lock, [this, head] { return fTail.load() != head || fIsStopped.load(); });
+            fIsWriterWaiting.store(false);
+
+            if (fTail.load() == head) {
+                return;
+            }
+            continue;
+        }
+
+        _WriteBatch(head, tail);
+        fHead.store(tail);
+
+        if (fIsProducerWaiting.load()) {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fProducerWakeUp.notify_one();
+        }
+    }
+}
+
+void
+AsyncLogger::_WriteBatch(const std::size_t head, const std::size_t tail)
+{
+    std::array<struct iovec, MAX_BATCH_EVENTS> buffers;
+    std::size_t count = 0;
+    for (auto i = head; i < tail; ++i) {
+        std::string &text = fSlots[i % fSlots.size()];
+        buffers[count++] = {text.data(), text.size()};
+    }
+
+    // after a failure the events are dropped, the error is reported by Flush
+    if (!fWriteError) {
+        try {
+            struct iovec *next = buffers.data();
+            std::size_t left = count;
+            while (left > 0) {
+                auto written = static_cast<std::size_t>(system::unix::WriteVector(fFd, next, static_cast<int>(left)));
+
+                while (left > 0 && written >= next->iov_len) {
+                    written -= next->iov_len;
+                    ++next;
+                    --left;
+                }
+
+                if (left > 0) {
+                    next->iov_base = static_cast<char*>(next->iov_base) + written;
+                    next->iov_len -= written;
+                }
+            }
+        }
+        catch (...) {
+            fWriteError = std::current_exception();
+        }
+    }
+
+    for (auto i = head; i < tail; ++i) {
+        std::string &text = fSlots[i % fSlots.size()];
+        if (text.capacity() > MAX_KEPT_EVENT_CAPACITY) {
+            std::string().swap(text);
+        }
+    }
+}
+
+void
+AsyncLogger::_Stop()
+{
+    fIsStopped.store(true);
+
+    std::lock_guard<std::mutex> lock(fMutex);
+    fWriterWakeUp.notify_one();
+}
+
+}  // omtt::logger
@@ -7,9 +7,11 @@
  */
 
 #include "headers/logger/ConsoleLogger.hpp"
-#include "headers/logger/detail/Context.hpp"
+#include "headers/logger/detail/CauseMessage.hpp"
+#include "headers/logger/detail/ResourceFields.hpp"
 
 #include <iostream>
+#include <string>
 
 
 namespace omtt::logger
@@ -30,83 +32,34 @@ ConsoleLogger::BeginTestExecution(const omtt::TestPaths::size_type executedTests
               "Running test (" << executedTests << "/" << numberOfTests << "): " << testPath << '\n';
 }
 
-namespace
-{
-
-struct CauseVisitor {
-    CauseVisitor(std::ostream &stream) : stream(stream) {}
-
-    void operator()(expectation::validation::EmptyOutputCause cause) {
-        constexpr int differencePosition = 0;
-
-        stream << "Expected empty output.\n"
-                  "Got (context):\n"
-                  + detail::context(cause.fOutput,
-                                    differencePosition,
-                                    detail::PointerVisibility::NO_POINTER);
-    }
-
-    void operator()(expectation::validation::ExitCodeCause cause) {
-        stream << "Exit code doesn't match.\n"
-                  "Expected: " + std::to_string(cause.fExpectedExitCode) + "\n"
-                  "Got: " + std::to_string(cause.fExitCode);
-    }
-
-    void operator()(expectation::validation::FullOutputCause cause) {
-        stream << "Output doesn't match.\n"
-                  "First difference at byte: " + std::to_string(cause.fDifferencePosition) + "\n"
-                  + "Expected (context):\n" + detail::context(cause.fExpectedOutput,
-                                                            cause.fDifferencePosition,
-                                                            detail::PointerVisibility::INCLUDE_POINTER) + "\n"
-                  + "Got (context):\n" + detail::context(cause.fOutput,
-                                                          cause.fDifferencePosition,
-                                                          detail::PointerVisibility::INCLUDE_POINTER);
-    }
-
-    void operator()(expectation::validation::PartialOutputCause cause) {
-        constexpr int differencePosition = 0;
-
-        stream << "Text not found in output.\n"
-                  "Expected (context):\n"
-                  + detail::context(cause.fExpectedPartialOutput,
-                                    differencePosition,
-                                    detail::PointerVisibility::NO_POINTER);
-    }
-
-    void operator()(expectation::validation::SuccessfulExitCause cause) {
-        stream << "Exit status doesn't match.\n"
-                  "Expected: exit with success\n"
-                  "Got: exit with failure (exit code: " + std::to_string(cause.fExitCode) + ")";
-    }
-
-
-    void operator()(expectation::validation::FailureExitCause cause) {
-        stream << "Exit status doesn't match.\n"
-                  "Expected: exit with failure (exit code other than zero)\n"
-                  "Got: exit with success (exit code: " + std::to_string(cause.fExitCode) + ")";
-    }
-
-private:
-    std::ostream &stream;
-};
-
-}
-
 void
 ConsoleLogger::EndTestExecution(const omtt::ProcessResults &processResults,
                                 const omtt::TestExecutionSummary &summary)
 {
-    stream << "Verdict: " << to_cstring(summary.verdict);
+    // the buffer keeps its capacity, rendering of the next reports doesn't allocate
+    buffer.clear();
+    buffer += "Verdict: ";
+    buffer += to_cstring(summary.verdict);
+
+    if (isResourceUsageShown) {
+        buffer += "\nResources:";
+        for (const auto &field : detail::RESOURCE_FIELDS) {
+            buffer += ' ';
+            buffer += field.name;
+            buffer += '=';
+            field.appendValue(buffer, processResults.resources);
+        }
+    }
 
-    CauseVisitor visitor(stream);
     for (const auto &cause : summary.causes) {
-        stream << "\n"
+        buffer += "\n"
                   "--------------------\n"
                   "=> Cause:\n";
-        std::visit(visitor, cause);
+        detail::append_cause_message(buffer, cause);
     }
 
-    stream << '\n';
+    buffer += '\n';
+    stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 
     if (processResults.errors.length() > 0) {
         stream << "--------------------\n"
@@ -128,4 +81,10 @@ ConsoleLogger::OverallStatistics(const omtt::TestPaths::size_type executedTests,
            << executedTests << " tests total, " << numberOfTestsPassed << " passed, " << numberOfTestsFailed << " failed\n";
 }
 
+void
+ConsoleLogger::Flush()
+{
+    stream.flush();
+}
+
 }
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/JUnitXmlLogger.hpp"
+#include "headers/logger/detail/CauseMessage.hpp"
+#include "headers/logger/detail/Escape.hpp"
+#include "headers/logger/detail/ResourceFields.hpp"
+#include "headers/logger/detail/Seconds.hpp"
+
+
+namespace omtt::logger
+{
+
+JUnitXmlLogger::JUnitXmlLogger(std::ostream &stream)
+    :
+    fStream(stream),
+    fIsReportOpen(false)
+{
+}
+
+JUnitXmlLogger::~JUnitXmlLogger()
+{
+    _EndReport();
+}
+
+void
+JUnitXmlLogger::SutPath(const std::string &path)
+{
+    fSutPath = path;
+
+    fBuffer = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+              "<testsuites>\n"
+              "  <testsuite name=\"";
+    detail::append_xml_attribute(fBuffer, fSutPath);
+    fBuffer += "\">\n";
+
+    fIsReportOpen = true;
+    _Write();
+}
+
+void
+JUnitXmlLogger::BeginTestExecution(const omtt::TestPaths::size_type,
+                                   const omtt::TestPaths::size_type,
+                                   const omtt::Path &testPath)
+{
+    fTestPath = testPath;
+}
+
+void
+JUnitXmlLogger::EndTestExecution(const omtt::ProcessResults &processResults,
+                                 const omtt::TestExecutionSummary &summary)
+{
+    fBuffer = "    <testcase name=\"";
+    detail::append_xml_attribute(fBuffer, fTestPath);
+    fBuffer += "\" classname=\"";
+    detail::append_xml_attribute(fBuffer, fSutPath);
+    fBuffer += "\" time=\"";
+    detail::append_seconds(fBuffer, summary.duration);
+    fBuffer += "\">\n"
+               "      <properties>\n"
+               "        <property name=\"exit_code\" value=\"";
+    fBuffer += std::to_string(processResults.exitCode);
+    fBuffer += "\"/>\n";
+
+    for (const auto &field : detail::RESOURCE_FIELDS) {
+        fBuffer += "        <property name=\"";
+        fBuffer += field.name;
+        fBuffer += "\" value=\"";
+        field.appendValue(fBuffer, processResults.resources);
+        fBuffer += "\"/>\n";
+    }
+
+    fBuffer += "      </properties>\n";
+
+    if (summary.verdict != Verdict::PASS) {
+        _AppendFailure(summary);
+    }
+
+    if (!processResults.errors.empty()) {
+        fBuffer += "      <system-err>";
+        detail::append_xml_text(fBuffer, processResults.errors);
+        fBuffer += "</system-err>\n";
+    }
+
+    fBuffer += "    </testcase>\n";
+    _Write();
+}
+
+void
+JUnitXmlLogger::OverallStatistics(const omtt::TestPaths::size_type,
+                                  const omtt::TestPaths::size_type,
+                                  const omtt::TestPaths::size_type)
+{
+    _EndReport();
+}
+
+void
+JUnitXmlLogger::Flush()
+{
+    fStream.flush();
+}
+
+void
+JUnitXmlLogger::_AppendFailure(const omtt::TestExecutionSummary &summary)
+{
+    fMessage.clear();
+    for (const auto &cause : summary.causes) {
+        if (&cause != &summary.causes.front()) {
+            fMessage += "\n--------------------\n";
+        }
+        detail::append_cause_message(fMessage, cause);
+    }
+
+    // the first line of the first cause, the whole causes are in the element
+    const std::string_view message = fMessage.empty()
+                                     ? std::string_view(to_cstring(summary.verdict))
+                                     : std::string_view(fMessage).substr(0, fMessage.find('\n'));
+
+    fBuffer += "      <failure message=\"";
+    detail::append_xml_attribute(fBuffer, message);
+    fBuffer += "\" type=\"";
+    fBuffer += to_cstring(summary.verdict);
+    fBuffer += "\">";
+    detail::append_xml_text(fBuffer, fMessage);
+    fBuffer += "</failure>\n";
+}
+
+void
+JUnitXmlLogger::_EndReport()
+{
+    if (!fIsReportOpen) {
+        return;
+    }
+
+    fBuffer = "  </testsuite>\n"
+              "</testsuites>\n";
+
+    fIsReportOpen = false;
+    _Write();
+}
+
+void
+JUnitXmlLogger::_Write()
+{
+    // every test case is complete in the file when the test ends
+    fStream.write(fBuffer.data(), static_cast<std::streamsize>(fBuffer.size()));
+    fStream.flush();
+}
+
+}  // omtt::logger
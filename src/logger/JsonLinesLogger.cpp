@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/JsonLinesLogger.hpp"
+#include "headers/logger/detail/CauseMessage.hpp"
+#include "headers/logger/detail/Escape.hpp"
+#include "headers/logger/detail/ResourceFields.hpp"
+#include "headers/logger/detail/Seconds.hpp"
+
+
+namespace omtt::logger
+{
+
+JsonLinesLogger::JsonLinesLogger(std::ostream &stream)
+    :
+    fStream(stream),
+    fTestNumber(0),
+    fNumberOfTests(0)
+{
+}
+
+void
+JsonLinesLogger::SutPath(const std::string &path)
+{
+    fBuffer = "{\"type\":\"start\",\"sut\":";
+    detail::append_json_string(fBuffer, path);
+    fBuffer += '}';
+
+    _WriteRecord();
+}
+
+void
+JsonLinesLogger::BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                                    const omtt::TestPaths::size_type numberOfTests,
+                                    const omtt::Path &testPath)
+{
+    fTestPath = testPath;
+    fTestNumber = executedTests;
+    fNumberOfTests = numberOfTests;
+}
+
+void
+JsonLinesLogger::EndTestExecution(const omtt::ProcessResults &processResults,
+                                  const omtt::TestExecutionSummary &summary)
+{
+    fBuffer = "{\"type\":\"test\",\"number\":";
+    fBuffer += std::to_string(fTestNumber);
+    fBuffer += ",\"total\":";
+    fBuffer += std::to_string(fNumberOfTests);
+    fBuffer += ",\"test\":";
+    detail::append_json_string(fBuffer, fTestPath);
+    fBuffer += ",\"verdict\":\"";
+    fBuffer += to_cstring(summary.verdict);
+    fBuffer += "\",\"exit_code\":";
+    fBuffer += std::to_string(processResults.exitCode);
+    fBuffer += ",\"time\":";
+    detail::append_seconds(fBuffer, summary.duration);
+
+    fBuffer += ",\"resources\":{";
+    for (const auto &field : detail::RESOURCE_FIELDS) {
+        if (&field != &detail::RESOURCE_FIELDS.front()) {
+            fBuffer += ',';
+        }
+
+        fBuffer += '"';
+        fBuffer += field.name;
+        fBuffer += "\":";
+        field.appendValue(fBuffer, processResults.resources);
+    }
+
+    fBuffer += "},\"causes\":[";
+    std::string message;
+    for (const auto &cause : summary.causes) {
+        if (&cause != &summary.causes.front()) {
+            fBuffer += ',';
+        }
+
+        message.clear();
+        detail::append_cause_message(message, cause);
+        detail::append_json_string(fBuffer, message);
+    }
+
+    fBuffer += "],\"errors\":";
+    detail::append_json_string(fBuffer, processResults.errors);
+    fBuffer += '}';
+
+    _WriteRecord();
+}
+
+void
+JsonLinesLogger::OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                                   const omtt::TestPaths::size_type numberOfTestsPassed,
+                                   const omtt::TestPaths::size_type numberOfTestsFailed)
+{
+    fBuffer = "{\"type\":\"summary\",\"tests\":";
+    fBuffer += std::to_string(executedTests);
+    fBuffer += ",\"passed\":";
+    fBuffer += std::to_string(numberOfTestsPassed);
+    fBuffer += ",\"failed\":";
+    fBuffer += std::to_string(numberOfTestsFailed);
+    fBuffer += '}';
+
+    _WriteRecord();
+}
+
+void
+JsonLinesLogger::Flush()
+{
+    fStream.flush();
+}
+
+void
+JsonLinesLogger::_WriteRecord()
+{
+    // every record is complete in the file when the test ends
+    fBuffer += '\n';
+    fStream.write(fBuffer.data(), static_cast<std::streamsize>(fBuffer.size()));
+    fStream.flush();
+}
+
+}  // omtt::logger
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/ResultsLogLogger.hpp"
+#include "headers/logger/detail/CauseMessage.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <variant>
+
+
+namespace omtt::logger
+{
+
+namespace
+{
+
+using results::detail::CauseKind;
+
+struct CauseKindVisitor
+{
+    CauseKind operator()(const expectation::validation::EmptyOutputCause &) { return CauseKind::EMPTY_OUTPUT; }
+    CauseKind operator()(const expectation::validation::ExitCodeCause &) { return CauseKind::EXIT_CODE; }
+    CauseKind operator()(const expectation::validation::FullOutputCause &) { return CauseKind::FULL_OUTPUT; }
+    CauseKind operator()(const expectation::validation::PartialOutputCause &) { return CauseKind::PARTIAL_OUTPUT; }
+    CauseKind operator()(const expectation::validation::SuccessfulExitCause &) { return CauseKind::SUCCESSFUL_EXIT; }
+    CauseKind operator()(const expectation::validation::FailureExitCause &) { return CauseKind::FAILURE_EXIT; }
+    CauseKind operator()(const expectation::validation::OutputFileCause &) { return CauseKind::OUTPUT_FILE; }
+    CauseKind operator()(const expectation::validation::OutputMatchesCause &) { return CauseKind::OUTPUT_MATCHES; }
+    CauseKind operator()(const expectation::validation::InOutputMatchesCause &) { return CauseKind::IN_OUTPUT_MATCHES; }
+    CauseKind operator()(const expectation::validation::OutputTemplateCause &) { return CauseKind::OUTPUT_TEMPLATE; }
+    CauseKind operator()(const expectation::validation::InOutputInOrderCause &) { return CauseKind::IN_OUTPUT_IN_ORDER; }
+    CauseKind operator()(const expectation::validation::OutputLinesUnorderedCause &) { return CauseKind::OUTPUT_LINES_UNORDERED; }
+    CauseKind operator()(const expectation::validation::OutputJsonCause &) { return CauseKind::OUTPUT_JSON; }
+    CauseKind operator()(const expectation::validation::OutputWithToleranceCause &) { return CauseKind::OUTPUT_WITH_TOLERANCE; }
+    CauseKind operator()(const expectation::validation::OutputDiffCause &) { return CauseKind::OUTPUT_DIFF; }
+    CauseKind operator()(const expectation::validation::OutputSizeCause &) { return CauseKind::OUTPUT_SIZE; }
+    CauseKind operator()(const expectation::validation::OutputLineCountCause &) { return CauseKind::OUTPUT_LINE_COUNT; }
+    CauseKind operator()(const expectation::validation::OutputStartsWithCause &) { return CauseKind::OUTPUT_STARTS_WITH; }
+    CauseKind operator()(const expectation::validation::OutputSha256Cause &) { return CauseKind::OUTPUT_SHA256; }
+    CauseKind operator()(const expectation::validation::InputFileCause &) { return CauseKind::INPUT_FILE; }
+
+    // the replayed causes have only their messages
+    CauseKind operator()(const expectation::validation::RecordedCause &) { return CauseKind::NONE; }
+};
+
+}
+
+ResultsLogLogger::ResultsLogLogger(std::ostream &logStream, std::ostream &contextStream)
+    :
+    fLogStream(logStream),
+    fContextStream(contextStream),
+    fContextSize(0),
+    fRecord{}
+{
+}
+
+void
+ResultsLogLogger::SutPath(const std::string &path)
+{
+    results::detail::Header header{};
+    std::memcpy(header.magic, results::detail::MAGIC, sizeof(header.magic));
+    header.version = results::detail::FORMAT_VERSION;
+    header.recordSize = sizeof(results::detail::Record);
+    header.sutOffset = _WriteContext(path);
+    header.sutLength = path.size();
+
+    fLogStream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+void
+ResultsLogLogger::BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                                     const omtt::TestPaths::size_type numberOfTests,
+                                     const omtt::Path &testPath)
+{
+    fRecord = results::detail::Record{};
+    fRecord.number = executedTests;
+    fRecord.numberOfTests = numberOfTests;
+    fRecord.pathOffset = _WriteContext(testPath);
+    fRecord.pathLength = testPath.size();
+}
+
+void
+ResultsLogLogger::EndTestExecution(const omtt::ProcessResults &processResults,
+                                   const omtt::TestExecutionSummary &summary)
+{
+    // the console report shows the error output of the passed tests too
+    fRecord.errorsOffset = _WriteContext(processResults.errors);
+    fRecord.errorsLength = processResults.errors.size();
+    fRecord.durationNsec = summary.duration.count();
+
+    const ResourceUsage &resources = processResults.resources;
+    fRecord.wallTimeNsec = resources.wallTime.count();
+    fRecord.userTimeUsec = resources.userTime.count();
+    fRecord.systemTimeUsec = resources.systemTime.count();
+    fRecord.maxResidentSetSizeKb = resources.maxResidentSetSizeKb;
+    fRecord.minorPageFaults = resources.minorPageFaults;
+    fRecord.majorPageFaults = resources.majorPageFaults;
+    fRecord.voluntaryContextSwitches = resources.voluntaryContextSwitches;
+    fRecord.involuntaryContextSwitches = resources.involuntaryContextSwitches;
+
+    fRecord.exitCode = processResults.exitCode;
+    fRecord.causesCount = summary.causes.size();
+    fRecord.verdict = static_cast<std::uint8_t>(summary.verdict);
+
+    std::fill(std::begin(fRecord.causeKinds), std::end(fRecord.causeKinds), CauseKind::NONE);
+    const auto kindsCount = std::min(summary.causes.size(), std::size(fRecord.causeKinds));
+    for (std::size_t i = 0; i < kindsCount; ++i) {
+        fRecord.causeKinds[i] = std::visit(CauseKindVisitor(), summary.causes[i]);
+    }
+
+    // the causes point into the SUT output, which is gone when the report is made
+    fBuffer.clear();
+    for (const auto &cause : summary.causes) {
+        const std::size_t lengthPosition = fBuffer.size();
+        fBuffer.append(sizeof(std::uint64_t), '\0');
+
+        detail::append_cause_message(fBuffer, cause);
+
+        const std::uint64_t length = fBuffer.size() - lengthPosition - sizeof(std::uint64_t);
+        std::memcpy(fBuffer.data() + lengthPosition, &length, sizeof(length));
+    }
+
+    fRecord.causesOffset = _WriteContext(fBuffer);
+    fRecord.causesLength = fBuffer.size();
+
+    fLogStream.write(reinterpret_cast<const char *>(&fRecord), sizeof(fRecord));
+}
+
+void
+ResultsLogLogger::OverallStatistics(const omtt::TestPaths::size_type,
+                                    const omtt::TestPaths::size_type,
+                                    const omtt::TestPaths::size_type)
+{
+    Flush();
+}
+
+void
+ResultsLogLogger::Flush()
+{
+    // the records refer to the context, it is written first
+    fContextStream.flush();
+    fLogStream.flush();
+}
+
+std::uint64_t
+ResultsLogLogger::_WriteContext(const std::string_view &text)
+{
+    const std::uint64_t offset = fContextSize;
+
+    fContextStream.write(text.data(), static_cast<std::streamsize>(text.size()));
+    fContextSize += text.size();
+
+    return offset;
+}
+
+}
@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2019-2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/detail/CauseMessage.hpp"
+#include "headers/logger/detail/Context.hpp"
+
+#include <array>
+#include <charconv>
+#include <limits>
+#include <string_view>
+#include <variant>
+
+
+namespace omtt::logger::detail
+{
+
+namespace
+{
+
+constexpr std::string_view
+stream_name(const expectation::Stream stream)
+{
+    return (stream == expectation::Stream::OUTPUT) ? "output" : "error output";
+}
+
+constexpr std::string_view
+capitalized_stream_name(const expectation::Stream stream)
+{
+    return (stream == expectation::Stream::OUTPUT) ? "Output" : "Error output";
+}
+
+void
+append_number(std::string &buffer, const std::uint64_t number)
+{
+    std::array<char, std::numeric_limits<std::uint64_t>::digits10 + 1> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), number);
+    buffer.append(digits.data(), result.ptr);
+}
+
+void
+append_number(std::string &buffer, const int number)
+{
+    std::array<char, std::numeric_limits<int>::digits10 + 2> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), number);
+    buffer.append(digits.data(), result.ptr);
+}
+
+// line numbers in the unified diff format, counted from one
+void
+append_hunk_range(std::string &buffer, const std::size_t begin, const std::size_t count)
+{
+    append_number(buffer, static_cast<std::uint64_t>((count == 0) ? begin : begin + 1));
+    buffer += ',';
+    append_number(buffer, static_cast<std::uint64_t>(count));
+}
+
+char
+diff_line_prefix(const expectation::detail::DiffLine::Kind kind)
+{
+    switch (kind) {
+        case expectation::detail::DiffLine::Kind::DELETED:
+            return '-';
+        case expectation::detail::DiffLine::Kind::INSERTED:
+            return '+';
+        default:
+            return ' ';
+    }
+}
+
+void
+append_expected_count(std::string &buffer,
+                      const expectation::Comparison comparison,
+                      const std::uint64_t count,
+                      const std::string_view &unit)
+{
+    switch (comparison) {
+        case expectation::Comparison::AT_LEAST:
+            buffer += "at least ";
+            break;
+        case expectation::Comparison::AT_MOST:
+            buffer += "at most ";
+            break;
+        default:
+            break;
+    }
+
+    append_number(buffer, count);
+    buffer += ' ';
+    buffer += unit;
+}
+
+struct CauseVisitor {
+    CauseVisitor(std::string &buffer) : buffer(buffer) {}
+
+    void operator()(const expectation::validation::EmptyOutputCause &cause) {
+        constexpr int differencePosition = 0;
+
+        buffer += "Expected empty ";
+        buffer += stream_name(cause.fStream);
+        buffer += ".\n"
+                  "Got (context):\n";
+        append_context(buffer, cause.fOutput, differencePosition, PointerVisibility::NO_POINTER);
+    }
+
+    void operator()(const expectation::validation::ExitCodeCause &cause) {
+        buffer += "Exit code doesn't match.\n"
+                  "Expected: ";
+        append_number(buffer, cause.fExpectedExitCode);
+        buffer += "\n"
+                  "Got: ";
+        append_number(buffer, cause.fExitCode);
+    }
+
+    void operator()(const expectation::validation::FullOutputCause &cause) {
+        buffer += capitalized_stream_name(cause.fStream);
+        buffer += " doesn't match.\n";
+        _AppendFirstDifference(cause.fDifferencePosition);
+        buffer += " (line ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fDifferenceLine));
+        buffer += ", column ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fDifferenceColumn));
+        buffer += ")\n";
+        _AppendExpectedAndGot(cause.fExpectedOutput, cause.fDifferencePosition,
+                              cause.fOutput, cause.fDifferencePosition);
+    }
+
+    void operator()(const expectation::validation::PartialOutputCause &cause) {
+        constexpr int differencePosition = 0;
+
+        buffer += "Text not found in ";
+        buffer += stream_name(cause.fStream);
+        buffer += ".\n"
+                  "Expected (context):\n";
+        append_context(buffer, cause.fExpectedPartialOutput, differencePosition, PointerVisibility::NO_POINTER);
+    }
+
+    void operator()(const expectation::validation::SuccessfulExitCause &cause) {
+        buffer += "Exit status doesn't match.\n"
+                  "Expected: exit with success\n"
+                  "Got: exit with failure (exit code: ";
+        append_number(buffer, cause.fExitCode);
+        buffer += ')';
+    }
+
+
+    void operator()(const expectation::validation::FailureExitCause &cause) {
+        buffer += "Exit status doesn't match.\n"
+                  "Expected: exit with failure (exit code other than zero)\n"
+                  "Got: exit with success (exit code: ";
+        append_number(buffer, cause.fExitCode);
+        buffer += ')';
+    }
+
+    void operator()(const expectation::validation::OutputFileCause &cause) {
+        buffer += "Output doesn't match the file: ";
+        buffer += cause.fExpectedOutputFile;
+        buffer += '\n';
+        _AppendFirstDifference(cause.fDifferencePosition);
+        buffer += " (line ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fDifferenceLine));
+        buffer += ", column ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fDifferenceColumn));
+        buffer += ")\n";
+        _AppendExpectedAndGot(cause.fExpectedContext, cause.fContextPosition,
+                              cause.fOutputContext, cause.fContextPosition);
+    }
+
+    void operator()(const expectation::validation::OutputMatchesCause &cause) {
+        buffer += "Output doesn't match the pattern: ";
+        buffer += cause.fPattern;
+        buffer += "\n"
+                  "Longest matched prefix: ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fMatchedPrefixSize));
+        buffer += " bytes\n"
+                  "Got (context):\n";
+        append_context(buffer, cause.fOutputContext, cause.fContextPosition, PointerVisibility::INCLUDE_POINTER);
+    }
+
+    void operator()(const expectation::validation::InOutputMatchesCause &cause) {
+        buffer += "Pattern not found in output: ";
+        buffer += cause.fPattern;
+    }
+
+    void operator()(const expectation::validation::InOutputInOrderCause &cause) {
+        constexpr int differencePosition = 0;
+
+        buffer += "Text not found in output after byte: ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fSearchStartPosition));
+        buffer += "\n"
+                  "Text ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fTextNumber));
+        buffer += " of ";
+        append_number(buffer, static_cast<std::uint64_t>(cause.fTextsCount));
+        buffer += " in order.\n"
+                  "Expected (context):\n";
+        append_context(buffer, cause.fExpectedPartialOutput, differencePosition, PointerVisibility::NO_POINTER);
+    }
+
+    void operator()(const expectation::validation::OutputLinesUnorderedCause &cause) {
+        buffer += "Output lines don't match (in any order).";
+        _AppendLines("Missing lines: ", cause.fMissingLinesCount, cause.fMissingLines);
+        _AppendLines("Extra lines: ", cause.fExtraLinesCount, cause.fExtraLines);
+    }
+
+    void operator()(const expectation::validation::OutputJsonCause &cause) {
+        buffer += "Output JSON doesn't match.\n"
+                  "First difference at: \"";
+        buffer += cause.fPointer;
+        buffer += "\"\n"
+                  "Expected: ";
+        buffer += cause.fExpected;
+        buffer += "\n"
+                  "Got: ";
+        buffer += cause.fActual;
+    }
+
+    void operator()(const expectation::validation::OutputWithToleranceCause &cause) {
+        if (cause.fNumber.empty()) {
+            buffer += "Output doesn't match.\n";
+            _AppendFirstDifference(cause.fDifferencePosition);
+            buffer += '\n';
+        }
+        else {
+            buffer += "Number out of tolerance at byte: ";
+            append_number(buffer, static_cast<std::uint64_t>(cause.fDifferencePosition));
+            buffer += "\n"
+                      "Expected: ";
+            buffer += cause.fExpectedNumber;
+            buffer += "\n"
+                      "Got: ";
+            buffer += cause.fNumber;
+            buffer += '\n';
+        }
+
+        _AppendExpectedAndGot(cause.fExpectedOutput, cause.fExpectedPosition,
+                              cause.fOutput, cause.fDifferencePosition);
+    }
+
+    void operator()(const expectation::validation::OutputDiffCause &cause) {
+        buffer += capitalized_stream_name(cause.fStream);
+        buffer += " doesn't match.\n"
+                  "--- expected\n"
+                  "+++ ";
+        buffer += stream_name(cause.fStream);
+
+        for (const auto &hunk : cause.fHunks) {
+            buffer += "\n@@ -";
+            append_hunk_range(buffer, hunk.expectedBegin, hunk.expectedCount);
+            buffer += " +";
+            append_hunk_range(buffer, hunk.outputBegin, hunk.outputCount);
+            buffer += " @@";
+
+            for (const auto &line : hunk.lines) {
+                buffer += '\n';
+                buffer += diff_line_prefix(line.kind);
+
+                if (!line.text.empty() && line.text.back() == '\n') {
+                    buffer += line.text.substr(0, line.text.size() - 1);
+                }
+                else {
+                    buffer += line.text;
+                    buffer += "\n\\ No newline at end of file";
+                }
+            }
+        }
+    }
+
+    void operator()(const expectation::validation::OutputTemplateCause &cause) {
+        buffer += "Output doesn't match the template.\n";
+        _AppendFirstDifference(cause.fDifferencePosition);
+        buffer += '\n';
+        _AppendExpectedAndGot(cause.fTemplate, cause.fTemplatePosition,
+                              cause.fOutput, cause.fDifferencePosition);
+    }
+
+    void operator()(const expectation::validation::OutputSizeCause &cause) {
+        buffer += "Output size doesn't match.\n"
+                  "Expected: ";
+        append_expected_count(buffer, cause.fComparison, cause.fExpectedSize, "bytes");
+        buffer += "\n"
+                  "Got: ";
+        append_number(buffer, cause.fSize);
+        buffer += " bytes";
+    }
+
+    void operator()(const expectation::validation::OutputLineCountCause &cause) {
+        buffer += "Output line count doesn't match.\n"
+                  "Expected: ";
+        append_expected_count(buffer, cause.fComparison, cause.fExpectedLineCount, "lines");
+        buffer += "\n"
+                  "Got: ";
+        append_number(buffer, cause.fLineCount);
+        buffer += " lines";
+    }
+
+    void operator()(const expectation::validation::OutputStartsWithCause &cause) {
+        buffer += "Output doesn't start with the expected text.\n";
+        _AppendFirstDifference(cause.fDifferencePosition);
+        buffer += '\n';
+        _AppendExpectedAndGot(cause.fExpectedBeginning, cause.fDifferencePosition,
+                              cause.fOutputContext, cause.fContextPosition);
+    }
+
+    void operator()(const expectation::validation::OutputSha256Cause &cause) {
+        buffer += "Output SHA-256 doesn't match.\n"
+                  "Expected: ";
+        buffer += cause.fExpectedDigest;
+        buffer += "\n"
+                  "Got: ";
+        buffer += cause.fDigest;
+        buffer += " (";
+        append_number(buffer, cause.fSize);
+        buffer += " bytes)";
+
+        if (cause.fSize > 0) {
+            buffer += "\nOutput beginning (context):\n";
+            append_context(buffer, cause.fHead, 0, PointerVisibility::NO_POINTER);
+            buffer += "\nOutput end (context):\n";
+            append_context(buffer, cause.fTail, cause.fTail.size() - 1, PointerVisibility::NO_POINTER);
+        }
+    }
+
+    void operator()(const expectation::validation::InputFileCause &cause) {
+        buffer += "Input file can't be opened: ";
+        buffer += cause.fInputFile;
+        buffer += "\n"
+                  "Reason: ";
+        buffer += cause.fReason;
+    }
+
+    void operator()(const expectation::validation::RecordedCause &cause) {
+        buffer += cause.fMessage;
+    }
+
+private:
+    void _AppendFirstDifference(const std::size_t differencePosition) {
+        buffer += "First difference at byte: ";
+        append_number(buffer, static_cast<std::uint64_t>(differencePosition));
+    }
+
+    void _AppendExpectedAndGot(const std::string_view &expected,
+                               const std::size_t expectedPosition,
+                               const std::string_view &output,
+                               const std::size_t outputPosition) {
+        buffer += "Expected (context):\n";
+        append_context(buffer, expected, expectedPosition, PointerVisibility::INCLUDE_POINTER);
+        buffer += "\n"
+                  "Got (context):\n";
+        append_context(buffer, output, outputPosition, PointerVisibility::INCLUDE_POINTER);
+    }
+
+    void _AppendLines(const char *header,
+                      const std::uint64_t count,
+                      const std::vector<expectation::validation::OutputLinesUnorderedCause::Line> &lines) {
+        if (count == 0) {
+            return;
+        }
+
+        buffer += '\n';
+        buffer += header;
+        append_number(buffer, count);
+
+        std::uint64_t listed = 0;
+        for (const auto &line : lines) {
+            buffer += "\n  ";
+            buffer += line.fLine;
+            if (line.fCount > 1) {
+                buffer += " (";
+                append_number(buffer, line.fCount);
+                buffer += " times)";
+            }
+            listed += line.fCount;
+        }
+
+        if (listed < count) {
+            buffer += "\n  ...";
+        }
+    }
+
+    std::string &buffer;
+};
+
+}
+
+void
+append_cause_message(std::string &buffer, const expectation::validation::ValidationResult::Cause &cause)
+{
+    std::visit(CauseVisitor(buffer), cause);
+}
+
+}  // omtt::logger::detail
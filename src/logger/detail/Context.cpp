@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2019-2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/detail/Context.hpp"
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+
+namespace omtt::logger::detail
+{
+
+namespace
+{
+
+constexpr std::size_t CONTEXT_SIZE = 6;
+constexpr std::size_t CELL_WIDTH = 5;
+
+using Cell = std::array<char, CELL_WIDTH>;
+
+constexpr Cell
+cell(const char *glyph)
+{
+    Cell padded{' ', ' ', ' ', ' ', ' '};
+    for (std::size_t i = 0; glyph[i] != '\0'; ++i) {
+        padded[i] = glyph[i];
+    }
+    return padded;
+}
+
+constexpr Cell
+glyph_cell(const unsigned char byte)
+{
+    switch (byte) {
+        case ' ':
+            return cell("SPC");
+        case '\t':
+            return cell("TAB");
+        case '\r':
+            return cell("CR");
+        case '\n':
+            return cell("LF");
+        case '\v':
+            return cell("VT");
+        case '\f':
+            return cell("FF");
+    }
+
+    // printable characters of the "C" locale
+    if (byte >= 0x20 && byte < 0x7f) {
+        return Cell{static_cast<char>(byte), ' ', ' ', ' ', ' '};
+    }
+
+    return cell("NP");
+}
+
+constexpr std::array<Cell, 256>
+glyph_table()
+{
+    std::array<Cell, 256> glyphs{};
+    for (std::size_t byte = 0; byte < glyphs.size(); ++byte) {
+        glyphs[byte] = glyph_cell(static_cast<unsigned char>(byte));
+    }
+    return glyphs;
+}
+
+constexpr std::array<Cell, 256> GLYPHS = glyph_table();
+
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+// the bytes were always printed as int, a signed char extends with ones
+constexpr std::string_view SIGN_EXTENSION = "ffffff";
+static_assert(sizeof(int) == 4, "the sign extension assumes a 32 bit int");
+
+void
+append_hex(std::string &buffer, const unsigned char byte)
+{
+    buffer += "0x";
+    if (std::is_signed_v<char> && byte >= 0x80) {
+        buffer += SIGN_EXTENSION;
+    }
+    buffer += HEX_DIGITS[byte >> 4];
+    buffer += HEX_DIGITS[byte & 0x0f];
+    buffer += ' ';
+}
+
+std::size_t
+start_position(const std::size_t mismatchPosition)
+{
+    return (mismatchPosition > CONTEXT_SIZE) ? mismatchPosition - CONTEXT_SIZE : 0;
+}
+
+std::size_t
+end_position(const std::size_t textLength, const std::size_t mismatchPosition)
+{
+    return std::min(textLength, mismatchPosition + CONTEXT_SIZE + 1);
+}
+
+}
+
+void
+append_context(std::string &buffer,
+               const std::string_view &text,
+               const std::size_t mismatchPosition,
+               const PointerVisibility pointerVisibility)
+{
+    const std::size_t lower = start_position(mismatchPosition);
+    const std::size_t upper = end_position(text.length(), mismatchPosition);
+
+    for (auto i = lower; i < upper; ++i) {
+        const Cell &glyph = GLYPHS[static_cast<unsigned char>(text[i])];
+        buffer.append(glyph.data(), glyph.size());
+    }
+    buffer += '\n';
+
+    if (pointerVisibility == PointerVisibility::INCLUDE_POINTER) {
+        for (auto i = lower; i < upper; ++i) {
+            buffer += (i == mismatchPosition) ? '^' : ' ';
+            buffer.append(CELL_WIDTH - 1, ' ');
+        }
+        buffer += '\n';
+    }
+
+    for (auto i = lower; i < upper; ++i) {
+        append_hex(buffer, static_cast<unsigned char>(text[i]));
+    }
+}
+
+std::string
+context(const std::string_view &text,
+        const std::size_t mismatchPosition,
+        const PointerVisibility pointerVisibility)
+{
+    std::string buffer;
+    append_context(buffer, text, mismatchPosition, pointerVisibility);
+    return buffer;
+}
+
+}  // omtt::logger::detail
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/detail/Escape.hpp"
+
+#include <cstddef>
+
+
+namespace omtt::logger::detail
+{
+
+namespace
+{
+
+constexpr std::string_view REPLACEMENT_CHARACTER = "\xEF\xBF\xBD";
+
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+bool
+is_continuation(const std::string_view &text, const std::size_t position)
+{
+    return position < text.size() && (static_cast<unsigned char>(text[position]) & 0xc0) == 0x80;
+}
+
+// length of the valid UTF-8 sequence beginning at the position, zero when it's not valid
+std::size_t
+utf8_sequence_length(const std::string_view &text, const std::size_t position)
+{
+    const auto first = static_cast<unsigned char>(text[position]);
+
+    if (first < 0x80) {
+        return 1;
+    }
+
+    std::size_t length = 0;
+    unsigned char secondMin = 0x80;
+    unsigned char secondMax = 0xbf;
+
+    if (first >= 0xc2 && first <= 0xdf) {
+        length = 2;
+    }
+    else if (first >= 0xe0 && first <= 0xef) {
+        length = 3;
+        // overlong forms and surrogates
+        if (first == 0xe0) {
+            secondMin = 0xa0;
+        }
+        else if (first == 0xed) {
+            secondMax = 0x9f;
+        }
+    }
+    else if (first >= 0xf0 && first <= 0xf4) {
+        length = 4;
+        // overlong forms and code points above U+10FFFF
+        if (first == 0xf0) {
+            secondMin = 0x90;
+        }
+        else if (first == 0xf4) {
+            secondMax = 0x8f;
+        }
+    }
+    else {
+        return 0;
+    }
+
+    if (position + 1 >= text.size()) {
+        return 0;
+    }
+
+    const auto second = static_cast<unsigned char>(text[position + 1]);
+    if (second < secondMin || second > secondMax) {
+        return 0;
+    }
+
+    for (std::size_t i = 2; i < length; ++i) {
+        if (!is_continuation(text, position + i)) {
+            return 0;
+        }
+    }
+
+    return length;
+}
+
+/*
+ * Calls escapeAscii for the ASCII characters, appends the valid
+ * multibyte sequences and replaces the invalid bytes.
+ */
+template<class EscapeAscii>
+void
+append_utf8(std::string &buffer, const std::string_view &text, EscapeAscii escapeAscii)
+{
+    std::size_t i = 0;
+    while (i < text.size()) {
+        const std::size_t length = utf8_sequence_length(text, i);
+
+        if (length == 1) {
+            escapeAscii(text[i]);
+        }
+        else if (length > 1) {
+            buffer.append(text, i, length);
+        }
+        else {
+            buffer += REPLACEMENT_CHARACTER;
+        }
+
+        i += (length > 0) ? length : 1;
+    }
+}
+
+void
+append_xml(std::string &buffer, const std::string_view &text, const bool isAttribute)
+{
+    append_utf8(buffer, text, [&buffer, isAttribute](const char c) {
+        switch (c) {
+            case '&':
+                buffer += "&amp;";
+                break;
+            case '<':
+                buffer += "&lt;";
+                break;
+            case '>':
+                buffer += "&gt;";
+                break;
+            case '"':
+                buffer += "&quot;";
+                break;
+            case '\'':
+                buffer += "&apos;";
+                break;
+            case '\r':
+                buffer += "&#13;";
+                break;
+            case '\n':
+            case '\t':
+                // the attribute values would have them normalized to spaces
+                if (isAttribute) {
+                    buffer += (c == '\n') ? "&#10;" : "&#9;";
+                }
+                else {
+                    buffer += c;
+                }
+                break;
+            default:
+                // the other control characters are not allowed in XML 1.0
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    buffer += REPLACEMENT_CHARACTER;
+                }
+                else {
+                    buffer += c;
+                }
+        }
+    });
+}
+
+}
+
+void
+append_json_string(std::string &buffer, const std::string_view &text)
+{
+    buffer += '"';
+
+    append_utf8(buffer, text, [&buffer](const char c) {
+        switch (c) {
+            case '"':
+                buffer += "\\\"";
+                break;
+            case '\\':
+                buffer += "\\\\";
+                break;
+            case '\n':
+                buffer += "\\n";
+                break;
+            case '\r':
+                buffer += "\\r";
+                break;
+            case '\t':
+                buffer += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20 || c == 0x7f) {
+                    buffer += "\\u00";
+                    buffer += HEX_DIGITS[(c >> 4) & 0x0f];
+                    buffer += HEX_DIGITS[c & 0x0f];
+                }
+                else {
+                    buffer += c;
+                }
+        }
+    });
+
+    buffer += '"';
+}
+
+void
+append_xml_text(std::string &buffer, const std::string_view &text)
+{
+    append_xml(buffer, text, false);
+}
+
+void
+append_xml_attribute(std::string &buffer, const std::string_view &text)
+{
+    append_xml(buffer, text, true);
+}
+
+}  // omtt::logger::detail
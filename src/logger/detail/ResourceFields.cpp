@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/logger/detail/ResourceFields.hpp"
+#include "headers/logger/detail/Seconds.hpp"
+
+#include <charconv>
+#include <limits>
+
+
+namespace omtt::logger::detail
+{
+
+namespace
+{
+
+void
+append_number(std::string &buffer, const std::int64_t number)
+{
+    std::array<char, std::numeric_limits<std::int64_t>::digits10 + 2> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), number);
+    buffer.append(digits.data(), result.ptr);
+}
+
+}
+
+const std::array<ResourceField, 8> RESOURCE_FIELDS = {{
+    {"wall_time", [](std::string &buffer, const ResourceUsage &resources) { append_seconds(buffer, resources.wallTime); }},
+    {"user_time", [](std::string &buffer, const ResourceUsage &resources) { append_seconds(buffer, resources.userTime); }},
+    {"system_time", [](std::string &buffer, const ResourceUsage &resources) { append_seconds(buffer, resources.systemTime); }},
+    {"max_rss_kb", [](std::string &buffer, const ResourceUsage &resources) { append_number(buffer, resources.maxResidentSetSizeKb); }},
+    {"minor_page_faults", [](std::string &buffer, const ResourceUsage &resources) { append_number(buffer, resources.minorPageFaults); }},
+    {"major_page_faults", [](std::string &buffer, const ResourceUsage &resources) { append_number(buffer, resources.majorPageFaults); }},
+    {"voluntary_context_switches", [](std::string &buffer, const ResourceUsage &resources) { append_number(buffer, resources.voluntaryContextSwitches); }},
+    {"involuntary_context_switches", [](std::string &buffer, const ResourceUsage &resources) { append_number(buffer, resources.involuntaryContextSwitches); }},
+}};
+
+}
@@ -12,40 +12,275 @@
 #include "headers/lexer/Lexer.hpp"
 #include "headers/parser/Parser.hpp"
 #include "headers/RunProcess.hpp"
+#include "headers/OutputDispatcher.hpp"
+#include "headers/LineEndings.hpp"
+#include "headers/normalize/Normalizer.hpp"
 #include "headers/TestExecutionSummary.hpp"
 #include "headers/ValidateExpectationsAndSutResults.hpp"
+#include "headers/artifacts/ArtifactsWriter.hpp"
 #include "headers/ErrorCodes.hpp"
+#include "headers/logger/AsyncLogger.hpp"
 #include "headers/logger/ConsoleLogger.hpp"
+#include "headers/logger/JsonLinesLogger.hpp"
+#include "headers/logger/JUnitXmlLogger.hpp"
+#include "headers/logger/MultiLogger.hpp"
+#include "headers/logger/ResultsLogLogger.hpp"
 #include "headers/Path.hpp"
-#include "headers/LineEndings.hpp"
 #include "headers/License.hpp"
+#include "headers/cache/TestCache.hpp"
+#include "headers/check/CheckTestFiles.hpp"
+#include "headers/exception/FileWriteException.hpp"
+#include "headers/exception/InputFileException.hpp"
+#include "headers/exception/TestFileParseException.hpp"
+#include "headers/expectation/PreparationContext.hpp"
+#include "headers/regex/PatternCache.hpp"
+#include "headers/results/Report.hpp"
+#include "headers/results/ResultsLog.hpp"
+#include "headers/results/detail/Format.hpp"
+#include "headers/system/Unix.hpp"
 
 #include <iostream>
 #include <algorithm>
+#include <chrono>
+#include <deque>
+#include <fstream>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
 namespace po = boost::program_options;
 
 
+struct TestFile
+{
+    omtt::Path path;
+    std::string buffer;
+    std::vector<omtt::TestData> tests;
+};
+
+// the files parsed by the loading pass are kept for the run up to this size,
+// the next ones are released and parsed again when their tests run
+constexpr std::string::size_type KEPT_TEST_FILES_SIZE = 64 * 1024 * 1024;
+
+
 omtt::TestPaths::size_type
 RunAllTests(std::optional<omtt::Path> interpreter,
             const omtt::Path &sut,
             const omtt::TestPaths &tests,
-            const std::unique_ptr<omtt::logger::Logger> &logger);
+            const std::unique_ptr<omtt::logger::Logger> &logger,
+            const std::unique_ptr<omtt::cache::TestCache> &cache,
+            const std::unique_ptr<omtt::artifacts::ArtifactsWriter> &artifacts,
+            bool isLineDiffShown,
+            omtt::ValidationMode validationMode);
+
+std::unique_ptr<omtt::logger::Logger>
+CreateLogger(const po::variables_map &vm,
+             std::deque<std::ofstream> &reportFiles);
+
+std::ofstream &
+OpenReportFile(const omtt::Path &path,
+               std::deque<std::ofstream> &reportFiles);
+
+omtt::TestPaths::size_type
+LoadTestFiles(const omtt::TestPaths &tests,
+              const std::unique_ptr<omtt::cache::TestCache> &cache,
+              std::vector<std::unique_ptr<TestFile>> &testFiles);
+
+void
+LoadTestFile(const omtt::Path &testFileName,
+             const std::unique_ptr<omtt::cache::TestCache> &cache,
+             TestFile &testFile);
+
+omtt::Path
+TestCaseName(const TestFile &testFile, const std::vector<omtt::TestData>::size_type index);
+
+std::vector<omtt::TestData>
+ParseTestFile(const omtt::Path &testFileName,
+              const std::string &testFileBuffer,
+              const std::unique_ptr<omtt::cache::TestCache> &cache);
+
+void
+SaveCache(const std::unique_ptr<omtt::cache::TestCache> &cache);
+
+void
+SaveArtifacts(omtt::artifacts::ArtifactsWriter &artifacts,
+              const omtt::Path &testName,
+              const TestFile &testFile,
+              const omtt::TestData &testData,
+              const omtt::ProcessResults &processResults);
+
+int
+CheckAllTests(const omtt::TestPaths &tests);
+
+int
+Report(int argc, char **argv);
+
+std::unique_ptr<omtt::logger::Logger>
+CreateReportLogger(const std::string &format, bool isResourceUsageShown);
+
+int
+CheckAllTests(const omtt::TestPaths &tests)
+{
+    const unsigned threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+    const omtt::check::CheckSummary summary = omtt::check::CheckTestFiles(tests, threadsCount);
+
+    for (const auto &error : summary.errors) {
+        std::cout << "error: " << error.path;
+        if (error.position.has_value()) {
+            std::cout << " at " << *error.position << " byte";
+        }
+        std::cout << ": " << error.message << '\n';
+    }
+
+    std::cout << "====================\n"
+              << tests.size() << " test files checked, "
+              << summary.testsCount << " tests found, "
+              << summary.errors.size() << " files with errors\n";
+
+    return std::min<omtt::TestPaths::size_type>(summary.errors.size(), omtt::MAX_TESTS_FAILED);
+}
+
+
+int
+Report(int argc, char **argv)
+{
+    po::variables_map vm;
+
+    po::options_description reportOptions("Report");
+    reportOptions.add_options()
+        ("format", po::value<std::string>()->default_value("console"), "report format: console, json or junit")
+        ("verdict", po::value<std::string>(), "report only the tests with the verdict: PASS or FAIL")
+        ("path", po::value<std::string>(), "report only the tests with the text in the path")
+        ("cause", po::value<std::string>(), "report only the tests failed with the cause kind, e.g. EXIT_CODE or OUTPUT_FILE")
+        ("resources", "report the CPU time, memory and context switches used by the SUT")
+        ("help", "display this help text and exit")
+        ;
+
+    po::options_description hidden;
+    hidden.add_options()
+        ("results-log", po::value<omtt::Path>(), "Results log to report.")
+        ;
+
+    po::options_description allOptions;
+    allOptions.add(reportOptions);
+    allOptions.add(hidden);
+
+    po::positional_options_description positional;
+    positional.add("results-log", 1);
+
+    omtt::results::ReportFilter filter;
+    std::unique_ptr<omtt::logger::Logger> logger;
+
+    try {
+        po::store(po::command_line_parser(argc, argv)
+                      .options(allOptions)
+                      .positional(positional).run(),
+                  vm);
+        po::notify(vm);
+
+        if (vm.count("help")) {
+            std::cout << "USAGE: omtt report [OPTION] RESULTS_LOG\n"
+                         "\nRenders the results log written with the --results-log option.\n"
+                      << reportOptions;
+            return omtt::INFORMATION_PRINTED;
+        }
+
+        if (vm.count("results-log") == 0) {
+            throw std::invalid_argument("missing results log path");
+        }
+
+        if (vm.count("verdict") == 1) {
+            const std::string &verdict = vm["verdict"].as<std::string>();
+            if (verdict == omtt::to_cstring(omtt::Verdict::PASS)) {
+                filter.verdict = omtt::Verdict::PASS;
+            }
+            else if (verdict == omtt::to_cstring(omtt::Verdict::FAIL)) {
+                filter.verdict = omtt::Verdict::FAIL;
+            }
+            else {
+                throw std::invalid_argument("unknown verdict: " + verdict);
+            }
+        }
+
+        if (vm.count("path") == 1) {
+            filter.pathText = vm["path"].as<std::string>();
+        }
+
+        if (vm.count("cause") == 1) {
+            const std::string &cause = vm["cause"].as<std::string>();
+            filter.causeKind = omtt::results::cause_kind_from_name(cause);
+            if (!filter.causeKind.has_value()) {
+                throw std::invalid_argument("unknown cause kind: " + cause);
+            }
+        }
+
+        logger = CreateReportLogger(vm["format"].as<std::string>(), vm.count("resources") > 0);
+    }
+    catch (std::exception &ex) {
+        std::cerr << "command line arguments error: " << ex.what() << '\n';
+        return omtt::INVALID_COMMAND_LINE_OPTIONS;
+    }
+
+    try {
+        const omtt::results::ResultsLog log(vm["results-log"].as<omtt::Path>());
+
+        const omtt::TestPaths::size_type numberOfTestsFailed = omtt::results::render_report(log, filter, *logger);
+        logger->Flush();
+        return std::min<omtt::TestPaths::size_type>(numberOfTestsFailed, omtt::MAX_TESTS_FAILED);
+    }
+    catch (std::exception &ex) {
+        logger.reset();
+        std::cerr << "fatal error: " << ex.what() << "\n";
+        return omtt::FATAL_ERROR;
+    }
+}
+
+
+std::unique_ptr<omtt::logger::Logger>
+CreateReportLogger(const std::string &format, const bool isResourceUsageShown)
+{
+    omtt::logger::AsyncLogger::LoggerFactory factory;
+
+    if (format == "console") {
+        factory = [isResourceUsageShown](std::ostream &stream) {
+            return std::make_unique<omtt::logger::ConsoleLogger>(stream, isResourceUsageShown);
+        };
+    }
+    else if (format == "json") {
+        factory = [](std::ostream &stream) { return std::make_unique<omtt::logger::JsonLinesLogger>(stream); };
+    }
+    else if (format == "junit") {
+        factory = [](std::ostream &stream) { return std::make_unique<omtt::logger::JUnitXmlLogger>(stream); };
+    }
+    else {
+        throw std::invalid_argument("unknown report format: " + format);
+    }
+
+    return std::make_unique<omtt::logger::AsyncLogger>(factory, static_cast<int>(omtt::system::unix::FdId::STDOUT));
+}
 
-omtt::TestData
-ParseTestFile(const std::string &testFileBuffer);
 
 omtt::ProcessResults
-ExecuteSut(std::optional<omtt::Path> interpreter, const omtt::Path &sut, const omtt::TestData &testData);
+ExecuteSut(std::optional<omtt::Path> interpreter,
+           const omtt::Path &sut,
+           const omtt::expectation::PreparationContext &context,
+           const omtt::TestData &testData,
+           omtt::artifacts::ArtifactsWriter *artifacts);
 
 
 int
 main(int argc, char **argv)
 {
+    if (argc > 1 && std::string_view(argv[1]) == "report") {
+        return Report(argc - 1, argv + 1);
+    }
+
     po::variables_map vm;
 
     try {
@@ -59,6 +294,27 @@ main(int argc, char **argv)
             ("interpreter", po::value<omtt::Path>(), "path to interpreter")
             ;
 
+        po::options_description cacheOptions("Cache");
+        cacheOptions.add_options()
+            ("cache", po::value<omtt::Path>(), "path to the compiled tests cache file")
+            ;
+
+        po::options_description checkOptions("Check");
+        checkOptions.add_options()
+            ("check", "parse the test files without running the SUT and exit")
+            ;
+
+        po::options_description reportOptions("Report");
+        reportOptions.add_options()
+            ("diff", "show line differences when the whole output doesn't match")
+            ("quiet", "report the verdicts without the failure causes")
+            ("resources", "report the CPU time, memory and context switches used by the SUT")
+            ("json-report", po::value<omtt::Path>(), "write the test results to the file, in the JSON Lines format")
+            ("junit-report", po::value<omtt::Path>(), "write the test results to the file, in the JUnit XML format")
+            ("results-log", po::value<omtt::Path>(), "write the binary test results to the file instead of the console, see: omtt report")
+            ("artifacts-dir", po::value<omtt::Path>(), "save the output, error output and input of the failed tests to the directory")
+            ;
+
         po::options_description miscOptions("Miscellaneous");
         miscOptions.add_options()
             ("help", "display this help text and exit")
@@ -69,6 +325,9 @@ main(int argc, char **argv)
         po::options_description cmdline_options;
         cmdline_options.add(sutOptions);
         cmdline_options.add(interpreterOptions);
+        cmdline_options.add(cacheOptions);
+        cmdline_options.add(checkOptions);
+        cmdline_options.add(reportOptions);
         cmdline_options.add(miscOptions);
 
         po::options_description hidden;
@@ -91,6 +350,8 @@ main(int argc, char **argv)
 
         if (vm.count("help")) {
             std::cout << "USAGE: " << argv[0] << " [OPTION] --sut SUT_PATH TEST_FILE...\n"
+                         "       " << argv[0] << " --check TEST_FILE...\n"
+                         "       " << argv[0] << " report [OPTION] RESULTS_LOG\n"
                          "\nTesting tool for checking programs console output.\n"
                       << cmdline_options;
             return omtt::INFORMATION_PRINTED;
@@ -119,6 +380,10 @@ main(int argc, char **argv)
         return omtt::INVALID_COMMAND_LINE_OPTIONS;
     }
 
+    if (vm.count("check")) {
+        return CheckAllTests(vm["test-file"].as<omtt::TestPaths>());
+    }
+
     if (vm.count("sut") == 0) {
         std::cerr << "command line arguments error: missing sut.\n";
         return omtt::INVALID_COMMAND_LINE_OPTIONS;
@@ -132,15 +397,43 @@ main(int argc, char **argv)
         interpreter = vm["interpreter"].as<std::string>();
     }
 
-    std::unique_ptr<omtt::logger::Logger> logger = std::make_unique<omtt::logger::ConsoleLogger>();
+    // the report files outlive the loggers writing to them
+    std::deque<std::ofstream> reportFiles;
+    std::unique_ptr<omtt::logger::Logger> logger;
+
+    try {
+        logger = CreateLogger(vm, reportFiles);
+    }
+    catch (std::exception &ex) {
+        std::cerr << "fatal error: " << ex.what() << "\n";
+        return omtt::FATAL_ERROR;
+    }
 
     logger->SutPath(sut);
 
     try {
-        omtt::TestPaths::size_type numberOfTestsFailed = RunAllTests(interpreter, sut, testFiles, logger);
+        std::unique_ptr<omtt::cache::TestCache> cache;
+        if (vm.count("cache") == 1) {
+            cache = std::make_unique<omtt::cache::TestCache>(vm["cache"].as<omtt::Path>());
+        }
+
+        std::unique_ptr<omtt::artifacts::ArtifactsWriter> artifacts;
+        if (vm.count("artifacts-dir") == 1) {
+            artifacts = std::make_unique<omtt::artifacts::ArtifactsWriter>(vm["artifacts-dir"].as<omtt::Path>());
+        }
+
+        const omtt::ValidationMode validationMode = (vm.count("quiet") > 0)
+                                                    ? omtt::ValidationMode::VERDICT_ONLY
+                                                    : omtt::ValidationMode::ALL_CAUSES;
+
+        omtt::TestPaths::size_type numberOfTestsFailed = RunAllTests(interpreter, sut, testFiles, logger, cache, artifacts, vm.count("diff") > 0, validationMode);
+        logger->Flush();
+        SaveCache(cache);
         return std::min<omtt::TestPaths::size_type>(numberOfTestsFailed, omtt::MAX_TESTS_FAILED);
     }
     catch (std::exception &ex) {
+        // the reports of the finished tests are written before the error
+        logger.reset();
         std::cerr << "fatal error: " << ex.what() << "\n";
         return omtt::FATAL_ERROR;
     }
@@ -150,62 +443,294 @@ omtt::TestPaths::size_type
 RunAllTests(std::optional<omtt::Path> interpreter,
             const omtt::Path &sut,
             const omtt::TestPaths &tests,
-            const std::unique_ptr<omtt::logger::Logger> &logger)
+            const std::unique_ptr<omtt::logger::Logger> &logger,
+            const std::unique_ptr<omtt::cache::TestCache> &cache,
+            const std::unique_ptr<omtt::artifacts::ArtifactsWriter> &artifacts,
+            const bool isLineDiffShown,
+            const omtt::ValidationMode validationMode)
 {
+    std::vector<std::unique_ptr<TestFile>> testFiles;
+    const omtt::TestPaths::size_type numberOfTests = LoadTestFiles(tests, cache, testFiles);
+
     omtt::TestPaths::size_type executedTests = 0;
     omtt::TestPaths::size_type numberOfTestsFailed = 0;
+    omtt::regex::PatternCache patternCache;
+
+    for (omtt::TestPaths::size_type fileIndex = 0; fileIndex < tests.size(); ++fileIndex) {
+        // the buffer and the test data are released after the file tests
+        const std::unique_ptr<TestFile> loadedTestFile = std::move(testFiles[fileIndex]);
+        TestFile reloadedTestFile;
+        if (!loadedTestFile) {
+            LoadTestFile(tests[fileIndex], cache, reloadedTestFile);
+        }
+        const TestFile &testFile = loadedTestFile ? *loadedTestFile : reloadedTestFile;
+
+        for (std::vector<omtt::TestData>::size_type i = 0; i < testFile.tests.size(); ++i) {
+            ++executedTests;
 
-    for (const auto &testFileName : tests) {
-        ++executedTests;
+            const omtt::Path testName = TestCaseName(testFile, i);
+            logger->BeginTestExecution(executedTests, numberOfTests, testName);
 
-        logger->BeginTestExecution(executedTests, tests.size(), testFileName);
+            const omtt::TestData &testData = testFile.tests[i];
 
-        const std::string testFileBuffer = omtt::readFile(testFileName);
+            const auto testBegin = std::chrono::steady_clock::now();
 
-        const omtt::TestData testData = ParseTestFile(testFileBuffer);
+            omtt::ProcessResults processResults{};
+            omtt::TestExecutionSummary summary;
+            // the cause points into the error, it is kept until the test is logged
+            std::optional<omtt::exception::InputFileException> inputFileError;
 
-        const omtt::ProcessResults processResults = ExecuteSut(interpreter, sut, testData);
+            try {
+                processResults = ExecuteSut(interpreter, sut, {testFile.path, patternCache, isLineDiffShown}, testData, artifacts.get());
+                summary = omtt::ValidateExpectationsAndSutResults(testData, processResults, validationMode);
+            }
+            catch (const omtt::exception::InputFileException &ex) {
+                // the SUT didn't run, only this test fails and the next ones still run
+                inputFileError.emplace(ex);
+                summary.verdict = omtt::Verdict::FAIL;
+                summary.causes.emplace_back(omtt::expectation::validation::InputFileCause{inputFileError->GetPath(),
+                                                                                         inputFileError->GetReason()});
+            }
+            summary.duration = std::chrono::steady_clock::now() - testBegin;
 
-        const omtt::TestExecutionSummary summary = omtt::ValidateExpectationsAndSutResults(testData, processResults);
+            logger->EndTestExecution(processResults, summary);
 
-        logger->EndTestExecution(processResults, summary);
+            if (summary.verdict != omtt::Verdict::PASS) {
+                ++numberOfTestsFailed;
 
-        if (summary.verdict != omtt::Verdict::PASS) {
-            ++numberOfTestsFailed;
+                if (artifacts && !inputFileError.has_value()) {
+                    SaveArtifacts(*artifacts, testName, testFile, testData, processResults);
+                }
+            }
         }
     }
 
-    logger->OverallStatistics(tests.size(),
-                              tests.size() - numberOfTestsFailed,
+    logger->OverallStatistics(numberOfTests,
+                              numberOfTests - numberOfTestsFailed,
                               numberOfTestsFailed);
 
     return numberOfTestsFailed;
 }
 
 
-omtt::TestData
-ParseTestFile(const std::string &testFileBuffer)
+std::unique_ptr<omtt::logger::Logger>
+CreateLogger(const po::variables_map &vm,
+             std::deque<std::ofstream> &reportFiles)
+{
+    std::vector<std::unique_ptr<omtt::logger::Logger>> loggers;
+
+    if (vm.count("results-log") == 1) {
+        // the console report is made later from the log
+        const omtt::Path &path = vm["results-log"].as<omtt::Path>();
+        std::ofstream &logFile = OpenReportFile(path, reportFiles);
+        std::ofstream &contextFile = OpenReportFile(path + omtt::results::detail::CONTEXT_FILE_SUFFIX, reportFiles);
+        loggers.push_back(std::make_unique<omtt::logger::ResultsLogLogger>(logFile, contextFile));
+    }
+    else {
+        // a slow terminal or pipe doesn't stop the tests
+        const bool isResourceUsageShown = vm.count("resources") > 0;
+        loggers.push_back(std::make_unique<omtt::logger::AsyncLogger>(
+            [isResourceUsageShown](std::ostream &stream) {
+                return std::make_unique<omtt::logger::ConsoleLogger>(stream, isResourceUsageShown);
+            },
+            static_cast<int>(omtt::system::unix::FdId::STDOUT)));
+    }
+
+    if (vm.count("json-report") == 1) {
+        std::ofstream &file = OpenReportFile(vm["json-report"].as<omtt::Path>(), reportFiles);
+        loggers.push_back(std::make_unique<omtt::logger::JsonLinesLogger>(file));
+    }
+
+    if (vm.count("junit-report") == 1) {
+        std::ofstream &file = OpenReportFile(vm["junit-report"].as<omtt::Path>(), reportFiles);
+        loggers.push_back(std::make_unique<omtt::logger::JUnitXmlLogger>(file));
+    }
+
+    if (loggers.size() == 1) {
+        return std::move(loggers.front());
+    }
+
+    return std::make_unique<omtt::logger::MultiLogger>(std::move(loggers));
+}
+
+
+std::ofstream &
+OpenReportFile(const omtt::Path &path,
+               std::deque<std::ofstream> &reportFiles)
+{
+    std::ofstream &file = reportFiles.emplace_back(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw omtt::exception::FileWriteException("failed to open file: " + path);
+    }
+
+    return file;
+}
+
+
+omtt::TestPaths::size_type
+LoadTestFiles(const omtt::TestPaths &tests,
+              const std::unique_ptr<omtt::cache::TestCache> &cache,
+              std::vector<std::unique_ptr<TestFile>> &testFiles)
+{
+    omtt::TestPaths::size_type numberOfTests = 0;
+    std::string::size_type keptSize = 0;
+
+    testFiles.resize(tests.size());
+
+    // every file is checked here, the parse errors are reported before the first test runs
+    for (omtt::TestPaths::size_type i = 0; i < tests.size(); ++i) {
+        if (cache) {
+            // an up to date entry is a file which was parsed without errors
+            const auto count = cache->FindTestsCount(tests[i]);
+            if (count.has_value()) {
+                numberOfTests += *count;
+                continue;
+            }
+        }
+
+        auto testFile = std::make_unique<TestFile>();
+        LoadTestFile(tests[i], cache, *testFile);
+        numberOfTests += testFile->tests.size();
+
+        if (keptSize + testFile->buffer.size() <= KEPT_TEST_FILES_SIZE) {
+            keptSize += testFile->buffer.size();
+            testFiles[i] = std::move(testFile);
+        }
+    }
+
+    return numberOfTests;
+}
+
+
+void
+LoadTestFile(const omtt::Path &testFileName,
+             const std::unique_ptr<omtt::cache::TestCache> &cache,
+             TestFile &testFile)
+{
+    // test data points into the buffer, so the file is loaded in place
+    testFile.path = testFileName;
+    testFile.buffer = omtt::readFile(testFileName);
+
+    try {
+        testFile.tests = ParseTestFile(testFile.path, testFile.buffer, cache);
+    }
+    catch (std::runtime_error &ex) {
+        throw omtt::exception::TestFileParseException(testFileName, ex.what());
+    }
+}
+
+
+omtt::Path
+TestCaseName(const TestFile &testFile, const std::vector<omtt::TestData>::size_type index)
 {
+    if (testFile.tests.size() == 1) {
+        return testFile.path;
+    }
+
+    return testFile.path + "#" + std::to_string(index + 1);
+}
+
+
+std::vector<omtt::TestData>
+ParseTestFile(const omtt::Path &testFileName,
+              const std::string &testFileBuffer,
+              const std::unique_ptr<omtt::cache::TestCache> &cache)
+{
+    if (cache) {
+        return cache->Parse(testFileName, testFileBuffer);
+    }
+
     omtt::lexer::Lexer lexer(testFileBuffer);
     omtt::parser::Parser parser(lexer);
 
-    return parser.parse();
+    return parser.parseAll();
+}
+
+
+void
+SaveCache(const std::unique_ptr<omtt::cache::TestCache> &cache)
+{
+    if (!cache) {
+        return;
+    }
+
+    try {
+        cache->Save();
+    }
+    catch (std::exception &ex) {
+        std::cerr << "warning: failed to save tests cache: " << ex.what() << "\n";
+    }
+}
+
+
+void
+SaveArtifacts(omtt::artifacts::ArtifactsWriter &artifacts,
+              const omtt::Path &testName,
+              const TestFile &testFile,
+              const omtt::TestData &testData,
+              const omtt::ProcessResults &processResults)
+{
+    std::optional<omtt::Path> inputFilePath;
+    if (testData.inputFile.has_value()) {
+        inputFilePath = omtt::resolvePath(testFile.path, *testData.inputFile);
+    }
+
+    try {
+        artifacts.Save(testName, processResults.errors, testData.input, inputFilePath);
+    }
+    catch (std::exception &ex) {
+        std::cerr << "warning: failed to save artifacts of " << testName << ": " << ex.what() << "\n";
+    }
 }
 
 
 omtt::ProcessResults
-ExecuteSut(std::optional<omtt::Path> interpreter, const omtt::Path &sut, const omtt::TestData &testData)
+ExecuteSut(std::optional<omtt::Path> interpreter,
+           const omtt::Path &sut,
+           const omtt::expectation::PreparationContext &context,
+           const omtt::TestData &testData,
+           omtt::artifacts::ArtifactsWriter *artifacts)
 {
     omtt::ProcessResults results;
+    std::optional<omtt::Path> inputFilePath;
+
+    if (testData.inputFile.has_value()) {
+        inputFilePath = omtt::resolvePath(context.testFilePath, *testData.inputFile);
+    }
+
+    omtt::OutputDispatcher outputDispatcher(testData, context);
+    omtt::OutputObserver *outputObserver = &outputDispatcher;
+
+    if (artifacts != nullptr) {
+        // the whole output is kept, the failed test saves it later
+        outputObserver = &artifacts->Record(outputDispatcher);
+    }
 
     if (interpreter.has_value()) {
-        results = omtt::RunProcess(*interpreter, {sut}, testData.input);
+        results = omtt::RunProcess(*interpreter, {sut}, testData.input, inputFilePath, outputObserver);
     }
     else {
-        results = omtt::RunProcess(sut, {}, testData.input);
+        results = omtt::RunProcess(sut, {}, testData.input, inputFilePath, outputObserver);
     }
 
-    omtt::changeLineEndingsToLf(results.output);
+    results.output = outputDispatcher.TakeOutput();
+
+    const bool isErrorOutputChecked = std::any_of(testData.expectations.begin(),
+                                                  testData.expectations.end(),
+                                                  [](const auto &expectation) {
+                                                      return expectation->NeedsErrorOutput();
+                                                  });
+
+    // the reports show the error output as it is, the expectations check
+    // a copy changed the same way as the output
+    if (isErrorOutputChecked) {
+        std::string errors = results.errors;
+        omtt::changeLineEndingsToLf(errors);
+        if (!testData.normalization.empty()) {
+            errors = omtt::normalize::normalized(testData.normalization, std::move(errors));
+        }
+        results.normalizedErrors = std::move(errors);
+    }
 
     return results;
 }
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/normalize/Normalizer.hpp"
+
+
+namespace omtt::normalize
+{
+
+namespace
+{
+
+constexpr char MASK = '#';
+
+bool
+is_digit(const char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool
+is_hex_digit(const char c)
+{
+    return is_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool
+is_word_character(const char c)
+{
+    return is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+}
+
+Normalizer::Normalizer(const Filters &filters)
+{
+    for (const Filter filter : filters) {
+        fStates.push_back({filter, {}, 1, false, {'\n', '\n', '\n'}});
+    }
+}
+
+void
+Normalizer::Apply(std::string &chunk, const Sink &sink)
+{
+    _Apply(0, chunk, sink);
+}
+
+void
+Normalizer::_Apply(const std::vector<FilterState>::size_type first, std::string &chunk, const Sink &sink)
+{
+    for (auto i = first; i < fStates.size(); ++i) {
+        auto &state = fStates[i];
+
+        switch (state.filter) {
+            case Filter::TRIM: {
+                std::string releasedSpaces;
+                _Trim(state, chunk, releasedSpaces);
+
+                // the spaces go through the next filters before the chunk
+                if (!releasedSpaces.empty()) {
+                    _Apply(i + 1, releasedSpaces, sink);
+                }
+                break;
+            }
+            case Filter::SQUEEZE:
+                _Squeeze(state, chunk);
+                break;
+            case Filter::MASK_INT:
+                _MaskInt(state, chunk);
+                break;
+            case Filter::MASK_HEX:
+                _MaskHex(state, chunk);
+                break;
+        }
+    }
+
+    if (!chunk.empty()) {
+        sink(chunk);
+    }
+}
+
+void
+Normalizer::_Trim(FilterState &state, std::string &chunk, std::string &releasedSpaces)
+{
+    const std::string::size_type textBegin = chunk.find_first_not_of(" \t");
+
+    if (!state.pendingSpaces.empty() && textBegin != std::string::npos) {
+        // the spaces from the previous chunks are dropped at the line end
+        if (chunk[textBegin] != '\n') {
+            releasedSpaces.swap(state.pendingSpaces);
+        }
+        state.pendingSpaces.clear();
+    }
+
+    std::string::size_type out = 0;
+    std::string::size_type spacesBegin = std::string::npos;
+
+    for (std::string::size_type i = 0; i < chunk.size(); ++i) {
+        const char c = chunk[i];
+
+        if (c == ' ' || c == '\t') {
+            if (spacesBegin == std::string::npos) {
+                spacesBegin = out;
+            }
+        }
+        else if (c == '\n' && spacesBegin != std::string::npos) {
+            out = spacesBegin;
+            spacesBegin = std::string::npos;
+        }
+        else {
+            spacesBegin = std::string::npos;
+        }
+
+        chunk[out++] = c;
+    }
+
+    if (spacesBegin != std::string::npos) {
+        state.pendingSpaces.append(chunk, spacesBegin, out - spacesBegin);
+        out = spacesBegin;
+    }
+
+    chunk.resize(out);
+}
+
+void
+Normalizer::_Squeeze(FilterState &state, std::string &chunk)
+{
+    std::string::size_type out = 0;
+
+    for (const char c : chunk) {
+        if (c == '\n') {
+            if (++state.newLines > 2) {
+                continue;
+            }
+        }
+        else {
+            state.newLines = 0;
+        }
+
+        chunk[out++] = c;
+    }
+
+    chunk.resize(out);
+}
+
+void
+Normalizer::_MaskInt(FilterState &state, std::string &chunk)
+{
+    std::string::size_type out = 0;
+
+    for (const char c : chunk) {
+        if (is_digit(c)) {
+            if (state.isMasking) {
+                continue;
+            }
+            state.isMasking = true;
+            chunk[out++] = MASK;
+        }
+        else {
+            state.isMasking = false;
+            chunk[out++] = c;
+        }
+    }
+
+    chunk.resize(out);
+}
+
+void
+Normalizer::_MaskHex(FilterState &state, std::string &chunk)
+{
+    std::string::size_type out = 0;
+
+    for (const char c : chunk) {
+        if (state.isMasking && is_hex_digit(c)) {
+            continue;
+        }
+        state.isMasking = false;
+
+        // the prefix is kept, the digits after it are masked
+        const bool isAfterPrefix = (state.recent[2] == 'x' || state.recent[2] == 'X')
+                                   && state.recent[1] == '0'
+                                   && !is_word_character(state.recent[0]);
+        if (isAfterPrefix && is_hex_digit(c)) {
+            state.isMasking = true;
+            chunk[out++] = MASK;
+        }
+        else {
+            chunk[out++] = c;
+        }
+
+        state.recent[0] = state.recent[1];
+        state.recent[1] = state.recent[2];
+        state.recent[2] = c;
+    }
+
+    chunk.resize(out);
+}
+
+std::string
+normalized(const Filters &filters, std::string text)
+{
+    Normalizer normalizer(filters);
+    std::string result;
+
+    normalizer.Apply(text, [&result](const std::string_view &piece) {
+        result.append(piece);
+    });
+
+    return result;
+}
+
+}  // omtt::normalize
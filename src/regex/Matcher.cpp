@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/regex/Matcher.hpp"
+
+
+namespace omtt::regex
+{
+
+Matcher::Matcher(Regex &regex)
+    :
+    fRegex(regex),
+    fState(regex._StartState()),
+    fIsDecided(fState == Regex::DECIDED),
+    fIsMatched(fIsDecided && regex.GetMode() == Mode::SEARCH),
+    fConsumedSize(0)
+{
+}
+
+std::size_t
+Matcher::Feed(const std::string_view &chunk)
+{
+    std::size_t consumed = 0;
+
+    while (consumed < chunk.size() && !fIsDecided) {
+        const auto byte = static_cast<unsigned char>(chunk[consumed]);
+
+        if (fUncachedState.has_value()) {
+            _StepUncached(byte);
+        }
+        else {
+            std::int32_t next = fRegex.fTransitions[fState * fRegex.fClassCount + fRegex.fByteClass[byte]];
+
+            if (next == Regex::UNKNOWN) {
+                next = fRegex._ComputeTransition(fState, byte);
+            }
+
+            if (next == Regex::UNCACHED) {
+                fUncachedState = fRegex.fStates[fState];
+                _StepUncached(byte);
+            }
+            else if (next == Regex::DECIDED) {
+                fIsDecided = true;
+                fIsMatched = (fRegex.GetMode() == Mode::SEARCH);
+            }
+            else {
+                fState = next;
+            }
+        }
+
+        if (fIsDecided && !fIsMatched) {
+            break;
+        }
+
+        ++consumed;
+    }
+
+    fConsumedSize += consumed;
+    return consumed;
+}
+
+bool
+Matcher::Finish()
+{
+    if (!fIsDecided) {
+        fIsDecided = true;
+        fIsMatched = fRegex._IsMatchAtEnd(fUncachedState.has_value() ? *fUncachedState : fRegex.fStates[fState]);
+    }
+
+    return fIsMatched;
+}
+
+bool
+Matcher::IsDecided() const
+{
+    return fIsDecided;
+}
+
+std::size_t
+Matcher::GetMatchedPrefixSize() const
+{
+    return fConsumedSize;
+}
+
+void
+Matcher::_StepUncached(const unsigned char byte)
+{
+    Regex::Step step = fRegex._Step(*fUncachedState, byte);
+
+    if (step.isDecided) {
+        fIsDecided = true;
+        fIsMatched = (fRegex.GetMode() == Mode::SEARCH);
+        return;
+    }
+
+    // back to the DFA when the state is known
+    const std::int32_t state = fRegex._FindState(step.next);
+    if (state != Regex::UNKNOWN) {
+        fState = state;
+        fUncachedState.reset();
+    }
+    else {
+        fUncachedState = std::move(step.next);
+    }
+}
+
+}  // omtt::regex
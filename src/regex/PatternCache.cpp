@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/regex/PatternCache.hpp"
+
+
+namespace omtt::regex
+{
+
+Regex &
+PatternCache::Get(const std::string_view &pattern, const Mode mode)
+{
+    std::string key;
+    key.reserve(pattern.size() + 1);
+    key += (mode == Mode::WHOLE_TEXT) ? 'W' : 'S';
+    key += pattern;
+
+    auto &regex = fRegexes[key];
+    if (!regex) {
+        regex = std::make_unique<Regex>(pattern, mode);
+    }
+
+    return *regex;
+}
+
+}  // omtt::regex
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/regex/Regex.hpp"
+
+#include <algorithm>
+
+
+namespace omtt::regex
+{
+
+namespace
+{
+
+constexpr std::size_t MAX_DFA_STATES = 4096;
+
+}
+
+void
+checkSyntax(const std::string_view &pattern)
+{
+    detail::compile(pattern);
+}
+
+bool
+Regex::StateKey::operator==(const StateKey &other) const
+{
+    return isAtLineStart == other.isAtLineStart && instructions == other.instructions;
+}
+
+std::size_t
+Regex::StateKeyHash::operator()(const StateKey &key) const
+{
+    std::size_t hash = key.isAtLineStart ? 1 : 0;
+    for (const std::uint32_t instruction : key.instructions) {
+        hash = hash * 1099511628211u ^ instruction;
+    }
+    return hash;
+}
+
+Regex::Regex(const std::string_view &pattern, const Mode mode)
+    :
+    fMode(mode),
+    fProgram(detail::compile(pattern)),
+    fClassCount(0),
+    fVisited(fProgram.instructions.size(), 0),
+    fVisitMark(0)
+{
+    // bytes that are members of the same byte sets behave the same way
+    std::array<bool, 256> isClassBegin{};
+    isClassBegin[0] = true;
+    isClassBegin['\n'] = true;
+    isClassBegin['\n' + 1] = true;
+
+    for (const auto &byteSet : fProgram.byteSets) {
+        for (unsigned byte = 1; byte < 256; ++byte) {
+            if (byteSet.test(byte) != byteSet.test(byte - 1)) {
+                isClassBegin[byte] = true;
+            }
+        }
+    }
+
+    for (unsigned byte = 0; byte < 256; ++byte) {
+        if (isClassBegin[byte]) {
+            ++fClassCount;
+        }
+        fByteClass[byte] = static_cast<std::uint16_t>(fClassCount - 1);
+    }
+
+    _FindOrAddState(_StartKey());
+}
+
+Mode
+Regex::GetMode() const
+{
+    return fMode;
+}
+
+std::int32_t
+Regex::_StartState()
+{
+    if (_IsDecidedState(fStates.front())) {
+        return DECIDED;
+    }
+
+    return 0;
+}
+
+std::int32_t
+Regex::_ComputeTransition(const std::uint32_t state, const unsigned char byte)
+{
+    Step step = _Step(fStates[state], byte);
+
+    std::int32_t next = DECIDED;
+    if (!step.isDecided) {
+        next = _FindOrAddState(std::move(step.next));
+    }
+
+    if (next != UNCACHED) {
+        fTransitions[state * fClassCount + fByteClass[byte]] = next;
+    }
+
+    return next;
+}
+
+std::int32_t
+Regex::_FindOrAddState(StateKey &&key)
+{
+    const std::int32_t found = _FindState(key);
+    if (found != UNKNOWN) {
+        return found;
+    }
+
+    if (fStates.size() >= MAX_DFA_STATES) {
+        return UNCACHED;
+    }
+
+    const auto index = static_cast<std::int32_t>(fStates.size());
+    fStateIndexes.emplace(key, index);
+    fStates.push_back(std::move(key));
+    fTransitions.resize(fTransitions.size() + fClassCount, UNKNOWN);
+
+    return index;
+}
+
+std::int32_t
+Regex::_FindState(const StateKey &key) const
+{
+    const auto it = fStateIndexes.find(key);
+    return (it != fStateIndexes.end()) ? it->second : UNKNOWN;
+}
+
+bool
+Regex::_IsDecidedState(const StateKey &key) const
+{
+    if (fMode == Mode::WHOLE_TEXT) {
+        return key.instructions.empty();
+    }
+
+    return std::any_of(key.instructions.begin(),
+                       key.instructions.end(),
+                       [this](const std::uint32_t instruction) {
+                           return fProgram.instructions[instruction].kind == detail::Instruction::Kind::MATCH;
+                       });
+}
+
+Regex::Step
+Regex::_Step(const StateKey &key, const unsigned char byte)
+{
+    const bool isNewLine = (byte == '\n');
+
+    // the line end assertions are passed only now, when the next byte is known
+    _NewVisitMark();
+    fExpanded.clear();
+    for (const std::uint32_t instruction : key.instructions) {
+        _AddClosure(instruction, key.isAtLineStart, isNewLine, fExpanded);
+    }
+
+    Step step{{{}, isNewLine}, false};
+
+    _NewVisitMark();
+    for (const std::uint32_t instruction : fExpanded) {
+        const auto &current = fProgram.instructions[instruction];
+
+        if (current.kind == detail::Instruction::Kind::MATCH && fMode == Mode::SEARCH) {
+            step.isDecided = true;
+            return step;
+        }
+
+        if (current.kind == detail::Instruction::Kind::BYTES
+            && fProgram.byteSets[current.byteSet].test(byte)) {
+            _AddClosure(current.out, isNewLine, false, step.next.instructions);
+        }
+    }
+
+    if (fMode == Mode::SEARCH) {
+        _AddClosure(fProgram.start, isNewLine, false, step.next.instructions);
+    }
+
+    std::sort(step.next.instructions.begin(), step.next.instructions.end());
+    step.isDecided = _IsDecidedState(step.next);
+
+    return step;
+}
+
+bool
+Regex::_IsMatchAtEnd(const StateKey &key)
+{
+    _NewVisitMark();
+    fExpanded.clear();
+    for (const std::uint32_t instruction : key.instructions) {
+        _AddClosure(instruction, key.isAtLineStart, true, fExpanded);
+    }
+
+    return std::any_of(fExpanded.begin(),
+                       fExpanded.end(),
+                       [this](const std::uint32_t instruction) {
+                           return fProgram.instructions[instruction].kind == detail::Instruction::Kind::MATCH;
+                       });
+}
+
+Regex::StateKey
+Regex::_StartKey()
+{
+    StateKey key{{}, true};
+
+    _NewVisitMark();
+    _AddClosure(fProgram.start, true, false, key.instructions);
+    std::sort(key.instructions.begin(), key.instructions.end());
+
+    return key;
+}
+
+void
+Regex::_NewVisitMark()
+{
+    if (++fVisitMark == 0) {
+        std::fill(fVisited.begin(), fVisited.end(), 0);
+        fVisitMark = 1;
+    }
+}
+
+void
+Regex::_AddClosure(const std::uint32_t instruction,
+                   const bool isAtLineStart,
+                   const bool isAtLineEnd,
+                   std::vector<std::uint32_t> &instructions)
+{
+    fStack.push_back(instruction);
+
+    while (!fStack.empty()) {
+        const std::uint32_t index = fStack.back();
+        fStack.pop_back();
+
+        if (fVisited[index] == fVisitMark) {
+            continue;
+        }
+        fVisited[index] = fVisitMark;
+
+        const auto &current = fProgram.instructions[index];
+        switch (current.kind) {
+            case detail::Instruction::Kind::SPLIT:
+                fStack.push_back(current.out1);
+                fStack.push_back(current.out);
+                break;
+
+            case detail::Instruction::Kind::LINE_BEGIN:
+                if (isAtLineStart) {
+                    fStack.push_back(current.out);
+                }
+                break;
+
+            case detail::Instruction::Kind::LINE_END:
+                if (isAtLineEnd) {
+                    fStack.push_back(current.out);
+                }
+                else {
+                    // stays in the state until the next byte is known
+                    instructions.push_back(index);
+                }
+                break;
+
+            case detail::Instruction::Kind::BYTES:
+            case detail::Instruction::Kind::MATCH:
+                instructions.push_back(index);
+                break;
+        }
+    }
+}
+
+}  // omtt::regex
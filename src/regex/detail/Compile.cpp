@@ -0,0 +1,605 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/regex/detail/Program.hpp"
+#include "headers/regex/exception/SyntaxException.hpp"
+
+#include <cctype>
+
+
+namespace omtt::regex::detail
+{
+
+namespace
+{
+
+constexpr int MAX_REPETITION = 1000;
+constexpr int INFINITE_REPETITION = -1;
+constexpr std::size_t MAX_INSTRUCTIONS = 100000;
+constexpr int MAX_GROUP_DEPTH = 1000;
+
+struct Node
+{
+    enum class Kind
+    {
+        EMPTY,
+        BYTES,
+        CONCATENATION,
+        ALTERNATION,
+        REPETITION,
+        LINE_BEGIN,
+        LINE_END
+    };
+
+    Kind kind;
+    ByteSet bytes;
+    std::vector<Node> children;
+    int min;
+    int max;
+};
+
+Node
+make_node(const Node::Kind kind)
+{
+    return Node{kind, {}, {}, 0, 0};
+}
+
+Node
+make_bytes_node(const ByteSet &bytes)
+{
+    Node node = make_node(Node::Kind::BYTES);
+    node.bytes = bytes;
+    return node;
+}
+
+ByteSet
+make_range(const unsigned char first, const unsigned char last)
+{
+    ByteSet bytes;
+    for (unsigned ch = first; ch <= last; ++ch) {
+        bytes.set(ch);
+    }
+    return bytes;
+}
+
+ByteSet
+make_any_but_new_line()
+{
+    ByteSet bytes;
+    bytes.set();
+    bytes.reset('\n');
+    return bytes;
+}
+
+int
+hex_digit_value(const char ch)
+{
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
+
+/*
+ * Recursive descent parser of the pattern:
+ *   alternation   := concatenation ('|' concatenation)*
+ *   concatenation := repetition*
+ *   repetition    := atom ('*' | '+' | '?' | '{n}' | '{n,}' | '{n,m}')*
+ *   atom          := '(' alternation ')' | '[' bracket ']' | '.' | '^' | '$'
+ *                  | '\' escape | byte
+ */
+class PatternParser
+{
+public:
+    explicit PatternParser(const std::string_view &pattern)
+        :
+        fPattern(pattern),
+        fPosition(0),
+        fDepth(0)
+    {
+    }
+
+    Node
+    Parse()
+    {
+        Node node = _ParseAlternation();
+
+        if (!_IsAtEnd()) {
+            _Throw("unmatched ')'");
+        }
+
+        return node;
+    }
+
+private:
+    Node
+    _ParseAlternation()
+    {
+        Node first = _ParseConcatenation();
+
+        if (_IsAtEnd() || _Peek() != '|') {
+            return first;
+        }
+
+        Node node = make_node(Node::Kind::ALTERNATION);
+        node.children.push_back(std::move(first));
+
+        while (!_IsAtEnd() && _Peek() == '|') {
+            ++fPosition;
+            node.children.push_back(_ParseConcatenation());
+        }
+
+        return node;
+    }
+
+    Node
+    _ParseConcatenation()
+    {
+        Node node = make_node(Node::Kind::CONCATENATION);
+
+        while (!_IsAtEnd() && _Peek() != '|' && _Peek() != ')') {
+            node.children.push_back(_ParseRepetition());
+        }
+
+        if (node.children.empty()) {
+            return make_node(Node::Kind::EMPTY);
+        }
+        if (node.children.size() == 1) {
+            return std::move(node.children.front());
+        }
+        return node;
+    }
+
+    Node
+    _ParseRepetition()
+    {
+        Node node = _ParseAtom();
+
+        while (!_IsAtEnd()) {
+            int min = 0;
+            int max = INFINITE_REPETITION;
+
+            switch (_Peek()) {
+                case '*':
+                    ++fPosition;
+                    break;
+                case '+':
+                    ++fPosition;
+                    min = 1;
+                    break;
+                case '?':
+                    ++fPosition;
+                    max = 1;
+                    break;
+                case '{':
+                    _ParseBounds(min, max);
+                    break;
+                default:
+                    return node;
+            }
+
+            Node repetition = make_node(Node::Kind::REPETITION);
+            repetition.min = min;
+            repetition.max = max;
+            repetition.children.push_back(std::move(node));
+            node = std::move(repetition);
+        }
+
+        return node;
+    }
+
+    void
+    _ParseBounds(int &min, int &max)
+    {
+        const std::string_view::size_type begin = fPosition;
+        ++fPosition;
+
+        min = _ParseNumber(begin);
+        max = min;
+
+        if (!_IsAtEnd() && _Peek() == ',') {
+            ++fPosition;
+            max = (!_IsAtEnd() && _Peek() == '}') ? INFINITE_REPETITION : _ParseNumber(begin);
+        }
+
+        if (_IsAtEnd() || _Peek() != '}') {
+            _Throw("invalid repetition", begin);
+        }
+        ++fPosition;
+
+        if (max != INFINITE_REPETITION && max < min) {
+            _Throw("invalid repetition range", begin);
+        }
+    }
+
+    int
+    _ParseNumber(const std::string_view::size_type begin)
+    {
+        if (_IsAtEnd() || !std::isdigit(static_cast<unsigned char>(_Peek()))) {
+            _Throw("invalid repetition", begin);
+        }
+
+        int value = 0;
+        while (!_IsAtEnd() && std::isdigit(static_cast<unsigned char>(_Peek()))) {
+            value = value * 10 + (_Peek() - '0');
+            if (value > MAX_REPETITION) {
+                _Throw("repetition count is greater than " + std::to_string(MAX_REPETITION), begin);
+            }
+            ++fPosition;
+        }
+
+        return value;
+    }
+
+    Node
+    _ParseAtom()
+    {
+        const char ch = _Peek();
+
+        switch (ch) {
+            case '(':
+                return _ParseGroup();
+            case '[':
+                return make_bytes_node(_ParseBracket());
+            case '.':
+                ++fPosition;
+                return make_bytes_node(make_any_but_new_line());
+            case '^':
+                ++fPosition;
+                return make_node(Node::Kind::LINE_BEGIN);
+            case '$':
+                ++fPosition;
+                return make_node(Node::Kind::LINE_END);
+            case '\\':
+                return make_bytes_node(_ParseEscape());
+            case '*':
+            case '+':
+            case '?':
+                _Throw("nothing to repeat");
+        }
+
+        ++fPosition;
+        ByteSet bytes;
+        bytes.set(static_cast<unsigned char>(ch));
+        return make_bytes_node(bytes);
+    }
+
+    Node
+    _ParseGroup()
+    {
+        const std::string_view::size_type begin = fPosition;
+        ++fPosition;
+
+        // non-capturing group syntax is accepted, no group captures anything
+        if (fPattern.substr(fPosition, 2) == "?:") {
+            fPosition += 2;
+        }
+
+        if (++fDepth > MAX_GROUP_DEPTH) {
+            _Throw("groups are nested too deeply", begin);
+        }
+        Node node = _ParseAlternation();
+        --fDepth;
+
+        if (_IsAtEnd()) {
+            _Throw("missing ')'", begin);
+        }
+        ++fPosition;
+
+        return node;
+    }
+
+    ByteSet
+    _ParseBracket()
+    {
+        const std::string_view::size_type begin = fPosition;
+        ++fPosition;
+
+        bool isNegated = false;
+        if (!_IsAtEnd() && _Peek() == '^') {
+            isNegated = true;
+            ++fPosition;
+        }
+
+        ByteSet bytes;
+        bool isFirst = true;
+
+        while (true) {
+            if (_IsAtEnd()) {
+                _Throw("missing ']'", begin);
+            }
+
+            if (_Peek() == ']' && !isFirst) {
+                ++fPosition;
+                break;
+            }
+            isFirst = false;
+
+            const std::string_view::size_type itemBegin = fPosition;
+            const ByteSet item = _ParseBracketItem();
+
+            const bool isRange = fPosition + 1 < fPattern.size()
+                                 && _Peek() == '-'
+                                 && fPattern[fPosition + 1] != ']';
+            if (!isRange) {
+                bytes |= item;
+                continue;
+            }
+
+            ++fPosition;
+            const ByteSet last = _ParseBracketItem();
+            if (item.count() != 1 || last.count() != 1) {
+                _Throw("invalid range", itemBegin);
+            }
+
+            const unsigned char first = _SingleByte(item);
+            const unsigned char end = _SingleByte(last);
+            if (end < first) {
+                _Throw("invalid range", itemBegin);
+            }
+            bytes |= make_range(first, end);
+        }
+
+        if (isNegated) {
+            bytes.flip();
+        }
+        return bytes;
+    }
+
+    ByteSet
+    _ParseBracketItem()
+    {
+        if (_Peek() == '\\') {
+            return _ParseEscape();
+        }
+
+        ByteSet bytes;
+        bytes.set(static_cast<unsigned char>(_Peek()));
+        ++fPosition;
+        return bytes;
+    }
+
+    ByteSet
+    _ParseEscape()
+    {
+        const std::string_view::size_type begin = fPosition;
+        ++fPosition;
+
+        if (_IsAtEnd()) {
+            _Throw("trailing '\\'", begin);
+        }
+
+        const char ch = _Peek();
+        ++fPosition;
+
+        ByteSet bytes;
+        switch (ch) {
+            case 'd':
+            case 'D':
+                bytes = make_range('0', '9');
+                break;
+            case 'w':
+            case 'W':
+                bytes = make_range('a', 'z') | make_range('A', 'Z') | make_range('0', '9');
+                bytes.set('_');
+                break;
+            case 's':
+            case 'S':
+                for (const char space : {' ', '\t', '\n', '\r', '\f', '\v'}) {
+                    bytes.set(static_cast<unsigned char>(space));
+                }
+                break;
+            case 'n':
+                bytes.set('\n');
+                return bytes;
+            case 't':
+                bytes.set('\t');
+                return bytes;
+            case 'r':
+                bytes.set('\r');
+                return bytes;
+            case 'f':
+                bytes.set('\f');
+                return bytes;
+            case 'v':
+                bytes.set('\v');
+                return bytes;
+            case 'x':
+                bytes.set(_ParseHexByte(begin));
+                return bytes;
+            default:
+                if (std::isalnum(static_cast<unsigned char>(ch))) {
+                    _Throw(std::string("unknown escape sequence '\\") + ch + "'", begin);
+                }
+                bytes.set(static_cast<unsigned char>(ch));
+                return bytes;
+        }
+
+        if (std::isupper(static_cast<unsigned char>(ch))) {
+            bytes.flip();
+        }
+        return bytes;
+    }
+
+    unsigned char
+    _ParseHexByte(const std::string_view::size_type begin)
+    {
+        if (fPosition + 2 > fPattern.size()) {
+            _Throw("invalid '\\x' escape sequence", begin);
+        }
+
+        const int high = hex_digit_value(fPattern[fPosition]);
+        const int low = hex_digit_value(fPattern[fPosition + 1]);
+        if (high < 0 || low < 0) {
+            _Throw("invalid '\\x' escape sequence", begin);
+        }
+
+        fPosition += 2;
+        return static_cast<unsigned char>(high * 16 + low);
+    }
+
+    static unsigned char
+    _SingleByte(const ByteSet &bytes)
+    {
+        unsigned ch = 0;
+        while (!bytes.test(ch)) {
+            ++ch;
+        }
+        return static_cast<unsigned char>(ch);
+    }
+
+    bool
+    _IsAtEnd() const
+    {
+        return fPosition >= fPattern.size();
+    }
+
+    char
+    _Peek() const
+    {
+        return fPattern[fPosition];
+    }
+
+    [[noreturn]] void
+    _Throw(const std::string &message)
+    {
+        _Throw(message, fPosition);
+    }
+
+    [[noreturn]] void
+    _Throw(const std::string &message, const std::string_view::size_type position)
+    {
+        throw exception::SyntaxException(fPattern, message, position);
+    }
+
+private:
+    const std::string_view fPattern;
+    std::string_view::size_type fPosition;
+    int fDepth;
+};
+
+/*
+ * Emits the instructions backwards, each node gets the instruction that
+ * follows it and returns its first instruction.
+ */
+class ProgramBuilder
+{
+public:
+    explicit ProgramBuilder(const std::string_view &pattern)
+        :
+        fPattern(pattern)
+    {
+    }
+
+    Program
+    Build(const Node &root)
+    {
+        const std::uint32_t match = _Emit({Instruction::Kind::MATCH, 0, 0, 0});
+        fProgram.start = _Emit(root, match);
+        return std::move(fProgram);
+    }
+
+private:
+    std::uint32_t
+    _Emit(const Node &node, const std::uint32_t next)
+    {
+        switch (node.kind) {
+            case Node::Kind::EMPTY:
+                return next;
+
+            case Node::Kind::BYTES:
+                fProgram.byteSets.push_back(node.bytes);
+                return _Emit({Instruction::Kind::BYTES, next, 0, static_cast<std::uint32_t>(fProgram.byteSets.size() - 1)});
+
+            case Node::Kind::LINE_BEGIN:
+                return _Emit({Instruction::Kind::LINE_BEGIN, next, 0, 0});
+
+            case Node::Kind::LINE_END:
+                return _Emit({Instruction::Kind::LINE_END, next, 0, 0});
+
+            case Node::Kind::CONCATENATION: {
+                std::uint32_t current = next;
+                for (auto child = node.children.rbegin(); child != node.children.rend(); ++child) {
+                    current = _Emit(*child, current);
+                }
+                return current;
+            }
+
+            case Node::Kind::ALTERNATION: {
+                std::uint32_t current = _Emit(node.children.back(), next);
+                for (auto child = node.children.rbegin() + 1; child != node.children.rend(); ++child) {
+                    const std::uint32_t alternative = _Emit(*child, next);
+                    current = _Emit({Instruction::Kind::SPLIT, alternative, current, 0});
+                }
+                return current;
+            }
+
+            case Node::Kind::REPETITION:
+                return _EmitRepetition(node, next);
+        }
+
+        return next;
+    }
+
+    std::uint32_t
+    _EmitRepetition(const Node &node, const std::uint32_t next)
+    {
+        const Node &child = node.children.front();
+        std::uint32_t current = next;
+
+        if (node.max == INFINITE_REPETITION) {
+            const std::uint32_t loop = _Emit({Instruction::Kind::SPLIT, 0, next, 0});
+            fProgram.instructions[loop].out = _Emit(child, loop);
+            current = loop;
+        }
+        else {
+            for (int i = node.min; i < node.max; ++i) {
+                const std::uint32_t optional = _Emit(child, current);
+                current = _Emit({Instruction::Kind::SPLIT, optional, next, 0});
+            }
+        }
+
+        for (int i = 0; i < node.min; ++i) {
+            current = _Emit(child, current);
+        }
+
+        return current;
+    }
+
+    std::uint32_t
+    _Emit(const Instruction &instruction)
+    {
+        if (fProgram.instructions.size() >= MAX_INSTRUCTIONS) {
+            throw exception::SyntaxException(fPattern, "pattern is too large", 0);
+        }
+
+        fProgram.instructions.push_back(instruction);
+        return static_cast<std::uint32_t>(fProgram.instructions.size() - 1);
+    }
+
+private:
+    const std::string_view fPattern;
+    Program fProgram;
+};
+
+}
+
+Program
+compile(const std::string_view &pattern)
+{
+    const Node root = PatternParser(pattern).Parse();
+    return ProgramBuilder(pattern).Build(root);
+}
+
+}  // omtt::regex::detail
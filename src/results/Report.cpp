@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/results/Report.hpp"
+
+#include <algorithm>
+
+
+namespace omtt::results
+{
+
+namespace
+{
+
+struct CauseKindName
+{
+    detail::CauseKind kind;
+    std::string_view name;
+};
+
+constexpr CauseKindName CAUSE_KIND_NAMES[] = {
+    {detail::CauseKind::EMPTY_OUTPUT, "EMPTY_OUTPUT"},
+    {detail::CauseKind::EXIT_CODE, "EXIT_CODE"},
+    {detail::CauseKind::FULL_OUTPUT, "FULL_OUTPUT"},
+    {detail::CauseKind::PARTIAL_OUTPUT, "PARTIAL_OUTPUT"},
+    {detail::CauseKind::SUCCESSFUL_EXIT, "SUCCESSFUL_EXIT"},
+    {detail::CauseKind::FAILURE_EXIT, "FAILURE_EXIT"},
+    {detail::CauseKind::OUTPUT_FILE, "OUTPUT_FILE"},
+    {detail::CauseKind::OUTPUT_MATCHES, "OUTPUT_MATCHES"},
+    {detail::CauseKind::IN_OUTPUT_MATCHES, "IN_OUTPUT_MATCHES"},
+    {detail::CauseKind::OUTPUT_TEMPLATE, "OUTPUT_TEMPLATE"},
+    {detail::CauseKind::IN_OUTPUT_IN_ORDER, "IN_OUTPUT_IN_ORDER"},
+    {detail::CauseKind::OUTPUT_LINES_UNORDERED, "OUTPUT_LINES_UNORDERED"},
+    {detail::CauseKind::OUTPUT_JSON, "OUTPUT_JSON"},
+    {detail::CauseKind::OUTPUT_WITH_TOLERANCE, "OUTPUT_WITH_TOLERANCE"},
+    {detail::CauseKind::OUTPUT_DIFF, "OUTPUT_DIFF"},
+    {detail::CauseKind::OUTPUT_SIZE, "OUTPUT_SIZE"},
+    {detail::CauseKind::OUTPUT_LINE_COUNT, "OUTPUT_LINE_COUNT"},
+    {detail::CauseKind::OUTPUT_STARTS_WITH, "OUTPUT_STARTS_WITH"},
+    {detail::CauseKind::OUTPUT_SHA256, "OUTPUT_SHA256"},
+    {detail::CauseKind::INPUT_FILE, "INPUT_FILE"}
+};
+
+}
+
+std::optional<detail::CauseKind>
+cause_kind_from_name(const std::string_view &name)
+{
+    for (const auto &kindName : CAUSE_KIND_NAMES) {
+        if (kindName.name == name) {
+            return kindName.kind;
+        }
+    }
+
+    return std::nullopt;
+}
+
+bool
+is_reported(const TestResult &result, const ReportFilter &filter)
+{
+    if (filter.verdict.has_value() && result.verdict != *filter.verdict) {
+        return false;
+    }
+
+    if (filter.causeKind.has_value()
+        && std::find(result.causeKinds.begin(), result.causeKinds.end(), *filter.causeKind) == result.causeKinds.end()) {
+        return false;
+    }
+
+    return result.path.find(filter.pathText) != std::string_view::npos;
+}
+
+TestPaths::size_type
+render_report(const ResultsLog &log, const ReportFilter &filter, logger::Logger &logger)
+{
+    logger.SutPath(std::string(log.GetSutPath()));
+
+    TestPaths::size_type numberOfTestsPassed = 0;
+    TestPaths::size_type numberOfTestsFailed = 0;
+
+    for (std::uint64_t i = 0; i < log.GetTestsCount(); ++i) {
+        const TestResult result = log.GetTest(i);
+
+        if (!is_reported(result, filter)) {
+            continue;
+        }
+
+        logger.BeginTestExecution(result.number, result.numberOfTests, Path(result.path));
+
+        TestExecutionSummary summary{result.verdict, {}, result.duration};
+        summary.causes.reserve(result.causes.size());
+        for (const auto &message : result.causes) {
+            summary.causes.emplace_back(expectation::validation::RecordedCause{message});
+        }
+
+        logger.EndTestExecution({result.exitCode, {}, std::string(result.errors), result.resources, std::nullopt}, summary);
+
+        if (result.verdict == Verdict::PASS) {
+            ++numberOfTestsPassed;
+        }
+        else {
+            ++numberOfTestsFailed;
+        }
+    }
+
+    logger.OverallStatistics(numberOfTestsPassed + numberOfTestsFailed,
+                             numberOfTestsPassed,
+                             numberOfTestsFailed);
+
+    return numberOfTestsFailed;
+}
+
+}  // omtt::results
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "headers/results/ResultsLog.hpp"
+#include "headers/exception/FileReadException.hpp"
+#include "headers/system/Unix.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+
+namespace omtt::results
+{
+
+namespace
+{
+
+std::uint64_t
+read_length(const char *position)
+{
+    std::uint64_t length;
+    std::memcpy(&length, position, sizeof(length));
+    return length;
+}
+
+}
+
+ResultsLog::ResultsLog(const Path &logFilePath)
+    :
+    fLog{nullptr, 0},
+    fContext{nullptr, 0},
+    fHeader(nullptr),
+    fRecords(nullptr),
+    fRecordsCount(0)
+{
+    fLog = _Map(logFilePath);
+
+    try {
+        fContext = _Map(logFilePath + detail::CONTEXT_FILE_SUFFIX);
+    }
+    catch (...) {
+        _Unmap(fLog);
+        throw;
+    }
+
+    if (!_IsHeaderValid()) {
+        _Unmap(fLog);
+        _Unmap(fContext);
+        throw exception::FileReadException("invalid results log: " + logFilePath);
+    }
+
+    fRecords = reinterpret_cast<const detail::Record *>(static_cast<const char *>(fLog.address) + sizeof(detail::Header));
+
+    const std::uint64_t available = (fLog.size - sizeof(detail::Header)) / sizeof(detail::Record);
+    while (fRecordsCount < available && _IsRecordValid(fRecords[fRecordsCount])) {
+        ++fRecordsCount;
+    }
+}
+
+ResultsLog::~ResultsLog()
+{
+    _Unmap(fLog);
+    _Unmap(fContext);
+}
+
+std::string_view
+ResultsLog::GetSutPath() const
+{
+    return _Text(fHeader->sutOffset, fHeader->sutLength);
+}
+
+std::uint64_t
+ResultsLog::GetTestsCount() const
+{
+    return fRecordsCount;
+}
+
+TestResult
+ResultsLog::GetTest(const std::uint64_t index) const
+{
+    const detail::Record &record = fRecords[index];
+
+    TestResult result{record.number,
+                      record.numberOfTests,
+                      _Text(record.pathOffset, record.pathLength),
+                      static_cast<Verdict>(record.verdict),
+                      record.exitCode,
+                      std::chrono::nanoseconds(record.durationNsec),
+                      {std::chrono::nanoseconds(record.wallTimeNsec),
+                       std::chrono::microseconds(record.userTimeUsec),
+                       std::chrono::microseconds(record.systemTimeUsec),
+                       record.maxResidentSetSizeKb,
+                       record.minorPageFaults,
+                       record.majorPageFaults,
+                       record.voluntaryContextSwitches,
+                       record.involuntaryContextSwitches},
+                      _Text(record.errorsOffset, record.errorsLength),
+                      {},
+                      {}};
+
+    result.causes.reserve(record.causesCount);
+
+    std::uint64_t position = record.causesOffset;
+    for (std::uint32_t i = 0; i < record.causesCount; ++i) {
+        const std::uint64_t length = read_length(static_cast<const char *>(fContext.address) + position);
+        result.causes.push_back(_Text(position + sizeof(std::uint64_t), length));
+        position += sizeof(std::uint64_t) + length;
+    }
+
+    const auto kindsCount = std::min<std::uint64_t>(record.causesCount, std::size(record.causeKinds));
+    result.causeKinds.assign(record.causeKinds, record.causeKinds + kindsCount);
+
+    return result;
+}
+
+ResultsLog::Mapping
+ResultsLog::_Map(const Path &path)
+{
+    const int fd = system::unix::Open(path, O_RDONLY | O_CLOEXEC);
+    Mapping mapping{nullptr, 0};
+
+    try {
+        const auto status = system::unix::FileStat(fd);
+
+        if (status.size > 0) {
+            mapping.size = status.size;
+            mapping.address = system::unix::Mmap(nullptr, mapping.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+    }
+    catch (...) {
+        system::unix::Close(fd);
+        throw;
+    }
+
+    system::unix::Close(fd);
+
+    return mapping;
+}
+
+void
+ResultsLog::_Unmap(const Mapping &mapping)
+{
+    if (mapping.address != nullptr) {
+        munmap(mapping.address, mapping.size);
+    }
+}
+
+bool
+ResultsLog::_IsHeaderValid()
+{
+    if (fLog.size < sizeof(detail::Header)) {
+        return false;
+    }
+
+    fHeader = static_cast<const detail::Header *>(fLog.address);
+
+    return std::memcmp(fHeader->magic, detail::MAGIC, sizeof(detail::MAGIC)) == 0
+           && fHeader->version == detail::FORMAT_VERSION
+           && fHeader->recordSize == sizeof(detail::Record)
+           && fHeader->sutOffset <= fContext.size
+           && fHeader->sutLength <= fContext.size - fHeader->sutOffset;
+}
+
+bool
+ResultsLog::_IsRecordValid(const detail::Record &record) const
+{
+    const auto isInContext = [this](const std::uint64_t offset, const std::uint64_t length) {
+        return offset <= fContext.size && length <= fContext.size - offset;
+    };
+
+    return record.verdict <= static_cast<std::uint8_t>(Verdict::FAIL)
+           && isInContext(record.pathOffset, record.pathLength)
+           && isInContext(record.errorsOffset, record.errorsLength)
+           && isInContext(record.causesOffset, record.causesLength)
+           && _AreCausesValid(record);
+}
+
+bool
+ResultsLog::_AreCausesValid(const detail::Record &record) const
+{
+    std::uint64_t remaining = record.causesLength;
+    const char *position = static_cast<const char *>(fContext.address) + record.causesOffset;
+
+    for (std::uint32_t i = 0; i < record.causesCount; ++i) {
+        if (remaining < sizeof(std::uint64_t)) {
+            return false;
+        }
+
+        const std::uint64_t length = read_length(position);
+        remaining -= sizeof(std::uint64_t);
+        if (length > remaining) {
+            return false;
+        }
+
+        remaining -= length;
+        position += sizeof(std::uint64_t) + length;
+    }
+
+    return remaining == 0;
+}
+
+std::string_view
+ResultsLog::_Text(const std::uint64_t offset, const std::uint64_t length) const
+{
+    if (length == 0) {
+        return {};
+    }
+
+    return std::string_view(static_cast<const char *>(fContext.address) + offset, length);
+}
+
+}  // omtt::results
@@ -12,8 +12,20 @@
 #include <cerrno>
 #include <limits>
 
+#include <cstdio>
+#include <cstdlib>
+
 #include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#ifdef HAVE_SYS_SENDFILE_H
+#include <sys/sendfile.h>
+#endif
+#include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
@@ -66,6 +78,17 @@ Write(int fd, const void *buf, size_t count, WriteOptions options)
     return bytes;
 }
 
+ssize_t
+WriteVector(int fd, const struct iovec *iov, int iovcnt)
+{
+    const ssize_t bytes = writev(fd, iov, iovcnt);
+    if (bytes < 0) {
+        throw exception::SystemException("failure in writev()", errno);
+    }
+
+    return bytes;
+}
+
 void
 Close(int fd)
 {
@@ -96,6 +119,16 @@ WaitPid(pid_t pid, int *wstatus, int options)
     return ret;
 }
 
+int
+Wait4(pid_t pid, int *wstatus, int options, struct rusage *rusage)
+{
+    const int ret = wait4(pid, wstatus, options, rusage);
+    if (ret < 0) {
+        throw exception::SystemException("failure in wait4()", errno);
+    }
+    return ret;
+}
+
 void
 DuplicateFd(int oldFd, int newFd)
 {
@@ -140,6 +173,15 @@ SigAction(int signum, const struct sigaction *act, struct sigaction *oldact)
     }
 }
 
+void
+ThreadSignalMask(int how, const sigset_t *set, sigset_t *oldset)
+{
+    const int err = pthread_sigmask(how, set, oldset);
+    if (err != 0) {
+        throw exception::SystemException("failure in pthread_sigmask()", err);
+    }
+}
+
 void
 Signal(int signum, signal_handler handler)
 {
@@ -178,5 +220,158 @@ Kill(pid_t pid, int sig)
     }
 }
 
+int
+Open(const std::string &path, int flags, mode_t mode)
+{
+    const int fd = open(path.c_str(), flags, mode);
+    if (fd < 0) {
+        throw exception::SystemException("failure in open()", errno);
+    }
+    return fd;
+}
+
+const FileStatus
+Stat(const std::string &path)
+{
+    struct stat status;
+    const int err = stat(path.c_str(), &status);
+    if (err < 0) {
+        throw exception::SystemException("failure in stat()", errno);
+    }
+    return {status.st_size, status.st_mtim};
+}
+
+const FileStatus
+FileStat(int fd)
+{
+    struct stat status;
+    const int err = fstat(fd, &status);
+    if (err < 0) {
+        throw exception::SystemException("failure in fstat()", errno);
+    }
+    return {status.st_size, status.st_mtim};
+}
+
+void *
+Mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
+{
+    void * const mapping = mmap(addr, length, prot, flags, fd, offset);
+    if (mapping == MAP_FAILED) {
+        throw exception::SystemException("failure in mmap()", errno);
+    }
+    return mapping;
+}
+
+void
+Munmap(void *addr, size_t length)
+{
+    const int err = munmap(addr, length);
+    if (err < 0) {
+        throw exception::SystemException("failure in munmap()", errno);
+    }
+}
+
+void
+Rename(const std::string &oldPath, const std::string &newPath)
+{
+    const int err = rename(oldPath.c_str(), newPath.c_str());
+    if (err < 0) {
+        throw exception::SystemException("failure in rename()", errno);
+    }
+}
+
+int
+OpenAt(int dirFd, const std::string &path, int flags, mode_t mode)
+{
+    const int fd = openat(dirFd, path.c_str(), flags, mode);
+    if (fd < 0) {
+        throw exception::SystemException("failure in openat()", errno);
+    }
+    return fd;
+}
+
+int
+MakeTemporaryFile(std::string &pathTemplate)
+{
+    const int fd = mkstemp(pathTemplate.data());
+    if (fd < 0) {
+        throw exception::SystemException("failure in mkstemp()", errno);
+    }
+    return fd;
+}
+
+void
+Unlink(const std::string &path)
+{
+    const int err = unlink(path.c_str());
+    if (err < 0) {
+        throw exception::SystemException("failure in unlink()", errno);
+    }
+}
+
+void
+FileTruncate(int fd, off_t length)
+{
+    const int err = ftruncate(fd, length);
+    if (err < 0) {
+        throw exception::SystemException("failure in ftruncate()", errno);
+    }
+}
+
+off_t
+Seek(int fd, off_t offset, int whence)
+{
+    const off_t position = lseek(fd, offset, whence);
+    if (position < 0) {
+        throw exception::SystemException("failure in lseek()", errno);
+    }
+    return position;
+}
+
+ssize_t
+PositionalRead(int fd, void *buf, size_t count, off_t offset)
+{
+    const ssize_t bytes = pread(fd, buf, count, offset);
+    if (bytes < 0) {
+        throw exception::SystemException("failure in pread()", errno);
+    }
+    return bytes;
+}
+
+#ifdef HAVE_MEMFD_CREATE
+int
+MemfdCreate(const std::string &name, unsigned int flags)
+{
+    const int fd = memfd_create(name.c_str(), flags);
+    if (fd < 0) {
+        throw exception::SystemException("failure in memfd_create()", errno);
+    }
+    return fd;
+}
+#endif
+
+#ifdef HAVE_COPY_FILE_RANGE
+ssize_t
+CopyFileRange(int inFd, off_t *inOffset, int outFd, size_t count)
+{
+    const ssize_t bytes = copy_file_range(inFd, inOffset, outFd, nullptr, count, 0);
+    if (bytes < 0) {
+        throw exception::SystemException("failure in copy_file_range()", errno);
+    }
+    return bytes;
+}
+#endif
+
+#ifdef HAVE_SYS_SENDFILE_H
+ssize_t
+SendFile(int outFd, int inFd, off_t *offset, size_t count)
+{
+    const ssize_t bytes = sendfile(outFd, inFd, offset, count);
+    if (bytes < 0) {
+        throw exception::SystemException("failure in sendfile()", errno);
+    }
+    return bytes;
+}
+#endif
 
 } // omtt::system::unix
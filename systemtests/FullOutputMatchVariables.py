@@ -11,7 +11,7 @@ SPC  TAB  LF   VT   FF   LF   NP   \n\
 
 class CheckMoreThanOneExpectStatement:
     first_full_match_not_found_message = "Output doesn't match.\n\
-First difference at byte: 1\n\
+First difference at byte: 1 (line 1, column 2)\n\
 Expected (context):\n\
 H    E    L    L    O    SPC  w    o    \n\
      ^                                  \n\
@@ -22,7 +22,7 @@ H    e    l    l    o    SPC  w    o    \n\
 0x48 0x65 0x6c 0x6c 0x6f 0x20 0x77 0x6f"
 
     third_full_match_not_found_message = "Output doesn't match.\n\
-First difference at byte: 6\n\
+First difference at byte: 6 (line 1, column 7)\n\
 Expected (context):\n\
 H    e    l    l    o    SPC  W    O    R    L    D    LF   \n\
                               ^                             \n\
@@ -94,4 +94,40 @@ TEST_CASE("Text other than CR, CR LF should not be modified")
     CHECK(text == expectedOutputText);
 }
 
+TEST_CASE("Normalizer should return the chunk without changes when it has no CR")
+{
+    LfNormalizer normalizer;
+    const std::string chunk = "Hello\nWorld\n";
+
+    const auto normalized = normalizer.Normalize(chunk);
+
+    CHECK(normalized == chunk);
+    CHECK(normalized.data() == chunk.data());
+}
+
+TEST_CASE("Normalizer should change CR and CR LF to LF")
+{
+    LfNormalizer normalizer;
+
+    CHECK(normalizer.Normalize("Hello\r\nWorld\r") == "Hello\nWorld\n");
+}
+
+TEST_CASE("Normalizer should handle CR LF split between chunks")
+{
+    LfNormalizer normalizer;
+
+    CHECK(normalizer.Normalize("Hello\r") == "Hello\n");
+    CHECK(normalizer.Normalize("\nWorld") == "World");
+    CHECK(normalizer.Normalize("\n") == "\n");
+}
+
+TEST_CASE("Normalizer should keep LF after CR when they are in different chunks separated by text")
+{
+    LfNormalizer normalizer;
+
+    CHECK(normalizer.Normalize("\r") == "\n");
+    CHECK(normalizer.Normalize("a") == "a");
+    CHECK(normalizer.Normalize("\n") == "\n");
+}
+
 }
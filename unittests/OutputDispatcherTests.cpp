@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/OutputDispatcher.hpp"
+#include "headers/expectation/ExitCodeExpectation.hpp"
+#include "headers/expectation/FullOutputExpectation.hpp"
+#include "headers/expectation/OutputFileExpectation.hpp"
+#include "headers/expectation/OutputLineCountExpectation.hpp"
+#include "headers/expectation/OutputSizeExpectation.hpp"
+#include "headers/expectation/OutputStartsWithExpectation.hpp"
+#include "headers/expectation/PartialOutputExpectation.hpp"
+#include "headers/expectation/validation/OutputDiffCause.hpp"
+#include "headers/expectation/validation/PartialOutputCause.hpp"
+
+#include <fstream>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "output_dispatcher_tests-test_file.omtt";
+const std::string expectedOutputFile = "output_dispatcher_tests-expected.txt";
+
+// needs only the first chunk of the output
+class FirstChunkExpectation : public expectation::StreamingExpectation
+{
+public:
+    void Prepare(const expectation::PreparationContext &) {}
+
+    void
+    Consume(const std::string_view &)
+    {
+        ++consumedChunks;
+    }
+
+    bool
+    NeedsMoreOutput() const
+    {
+        return consumedChunks == 0;
+    }
+
+    expectation::validation::ValidationResult
+    Validate(const ProcessResults &)
+    {
+        return {std::nullopt};
+    }
+
+    int consumedChunks = 0;
+};
+
+}
+
+TEST_CASE("Should keep normalized output when expectation needs it")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<expectation::FullOutputExpectation>("a\nb\n"));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("a\r");
+    sut.OnOutput("\nb\r");
+
+    CHECK(sut.TakeOutput() == "a\nb\n");
+}
+
+TEST_CASE("Should show line differences of full output expectations when they are shown")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<expectation::FullOutputExpectation>("a\nb\n"));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache, true});
+    sut.OnOutput("a\nc\n");
+
+    auto result = testData.expectations.at(0)->Validate({0, sut.TakeOutput(), "", {}, std::nullopt});
+
+    REQUIRE(result.isSatisfied() == false);
+    CHECK(std::holds_alternative<expectation::validation::OutputDiffCause>(*result.cause));
+}
+
+TEST_CASE("Should not keep output when no expectation needs it")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<expectation::ExitCodeExpectation>(0));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("some output");
+
+    CHECK(sut.TakeOutput().empty());
+}
+
+TEST_CASE("Should pass normalized output to streaming expectations")
+{
+    {
+        std::ofstream file(expectedOutputFile, std::ios::binary | std::ios::trunc);
+        file << "a\nb\n";
+    }
+
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<expectation::OutputFileExpectation>(expectedOutputFile));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("a\r");
+    sut.OnOutput("\nb\r\n");
+
+    CHECK(sut.TakeOutput().empty());
+    CHECK(testData.expectations.at(0)->Validate({0, "", "", {}, std::nullopt}).isSatisfied() == true);
+}
+
+TEST_CASE("Should search partial outputs without keeping the output")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<expectation::PartialOutputExpectation>("first line"));
+    testData.expectations.emplace_back(std::make_unique<expectation::PartialOutputExpectation>("missing"));
+    testData.expectations.emplace_back(std::make_unique<expectation::PartialOutputExpectation>("line\nsecond"));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("first li");
+    sut.OnOutput("ne\r\nsecond line");
+
+    const ProcessResults results {0, sut.TakeOutput(), "", {}, std::nullopt};
+    CHECK(results.output.empty());
+    CHECK(testData.expectations.at(0)->Validate(results).isSatisfied() == true);
+    CHECK(testData.expectations.at(2)->Validate(results).isSatisfied() == true);
+
+    auto validationResult = testData.expectations.at(1)->Validate(results);
+    REQUIRE(validationResult.isSatisfied() == false);
+    CHECK(std::get<expectation::validation::PartialOutputCause>(*validationResult.cause).fExpectedPartialOutput == "missing");
+}
+
+TEST_CASE("Should apply test filters to output")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.normalization = {normalize::Filter::TRIM, normalize::Filter::MASK_INT};
+    testData.expectations.emplace_back(std::make_unique<expectation::FullOutputExpectation>("pid #\nok\n"));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("pid 12");
+    sut.OnOutput("34  \r");
+    sut.OnOutput("\nok \n");
+
+    CHECK(sut.TakeOutput() == "pid #\nok\n");
+}
+
+TEST_CASE("Should not search standard output for error output texts")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<expectation::PartialOutputExpectation>("text", expectation::Stream::ERROR_OUTPUT));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("text");
+
+    const ProcessResults results {0, sut.TakeOutput(), "some text", {}, std::nullopt};
+    CHECK(results.output.empty());
+    CHECK(testData.expectations.at(0)->Validate(results).isSatisfied() == true);
+}
+
+TEST_CASE("Should stop passing output to expectations which don't need more of it")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<FirstChunkExpectation>());
+    testData.expectations.emplace_back(std::make_unique<FirstChunkExpectation>());
+    auto &first = static_cast<FirstChunkExpectation &>(*testData.expectations.at(0));
+    auto &second = static_cast<FirstChunkExpectation &>(*testData.expectations.at(1));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("first chunk");
+    sut.OnOutput("second chunk");
+
+    CHECK(first.consumedChunks == 1);
+    CHECK(second.consumedChunks == 1);
+}
+
+TEST_CASE("Should count output without keeping it")
+{
+    regex::PatternCache patternCache;
+    TestData testData;
+    testData.expectations.emplace_back(std::make_unique<expectation::OutputSizeExpectation>(expectation::Comparison::EXACTLY, 6));
+    testData.expectations.emplace_back(std::make_unique<expectation::OutputLineCountExpectation>(expectation::Comparison::AT_LEAST, 1));
+    testData.expectations.emplace_back(std::make_unique<expectation::OutputStartsWithExpectation>("a\n"));
+
+    OutputDispatcher sut(testData, {testFilePath, patternCache});
+    sut.OnOutput("a\r\nb");
+    sut.OnOutput("\r\nc\n");
+
+    CHECK(sut.TakeOutput().empty());
+    for (const auto &expectation : testData.expectations) {
+        CHECK(expectation->Validate({0, "", "", {}, std::nullopt}).isSatisfied() == true);
+    }
+}
+
+}
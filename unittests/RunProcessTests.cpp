@@ -9,6 +9,7 @@
 #include "headers/RunProcess.hpp"
 #include "headers/ErrorCodes.hpp"
 #include "headers/exception/SutExecutionException.hpp"
+#include "headers/exception/InputFileException.hpp"
 #include "headers/exception/SignalReceivedException.hpp"
 #include "headers/system/exception/SystemException.hpp"
 #include "unittests/system/UnixFake.hpp"
@@ -67,7 +68,7 @@ TEST_GROUP("Child Process Exit Code")
                                     fds[2].revents = POLLHUP;
                                     return 0;
                                 };
-        systemFake.WaitPidAction = [&](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [&](int pid, int *wstatus, int options, struct rusage *rusage) {
                                          *wstatus = __W_EXITCODE(expectedExitCode, 0);
                                          return pid;
                                       };
@@ -77,6 +78,38 @@ TEST_GROUP("Child Process Exit Code")
         CHECK(results.exitCode == expectedExitCode);
     }
 
+    UNIT_TEST("Should return resources used by process when it is reaped")
+    {
+        systemFake.PollAction = [](struct pollfd *fds, nfds_t nfds, int timeout) {
+                                    fds[0].revents = POLLHUP;
+                                    fds[1].revents = POLLHUP;
+                                    fds[2].revents = POLLHUP;
+                                    return 0;
+                                };
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
+                                     *wstatus = __W_EXITCODE(0, 0);
+                                     rusage->ru_utime = {1, 500};
+                                     rusage->ru_stime = {0, 250};
+                                     rusage->ru_maxrss = 2048;
+                                     rusage->ru_minflt = 100;
+                                     rusage->ru_majflt = 1;
+                                     rusage->ru_nvcsw = 3;
+                                     rusage->ru_nivcsw = 4;
+                                     return pid;
+                                 };
+
+        ProcessResults results = RunProcess(exampleBinaryPath, emptyRunProcessArguments, emptyInput);
+
+        CHECK(results.resources.userTime == std::chrono::microseconds(1000500));
+        CHECK(results.resources.systemTime == std::chrono::microseconds(250));
+        CHECK(results.resources.maxResidentSetSizeKb == 2048);
+        CHECK(results.resources.minorPageFaults == 100);
+        CHECK(results.resources.majorPageFaults == 1);
+        CHECK(results.resources.voluntaryContextSwitches == 3);
+        CHECK(results.resources.involuntaryContextSwitches == 4);
+        CHECK(results.resources.wallTime >= std::chrono::nanoseconds(0));
+    }
+
     UNIT_TEST("Should return correct exit code when process fds hangs up but it is still running")
     {
         const int expectedExitCode = 143;
@@ -87,7 +120,7 @@ TEST_GROUP("Child Process Exit Code")
                                     fds[2].revents = POLLHUP;
                                     return 0;
                                 };
-        systemFake.WaitPidAction = [&, run = 0](int pid, int *wstatus, int options) mutable {
+        systemFake.Wait4Action = [&, run = 0](int pid, int *wstatus, int options, struct rusage *rusage) mutable {
                                        ++run;
                                        if (run == 1) {
                                            *wstatus = 0;
@@ -114,7 +147,7 @@ TEST_GROUP("Read Child Process Output")
     systemFake.ForkAction = []() { return anyChildProcessId; };
     systemFake.CloseAction = [](int) {};
     systemFake.WriteAction = [](int, const void *, size_t, system::unix::WriteOptions) -> ssize_t { return 0; };
-    systemFake.WaitPidAction = [run = 0](int pid, int *wstatus, int options) mutable {
+    systemFake.Wait4Action = [run = 0](int pid, int *wstatus, int options, struct rusage *rusage) mutable {
                                     run++;
                                     if (run == 10) {
                                         return 1;
@@ -164,7 +197,7 @@ TEST_GROUP("Read Child Process Output")
 
     UNIT_TEST("Should return empty output when child output is empty and only POLLIN is set after child exit (Cygwin)")
     {
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [](struct pollfd *fds, nfds_t nfds, int timeout) {
@@ -401,7 +434,7 @@ TEST_GROUP("Read Child Process Output")
                                                   + expedtedProcessOutputPart2
                                                   + expedtedProcessOutputPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -450,7 +483,7 @@ TEST_GROUP("Read Child Process Output")
                                                   + expedtedProcessOutputPart2
                                                   + expedtedProcessOutputPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -494,7 +527,7 @@ TEST_GROUP("Read Child Process Output")
                                                   + expedtedProcessOutputPart2
                                                   + expedtedProcessOutputPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -538,7 +571,7 @@ TEST_GROUP("Read Child Process Output")
                                                   + expedtedProcessOutputPart2
                                                   + expedtedProcessOutputPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -587,7 +620,7 @@ TEST_GROUP("Read Child Process Errors")
     systemFake.ForkAction = []() { return anyChildProcessId; };
     systemFake.CloseAction = [](int) {};
     systemFake.WriteAction = [](int, const void *, size_t, system::unix::WriteOptions) -> ssize_t { return 0; };
-    systemFake.WaitPidAction = [run = 0](int pid, int *wstatus, int options) mutable {
+    systemFake.Wait4Action = [run = 0](int pid, int *wstatus, int options, struct rusage *rusage) mutable {
                                     run++;
                                     if (run == 10) {
                                         return 1;
@@ -823,7 +856,7 @@ TEST_GROUP("Read Child Process Errors")
                                                   + expedtedProcessErrorsPart2
                                                   + expedtedProcessErrorsPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -873,7 +906,7 @@ TEST_GROUP("Read Child Process Errors")
                                                   + expedtedProcessErrorsPart2
                                                   + expedtedProcessErrorsPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -918,7 +951,7 @@ TEST_GROUP("Read Child Process Errors")
                                                   + expedtedProcessErrorsPart2
                                                   + expedtedProcessErrorsPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -963,7 +996,7 @@ TEST_GROUP("Read Child Process Errors")
                                                   + expedtedProcessErrorsPart2
                                                   + expedtedProcessErrorsPart3;
 
-        systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+        systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                     return 1;
                                 };
         systemFake.PollAction = [run = 0](struct pollfd *fds, nfds_t nfds, int timeout) mutable {
@@ -1012,7 +1045,7 @@ TEST_GROUP("Write To Child Process")
     systemFake.ForkAction = []() { return anyChildProcessId; };
     systemFake.CloseAction = [](int) {};
     systemFake.ReadAction = [](int, const void *, size_t) -> ssize_t { return 0; };
-    systemFake.WaitPidAction = [run = 0](int pid, int *wstatus, int options) mutable {
+    systemFake.Wait4Action = [run = 0](int pid, int *wstatus, int options, struct rusage *rusage) mutable {
                                     run++;
                                     if (run == 10) {
                                         return 1;
@@ -1313,7 +1346,7 @@ TEST_GROUP("Pipes Management")
                                         throw std::logic_error("Unexpected call to system::unix::Pipe().");
                                     }
                                 };
-    systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+    systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                  return 1;
                                };
     systemFake.PollAction = [](struct pollfd *fds, nfds_t nfds, int timeout) {
@@ -1576,6 +1609,56 @@ TEST_GROUP("Pipes Management")
             CHECK(isClosedToParentReadEnd == true);
         }
 
+        UNIT_TEST("Should close input file and not write input string to child when input file is given")
+        {
+            constexpr int inputFileFd = 52;
+            bool isClosedInputFile = false;
+
+            systemFake.OpenAction = [](const std::string &, int, mode_t) { return inputFileFd; };
+            systemFake.CloseAction = [&](int fd) {
+                                         if (fd == inputFileFd) {
+                                             isClosedInputFile = true;
+                                         }
+                                     };
+            systemFake.WriteAction = [](int, const void *, size_t, system::unix::WriteOptions) -> ssize_t {
+                                         throw std::logic_error("Unexpected call to system::unix::Write.");
+                                     };
+
+            (void) RunProcess(exampleBinaryPath, emptyRunProcessArguments, nonImportantNonEmptyInput, "input.txt");
+
+            CHECK(isClosedInputFile == true);
+        }
+
+        UNIT_TEST("Should throw exception with input file path when input file can't be opened")
+        {
+            systemFake.OpenAction = [](const std::string &, int, mode_t) -> int {
+                                        throw system::unix::exception::SystemException("failure in open()", ENOENT);
+                                    };
+
+            CHECK_THROWS_AS(RunProcess(exampleBinaryPath, emptyRunProcessArguments, nonImportantEmptyInput, "input.txt"),
+                            exception::InputFileException);
+        }
+
+        UNIT_TEST("Should close input file when fork fails")
+        {
+            constexpr int inputFileFd = 52;
+            bool isClosedInputFile = false;
+
+            systemFake.OpenAction = [](const std::string &, int, mode_t) { return inputFileFd; };
+            systemFake.CloseAction = [&](int fd) {
+                                         if (fd == inputFileFd) {
+                                             isClosedInputFile = true;
+                                         }
+                                     };
+            systemFake.ForkAction = []() -> int {
+                                        throw system::unix::exception::SystemException("failure in fork()", EAGAIN);
+                                    };
+
+            CHECK_THROWS_AS(RunProcess(exampleBinaryPath, emptyRunProcessArguments, nonImportantEmptyInput, "input.txt"),
+                            system::unix::exception::SystemException);
+            CHECK(isClosedInputFile == true);
+        }
+
         UNIT_TEST("Should close pipes ends before exception throw due to sut run failure")
         {
             constexpr int readFromParentInternalErrorsReadEndRun = 1;
@@ -2006,6 +2089,37 @@ TEST_GROUP("Pipes Management")
 
             CHECK(isDuplicatedToParentErrorsWriteEnd == true);
         }
+
+        UNIT_TEST("Should duplicate input file to STDIN and close toChildReadEnd when input file is given")
+        {
+            constexpr int inputFileFd = 52;
+            bool isDuplicatedInputFile = false;
+            bool isDuplicatedToChildReadEnd = false;
+            bool isClosedToChildReadEnd = false;
+
+            systemFake.OpenAction = [&](const std::string &path, int flags, mode_t) {
+                                        CHECK(path == "input.txt");
+                                        CHECK((flags & O_CLOEXEC) != 0);
+                                        return inputFileFd;
+                                    };
+            systemFake.CloseAction = [&](int fd) {
+                                         if (fd == toChildReadEnd) {
+                                             isClosedToChildReadEnd = true;
+                                         }
+                                     };
+            systemFake.DuplicateFdAction = [&](int oldFd, int newFd) {
+                                               if (newFd == static_cast<int>(system::unix::FdId::STDIN)) {
+                                                   isDuplicatedInputFile = (oldFd == inputFileFd);
+                                                   isDuplicatedToChildReadEnd = (oldFd == toChildReadEnd);
+                                               }
+                                           };
+
+            (void) RunProcess(exampleBinaryPath, emptyRunProcessArguments, nonImportantEmptyInput, "input.txt");
+
+            CHECK(isDuplicatedInputFile == true);
+            CHECK(isDuplicatedToChildReadEnd == false);
+            CHECK(isClosedToChildReadEnd == true);
+        }
     }
 }
 
@@ -2014,7 +2128,7 @@ TEST_GROUP("SUT Process Execution")
     system::unix::ResetGlobalFake();
 
     systemFake.MakePipeAction = [](const system::unix::PipeOptions option) -> system::unix::Pipe { return {0,0}; };
-    systemFake.WaitPidAction = [](int pid, int *wstatus, int options) { return 1; };
+    systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) { return 1; };
     systemFake.CloseAction = [](int fd) {};
     systemFake.DuplicateFdAction = [](int oldFd, int newFd) {};
     systemFake.SigAction = [](int, const struct sigaction*, struct sigaction*) {};
@@ -2133,7 +2247,7 @@ TEST_GROUP("Signals Management")
     systemFake.CloseAction = [](int) {};
     systemFake.WriteAction = [](int, const void *, size_t, system::unix::WriteOptions) -> ssize_t { return 0; };
     systemFake.ReadAction = [](int fd, void *buf, size_t count) -> ssize_t { return 0; };
-    systemFake.WaitPidAction = [](int pid, int *wstatus, int options) {
+    systemFake.Wait4Action = [](int pid, int *wstatus, int options, struct rusage *rusage) {
                                  return 1;
                                };
     systemFake.FcntlAction = [](int, int, int) { return 0; };
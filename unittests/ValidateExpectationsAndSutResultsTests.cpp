@@ -13,6 +13,8 @@
 #include "headers/ValidateExpectationsAndSutResults.hpp"
 #include "headers/ProcessResults.hpp"
 
+#include <vector>
+
 
 namespace omtt
 {
@@ -44,6 +46,68 @@ public:
     }
 };
 
+// records the order of the checks
+class RecordingExpectation : public expectation::Expectation
+{
+public:
+    RecordingExpectation(std::vector<int> &checks,
+                         const int id,
+                         const Cost cost,
+                         const bool isSatisfied)
+        :
+        fChecks(checks),
+        fId(id),
+        fCost(cost),
+        fIsSatisfied(isSatisfied),
+        fValidations(0)
+    {
+    }
+
+    expectation::validation::ValidationResult
+    Validate(const ProcessResults &output)
+    {
+        ++fValidations;
+        return fIsSatisfied ? expectation::validation::ValidationResult{std::nullopt}
+                            : expectation::validation::ValidationResult{sampleCause};
+    }
+
+    bool
+    IsSatisfied(const ProcessResults &output)
+    {
+        fChecks.push_back(fId);
+        return fIsSatisfied;
+    }
+
+    Cost
+    GetCost() const
+    {
+        return fCost;
+    }
+
+    int
+    GetValidations() const
+    {
+        return fValidations;
+    }
+
+private:
+    std::vector<int> &fChecks;
+    const int        fId;
+    const Cost       fCost;
+    const bool       fIsSatisfied;
+    int              fValidations;
+};
+
+void
+AppendRecordingExpectation(TestData &testData,
+                           std::vector<int> &checks,
+                           const expectation::Expectation::Cost cost,
+                           const bool isSatisfied)
+{
+    const int id = static_cast<int>(testData.expectations.size());
+    testData.expectations.push_back(std::make_unique<RecordingExpectation>(checks, id, cost, isSatisfied));
+}
+
 void
 AppendSatisfiedExpectation(TestData &testData)
 {
@@ -160,4 +224,95 @@ TEST_CASE("Should append multiple causes when multiple expectations is not satis
     CHECK(std::get<SampleCauseType>(summary.causes.at(1)).fExpectedExitCode == sampleCause.fExpectedExitCode);
 }
 
+TEST_CASE("Should validate expectations in file order when all causes are requested")
+{
+    std::vector<int> checks;
+    TestData testData;
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::EXPENSIVE, false);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::CHEAP, false);
+    ProcessResults processResults;
+
+    TestExecutionSummary summary = ValidateExpectationsAndSutResults(testData, processResults, ValidationMode::ALL_CAUSES);
+
+    CHECK(summary.verdict == Verdict::FAIL);
+    CHECK(summary.causes.size() == 2);
+    CHECK(checks == std::vector<int>{0, 1});
+}
+
+TEST_CASE("Should build causes only for not satisfied expectations when all causes are requested")
+{
+    std::vector<int> checks;
+    TestData testData;
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::EXPENSIVE, true);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::EXPENSIVE, false);
+    ProcessResults processResults;
+
+    TestExecutionSummary summary = ValidateExpectationsAndSutResults(testData, processResults, ValidationMode::ALL_CAUSES);
+
+    const auto &satisfied = static_cast<const RecordingExpectation&>(*testData.expectations.at(0));
+    const auto &notSatisfied = static_cast<const RecordingExpectation&>(*testData.expectations.at(1));
+    CHECK(summary.causes.size() == 1);
+    CHECK(satisfied.GetValidations() == 0);
+    CHECK(notSatisfied.GetValidations() == 1);
+}
+
+TEST_CASE("Should set test verdict to PASS without causes when verdict only is requested")
+{
+    std::vector<int> checks;
+    TestData testData;
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::EXPENSIVE, true);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::CHEAP, true);
+    ProcessResults processResults;
+
+    TestExecutionSummary summary = ValidateExpectationsAndSutResults(testData, processResults, ValidationMode::VERDICT_ONLY);
+
+    CHECK(summary.verdict == Verdict::PASS);
+    CHECK(summary.causes.empty());
+    CHECK(checks == std::vector<int>{1, 0});
+}
+
+TEST_CASE("Should check cheap expectations first when verdict only is requested")
+{
+    std::vector<int> checks;
+    TestData testData;
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::EXPENSIVE, true);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::CHEAP, true);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::EXPENSIVE, true);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::CHEAP, true);
+    ProcessResults processResults;
+
+    ValidateExpectationsAndSutResults(testData, processResults, ValidationMode::VERDICT_ONLY);
+
+    CHECK(checks == std::vector<int>{1, 3, 0, 2});
+}
+
+TEST_CASE("Should stop at first not satisfied expectation when verdict only is requested")
+{
+    std::vector<int> checks;
+    TestData testData;
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::EXPENSIVE, false);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::CHEAP, false);
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::CHEAP, true);
+    ProcessResults processResults;
+
+    TestExecutionSummary summary = ValidateExpectationsAndSutResults(testData, processResults, ValidationMode::VERDICT_ONLY);
+
+    CHECK(summary.verdict == Verdict::FAIL);
+    CHECK(summary.causes.empty());
+    CHECK(checks == std::vector<int>{1});
+}
+
+TEST_CASE("Should not build causes when verdict only is requested")
+{
+    std::vector<int> checks;
+    TestData testData;
+    AppendRecordingExpectation(testData, checks, expectation::Expectation::Cost::CHEAP, false);
+    ProcessResults processResults;
+
+    ValidateExpectationsAndSutResults(testData, processResults, ValidationMode::VERDICT_ONLY);
+
+    const auto &expectation = static_cast<const RecordingExpectation&>(*testData.expectations.front());
+    CHECK(expectation.GetValidations() == 0);
+}
+
 }
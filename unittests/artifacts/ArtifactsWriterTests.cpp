@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/artifacts/ArtifactsWriter.hpp"
+#include "headers/exception/FileWriteException.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+
+
+namespace omtt::artifacts
+{
+
+namespace
+{
+
+// collects the output passed by the writer
+class OutputCollector : public OutputObserver
+{
+public:
+    void OnOutput(const std::string_view &chunk) override { fOutput += chunk; }
+
+    std::string fOutput;
+};
+
+std::vector<std::string>
+ListDirectory(const Path &path)
+{
+    std::vector<std::string> names;
+
+    DIR *directory = opendir(path.c_str());
+    REQUIRE(directory != nullptr);
+    while (const dirent *entry = readdir(directory)) {
+        const std::string name = entry->d_name;
+        if (name != "." && name != "..") {
+            names.push_back(name);
+        }
+    }
+    closedir(directory);
+
+    return names;
+}
+
+// the directory and its files are removed at the end of the test
+struct TemporaryDirectory
+{
+    TemporaryDirectory()
+        :
+        path("artifacts_writer_tests-XXXXXX")
+    {
+        REQUIRE(mkdtemp(path.data()) != nullptr);
+    }
+
+    ~TemporaryDirectory()
+    {
+        for (const auto &name : ListDirectory(path)) {
+            std::remove((path + "/" + name).c_str());
+        }
+        std::remove(path.c_str());
+    }
+
+    Path path;
+};
+
+std::string
+ReadFile(const Path &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    REQUIRE(file.good());
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void
+WriteFile(const Path &path, const std::string &content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+}
+
+TEST_CASE("Should escape the directories separators in the artifact name")
+{
+    CHECK(artifact_name("test.omtt") == "test.omtt");
+    CHECK(artifact_name("dir/sub/test.omtt#2") == "dir%2Fsub%2Ftest.omtt#2");
+}
+
+TEST_CASE("Should give different artifact names to different tests")
+{
+    CHECK(artifact_name("a/b.omtt") != artifact_name("a_b.omtt"));
+    CHECK(artifact_name("a/b.omtt") != artifact_name("a%2Fb.omtt"));
+    CHECK(artifact_name("a%2Fb.omtt") == "a%252Fb.omtt");
+}
+
+TEST_CASE("Should pass the recorded output to the observer")
+{
+    const TemporaryDirectory temporaryDirectory;
+    const Path &directory = temporaryDirectory.path;
+    ArtifactsWriter writer(directory);
+    OutputCollector collector;
+
+    OutputObserver &observer = writer.Record(collector);
+    observer.OnOutput("first ");
+    observer.OnOutput("second");
+
+    CHECK(collector.fOutput == "first second");
+}
+
+TEST_CASE("Should write nothing when the artifacts are not saved")
+{
+    const TemporaryDirectory temporaryDirectory;
+    const Path &directory = temporaryDirectory.path;
+    ArtifactsWriter writer(directory);
+    OutputCollector collector;
+
+    writer.Record(collector).OnOutput("output");
+
+    CHECK(ListDirectory(directory).empty());
+}
+
+TEST_CASE("Should save the output, error output and input")
+{
+    const TemporaryDirectory temporaryDirectory;
+    const Path &directory = temporaryDirectory.path;
+    ArtifactsWriter writer(directory);
+    OutputCollector collector;
+
+    OutputObserver &observer = writer.Record(collector);
+    observer.OnOutput("some ");
+    observer.OnOutput(std::string(100000, 'x'));
+
+    writer.Save("dir/test.omtt#1", "error\n", "input", std::nullopt);
+
+    CHECK(ReadFile(directory + "/dir%2Ftest.omtt#1.stdout") == "some " + std::string(100000, 'x'));
+    CHECK(ReadFile(directory + "/dir%2Ftest.omtt#1.stderr") == "error\n");
+    CHECK(ReadFile(directory + "/dir%2Ftest.omtt#1.input") == "input");
+}
+
+TEST_CASE("Should save the output bigger than the memory output size")
+{
+    const TemporaryDirectory temporaryDirectory;
+    const Path &directory = temporaryDirectory.path;
+    ArtifactsWriter writer(directory);
+    OutputCollector collector;
+    const std::string chunk(ArtifactsWriter::MEMORY_OUTPUT_SIZE / 2 + 1, 'x');
+
+    OutputObserver &observer = writer.Record(collector);
+    observer.OnOutput(chunk);
+    observer.OnOutput(chunk);
+    observer.OnOutput("end");
+    writer.Save("big.omtt", "", "", std::nullopt);
+
+    writer.Record(collector).OnOutput("small");
+    writer.Save("small.omtt", "", "", std::nullopt);
+
+    CHECK(ReadFile(directory + "/big.omtt.stdout") == chunk + chunk + "end");
+    CHECK(ReadFile(directory + "/small.omtt.stdout") == "small");
+}
+
+TEST_CASE("Should save only the output of the last recorded test")
+{
+    const TemporaryDirectory temporaryDirectory;
+    const Path &directory = temporaryDirectory.path;
+    ArtifactsWriter writer(directory);
+    OutputCollector collector;
+
+    writer.Record(collector).OnOutput("first test output");
+    writer.Record(collector).OnOutput("second");
+
+    writer.Save("test.omtt", "", "", std::nullopt);
+
+    CHECK(ReadFile(directory + "/test.omtt.stdout") == "second");
+    CHECK(ReadFile(directory + "/test.omtt.stderr").empty());
+}
+
+TEST_CASE("Should copy the input file")
+{
+    const TemporaryDirectory temporaryDirectory;
+    const Path &directory = temporaryDirectory.path;
+    const Path inputFilePath = directory + "-input.txt";
+    WriteFile(inputFilePath, "input file\ncontent\n");
+
+    ArtifactsWriter writer(directory);
+    OutputCollector collector;
+    writer.Record(collector);
+
+    writer.Save("test.omtt", "", "not used", inputFilePath);
+
+    CHECK(ReadFile(directory + "/test.omtt.input") == "input file\ncontent\n");
+    CHECK(ReadFile(directory + "/test.omtt.stdout").empty());
+
+    std::remove(inputFilePath.c_str());
+}
+
+TEST_CASE("Should throw when the artifacts directory doesn't exist")
+{
+    CHECK_THROWS_AS(ArtifactsWriter("artifacts_writer_tests-missing/directory"), exception::FileWriteException);
+}
+
+}  // omtt::artifacts
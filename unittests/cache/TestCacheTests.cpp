@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/cache/TestCache.hpp"
+#include "headers/expectation/ExitCodeExpectation.hpp"
+#include "headers/expectation/FullOutputExpectation.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+
+namespace omtt::cache
+{
+
+namespace
+{
+
+const Path testFilePath = "test_cache_tests-test_file.omtt";
+const Path cacheFilePath = "test_cache_tests-cache.omttc";
+
+const std::string testFileBuffer = "RUN\n"
+                                   "WITH INPUT\n"
+                                   "some input\n"
+                                   "EXPECT OUTPUT\n"
+                                   "some output\n"
+                                   "EXPECT EXIT CODE 3";
+
+void
+WriteFile(const Path &path, const std::string &content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+bool
+FileExists(const Path &path)
+{
+    return std::ifstream(path).good();
+}
+
+void
+CheckTestData(const std::vector<TestData> &tests, const std::string &buffer)
+{
+    REQUIRE(tests.size() == 1);
+    const TestData &data = tests.at(0);
+
+    CHECK(data.input == "some input");
+    CHECK(data.input.data() == buffer.data() + 15);
+    REQUIRE(data.expectations.size() == 2);
+
+    auto *output = dynamic_cast<expectation::FullOutputExpectation*>(data.expectations.at(0).get());
+    REQUIRE(output != nullptr);
+    CHECK(output->GetContent() == "some output");
+
+    auto *exitCode = dynamic_cast<expectation::ExitCodeExpectation*>(data.expectations.at(1).get());
+    REQUIRE(exitCode != nullptr);
+    CHECK(exitCode->GetContent() == 3);
+}
+
+}
+
+
+TEST_GROUP("Test cache")
+{
+    std::remove(cacheFilePath.c_str());
+    WriteFile(testFilePath, testFileBuffer);
+
+    UNIT_TEST("Should parse test file when cache file does not exist")
+    {
+        TestCache sut(cacheFilePath);
+
+        const std::vector<TestData> data = sut.Parse(testFilePath, testFileBuffer);
+
+        CheckTestData(data, testFileBuffer);
+    }
+
+    UNIT_TEST("Should create cache file on save")
+    {
+        TestCache sut(cacheFilePath);
+        sut.Parse(testFilePath, testFileBuffer);
+
+        sut.Save();
+
+        CHECK(FileExists(cacheFilePath));
+    }
+
+    UNIT_TEST("Should not create cache file when nothing was parsed")
+    {
+        TestCache sut(cacheFilePath);
+
+        sut.Save();
+
+        CHECK(!FileExists(cacheFilePath));
+    }
+
+    UNIT_TEST("Should give the same test data when parsed from the cache")
+    {
+        {
+            TestCache cache(cacheFilePath);
+            cache.Parse(testFilePath, testFileBuffer);
+            cache.Save();
+        }
+
+        TestCache sut(cacheFilePath);
+        const std::string buffer = testFileBuffer;
+
+        const std::vector<TestData> data = sut.Parse(testFilePath, buffer);
+
+        CheckTestData(data, buffer);
+    }
+
+    UNIT_TEST("Should not refresh entry when test file is unchanged")
+    {
+        {
+            TestCache cache(cacheFilePath);
+            cache.Parse(testFilePath, testFileBuffer);
+            cache.Save();
+        }
+
+        TestCache sut(cacheFilePath);
+        std::remove(cacheFilePath.c_str());
+
+        sut.Parse(testFilePath, testFileBuffer);
+        sut.Save();
+
+        CHECK(!FileExists(cacheFilePath));
+    }
+
+    UNIT_TEST("Should refresh entry when test file content is changed")
+    {
+        {
+            TestCache cache(cacheFilePath);
+            cache.Parse(testFilePath, testFileBuffer);
+            cache.Save();
+        }
+
+        const std::string changedBuffer = "RUN\n"
+                                          "WITH INPUT\n"
+                                          "other input";
+        WriteFile(testFilePath, changedBuffer);
+
+        TestCache sut(cacheFilePath);
+        std::remove(cacheFilePath.c_str());
+
+        const std::vector<TestData> data = sut.Parse(testFilePath, changedBuffer);
+        sut.Save();
+
+        REQUIRE(data.size() == 1);
+        CHECK(data.at(0).input == "other input");
+        CHECK(data.at(0).expectations.size() == 0);
+        CHECK(FileExists(cacheFilePath));
+
+        WriteFile(testFilePath, testFileBuffer);
+    }
+
+    UNIT_TEST("Should give all test cases of the file when parsed from the cache")
+    {
+        const std::string buffer = "RUN\n"
+                                   "WITH INPUT\n"
+                                   "first input\n"
+                                   "EXPECT EXIT CODE 1\n"
+                                   "RUN\n"
+                                   "WITH INPUT\n"
+                                   "second input\n"
+                                   "EXPECT EXIT CODE 2\n";
+        WriteFile(testFilePath, buffer);
+
+        {
+            TestCache cache(cacheFilePath);
+            cache.Parse(testFilePath, buffer);
+            cache.Save();
+        }
+
+        TestCache sut(cacheFilePath);
+
+        const std::vector<TestData> data = sut.Parse(testFilePath, buffer);
+
+        REQUIRE(data.size() == 2);
+        CHECK(data.at(0).input == "first input");
+        CHECK(data.at(1).input == "second input");
+        REQUIRE(data.at(1).expectations.size() == 1);
+        auto *exitCode = dynamic_cast<expectation::ExitCodeExpectation*>(data.at(1).expectations.at(0).get());
+        REQUIRE(exitCode != nullptr);
+        CHECK(exitCode->GetContent() == 2);
+
+        WriteFile(testFilePath, testFileBuffer);
+    }
+
+    UNIT_TEST("Should not find tests count of the file which is not in the cache")
+    {
+        TestCache sut(cacheFilePath);
+
+        CHECK(!sut.FindTestsCount(testFilePath).has_value());
+    }
+
+    UNIT_TEST("Should find tests count of the file in the cache")
+    {
+        const std::string buffer = "RUN\n"
+                                   "WITH EMPTY INPUT\n"
+                                   "RUN\n"
+                                   "WITH EMPTY INPUT\n";
+        WriteFile(testFilePath, buffer);
+
+        {
+            TestCache cache(cacheFilePath);
+            cache.Parse(testFilePath, buffer);
+            cache.Save();
+        }
+
+        TestCache sut(cacheFilePath);
+
+        CHECK(sut.FindTestsCount(testFilePath) == std::optional<std::size_t>(2));
+
+        WriteFile(testFilePath, testFileBuffer);
+    }
+
+    UNIT_TEST("Should not find tests count when test file is changed")
+    {
+        {
+            TestCache cache(cacheFilePath);
+            cache.Parse(testFilePath, testFileBuffer);
+            cache.Save();
+        }
+
+        WriteFile(testFilePath, testFileBuffer + "\n");
+
+        TestCache sut(cacheFilePath);
+
+        CHECK(!sut.FindTestsCount(testFilePath).has_value());
+
+        WriteFile(testFilePath, testFileBuffer);
+    }
+
+    UNIT_TEST("Should ignore cache file with unknown format")
+    {
+        WriteFile(cacheFilePath, "this is not a cache file, but it is long enough to have a header");
+
+        TestCache sut(cacheFilePath);
+
+        const std::vector<TestData> data = sut.Parse(testFilePath, testFileBuffer);
+        sut.Save();
+
+        CheckTestData(data, testFileBuffer);
+
+        TestCache reloaded(cacheFilePath);
+        CheckTestData(reloaded.Parse(testFilePath, testFileBuffer), testFileBuffer);
+    }
+
+    std::remove(cacheFilePath.c_str());
+    std::remove(testFilePath.c_str());
+}
+
+}
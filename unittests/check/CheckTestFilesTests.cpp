@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/check/CheckTestFiles.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+
+namespace omtt::check
+{
+
+namespace
+{
+
+const Path validTestFilePath = "check_test_files_tests-valid.omtt";
+const Path twoTestsFilePath = "check_test_files_tests-two_tests.omtt";
+const Path lexerErrorTestFilePath = "check_test_files_tests-lexer_error.omtt";
+const Path parserErrorTestFilePath = "check_test_files_tests-parser_error.omtt";
+const Path missingKeywordTestFilePath = "check_test_files_tests-missing_keyword.omtt";
+const Path missingTestFilePath = "check_test_files_tests-missing.omtt";
+
+void
+WriteFile(const Path &path, const std::string &content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+}
+
+
+TEST_GROUP("Check test files")
+{
+    WriteFile(validTestFilePath, "RUN\n"
+                                 "WITH INPUT\n"
+                                 "some input\n"
+                                 "EXPECT EXIT CODE 0");
+    WriteFile(twoTestsFilePath, "RUN\n"
+                                "WITH EMPTY INPUT\n"
+                                "RUN\n"
+                                "WITH EMPTY INPUT");
+    WriteFile(lexerErrorTestFilePath, "RUN\n"
+                                      "WITH EMPTY INPUT\n"
+                                      "EXPECT EXIT CODE 1x");
+    WriteFile(parserErrorTestFilePath, "RUN\n"
+                                       "EXPECT EXIT CODE 1");
+    WriteFile(missingKeywordTestFilePath, "RUN\n"
+                                          "WITH EMPTY INPUT\n"
+                                          "EXPECT");
+
+    UNIT_TEST("Should not report errors for valid test files")
+    {
+        const CheckSummary summary = CheckTestFiles({validTestFilePath, twoTestsFilePath}, 2);
+
+        CHECK(summary.errors.empty());
+        CHECK(summary.testsCount == 3);
+    }
+
+    UNIT_TEST("Should report lexer error with position of unexpected character")
+    {
+        const CheckSummary summary = CheckTestFiles({lexerErrorTestFilePath}, 1);
+
+        REQUIRE(summary.errors.size() == 1);
+        CHECK(summary.errors.at(0).path == lexerErrorTestFilePath);
+        CHECK(summary.errors.at(0).position == 39);
+        CHECK(summary.errors.at(0).message == "Unexpected character 'x' at 39 byte.");
+    }
+
+    UNIT_TEST("Should report parser error with position of wrong token")
+    {
+        const CheckSummary summary = CheckTestFiles({parserErrorTestFilePath}, 1);
+
+        REQUIRE(summary.errors.size() == 1);
+        CHECK(summary.errors.at(0).path == parserErrorTestFilePath);
+        CHECK(summary.errors.at(0).position == 4);
+        CHECK(summary.errors.at(0).message == "Expected 'WITH' (KEYWORD), but got 'EXPECT' (KEYWORD).");
+    }
+
+    UNIT_TEST("Should report missing token at the end of file")
+    {
+        const CheckSummary summary = CheckTestFiles({missingKeywordTestFilePath}, 1);
+
+        REQUIRE(summary.errors.size() == 1);
+        CHECK(summary.errors.at(0).position == 27);
+    }
+
+    UNIT_TEST("Should report file read error without position")
+    {
+        const CheckSummary summary = CheckTestFiles({missingTestFilePath}, 1);
+
+        REQUIRE(summary.errors.size() == 1);
+        CHECK(summary.errors.at(0).path == missingTestFilePath);
+        CHECK_FALSE(summary.errors.at(0).position.has_value());
+    }
+
+    UNIT_TEST("Should report errors of all files in the given order")
+    {
+        const TestPaths testFiles = {parserErrorTestFilePath,
+                                     validTestFilePath,
+                                     lexerErrorTestFilePath,
+                                     missingKeywordTestFilePath,
+                                     twoTestsFilePath};
+
+        const CheckSummary summary = CheckTestFiles(testFiles, 4);
+
+        REQUIRE(summary.errors.size() == 3);
+        CHECK(summary.errors.at(0).path == parserErrorTestFilePath);
+        CHECK(summary.errors.at(1).path == lexerErrorTestFilePath);
+        CHECK(summary.errors.at(2).path == missingKeywordTestFilePath);
+        CHECK(summary.testsCount == 3);
+    }
+
+    UNIT_TEST("Should check files when there are more threads than files")
+    {
+        const CheckSummary summary = CheckTestFiles({validTestFilePath}, 16);
+
+        CHECK(summary.errors.empty());
+        CHECK(summary.testsCount == 1);
+    }
+
+    std::remove(validTestFilePath.c_str());
+    std::remove(twoTestsFilePath.c_str());
+    std::remove(lexerErrorTestFilePath.c_str());
+    std::remove(parserErrorTestFilePath.c_str());
+    std::remove(missingKeywordTestFilePath.c_str());
+}
+
+}
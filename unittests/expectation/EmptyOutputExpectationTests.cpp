@@ -42,4 +42,20 @@ TEST_CASE("Should not be satisfied when output is not empty")
     CHECK(validationResult.isSatisfied() == false);
 }
 
+TEST_CASE("Should check error output when error output stream is given")
+{
+    const ProcessResults emptyErrors {0, "some output", ""};
+    const ProcessResults notEmptyErrors {0, "", "some errors"};
+    EmptyOutputExpectation expectation(Stream::ERROR_OUTPUT);
+
+    CHECK(expectation.Validate(emptyErrors).isSatisfied() == true);
+
+    auto validationResult = expectation.Validate(notEmptyErrors);
+
+    REQUIRE(validationResult.isSatisfied() == false);
+    const auto cause = std::get<validation::EmptyOutputCause>(*validationResult.cause);
+    CHECK(cause.fStream == Stream::ERROR_OUTPUT);
+    CHECK(cause.fOutput == "some errors");
+}
+
 }
@@ -88,4 +88,11 @@ TEST_CASE("Should contain cause with process exit code when expectation is not s
     CHECK(cause.fExitCode == processExitCode);
 }
 
+TEST_CASE("Should be cheap to validate")
+{
+    ExitCodeExpectation expectation(0);
+
+    CHECK(expectation.GetCost() == Expectation::Cost::CHEAP);
+}
+
 }
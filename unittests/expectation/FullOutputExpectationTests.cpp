@@ -10,12 +10,20 @@
 
 #include "headers/expectation/FullOutputExpectation.hpp"
 #include "headers/expectation/validation/FullOutputCause.hpp"
+#include "headers/expectation/validation/OutputDiffCause.hpp"
 #include "headers/ProcessResults.hpp"
 
 
 namespace omtt
 {
 
+namespace
+{
+
+const Path testFilePath = "full_output_expectation_tests-test_file.omtt";
+
+}
+
 TEST_CASE("Should be satisfied when expected output and SUT output is the same")
 {
     const std::string expectedOutput = "some output";
@@ -189,4 +197,126 @@ TEST_CASE("Cause should point after last byte of SUT output text when SUT output
     CHECK(cause.fDifferencePosition == 4);
 }
 
+TEST_CASE("Cause should contain line and column of the difference")
+{
+    const std::string expectedOutput = "first line\nsecond line\n";
+    const ProcessResults sutResults {0, "first line\nsecond_line\n"};
+
+    expectation::FullOutputExpectation expectation(expectedOutput);
+
+    auto validationReults = expectation.Validate(sutResults);
+
+    CHECK(validationReults.cause.has_value());
+    const auto cause = std::get<expectation::validation::FullOutputCause>(*validationReults.cause);
+    CHECK(cause.fDifferencePosition == 17);
+    CHECK(cause.fDifferenceLine == 2);
+    CHECK(cause.fDifferenceColumn == 7);
+}
+
+TEST_CASE("Should compare error output when error output stream is given")
+{
+    const std::string expectedErrors = "some errors";
+    const ProcessResults sutResults {0, "some errors!", "some errors"};
+
+    expectation::FullOutputExpectation expectation(expectedErrors, expectation::Stream::ERROR_OUTPUT);
+
+    CHECK(expectation.NeedsWholeOutput() == false);
+    CHECK(expectation.Validate(sutResults).isSatisfied() == true);
+}
+
+TEST_CASE("Should compare normalized error output when it is given")
+{
+    const std::string expectedErrors = "some errors\n";
+    ProcessResults sutResults {0, "", "some errors\r\n"};
+    sutResults.normalizedErrors = "some errors\n";
+
+    expectation::FullOutputExpectation expectation(expectedErrors, expectation::Stream::ERROR_OUTPUT);
+
+    CHECK(expectation.NeedsErrorOutput() == true);
+    CHECK(expectation.Validate(sutResults).isSatisfied() == true);
+}
+
+TEST_CASE("Should not need error output when output stream is given")
+{
+    expectation::FullOutputExpectation expectation("some output");
+
+    CHECK(expectation.NeedsErrorOutput() == false);
+}
+
+TEST_CASE("Cause should point to error output stream")
+{
+    const std::string expectedErrors = "some errors";
+    const ProcessResults sutResults {0, "some errors", "other errors"};
+
+    expectation::FullOutputExpectation expectation(expectedErrors, expectation::Stream::ERROR_OUTPUT);
+
+    auto validationReults = expectation.Validate(sutResults);
+
+    REQUIRE(validationReults.isSatisfied() == false);
+    const auto cause = std::get<expectation::validation::FullOutputCause>(*validationReults.cause);
+    CHECK(cause.fStream == expectation::Stream::ERROR_OUTPUT);
+    CHECK(cause.fOutput == "other errors");
+    CHECK(cause.fDifferencePosition == 0);
+}
+
+TEST_CASE("Cause should contain line differences when they are shown")
+{
+    const std::string expectedOutput = "first\nsecond\nthird\n";
+    const ProcessResults sutResults {0, "first\nthird\n"};
+
+    regex::PatternCache patternCache;
+    expectation::FullOutputExpectation expectation(expectedOutput);
+    expectation.Prepare({testFilePath, patternCache, true});
+
+    auto validationReults = expectation.Validate(sutResults);
+
+    REQUIRE(validationReults.isSatisfied() == false);
+    const auto cause = std::get<expectation::validation::OutputDiffCause>(*validationReults.cause);
+    REQUIRE(cause.fHunks.size() == 1);
+    REQUIRE(cause.fHunks[0].lines.size() == 3);
+    CHECK(cause.fHunks[0].lines[1].kind == expectation::detail::DiffLine::Kind::DELETED);
+    CHECK(cause.fHunks[0].lines[1].text == "second\n");
+}
+
+TEST_CASE("Cause should point to the first difference when outputs are too different for line differences")
+{
+    std::string expectedOutput;
+    std::string output;
+    for (int i = 0; i < 2000; ++i) {
+        expectedOutput += "expected\n";
+        output += "output\n";
+    }
+    const ProcessResults sutResults {0, output};
+
+    regex::PatternCache patternCache;
+    expectation::FullOutputExpectation expectation(expectedOutput);
+    expectation.Prepare({testFilePath, patternCache, true});
+
+    auto validationReults = expectation.Validate(sutResults);
+
+    REQUIRE(validationReults.isSatisfied() == false);
+    const auto cause = std::get<expectation::validation::FullOutputCause>(*validationReults.cause);
+    CHECK(cause.fDifferencePosition == 0);
+}
+
+TEST_CASE("Should check verdict without cause when expected output and SUT output is the same")
+{
+    const std::string expectedOutput = "some output";
+    const ProcessResults sutResults {0, "some output"};
+
+    expectation::FullOutputExpectation expectation(expectedOutput);
+
+    CHECK(expectation.IsSatisfied(sutResults) == true);
+}
+
+TEST_CASE("Should check verdict without cause when expected output and SUT output is not the same")
+{
+    const std::string expectedOutput = "some output";
+    const ProcessResults sutResults {0, "some outpuT"};
+
+    expectation::FullOutputExpectation expectation(expectedOutput);
+
+    CHECK(expectation.IsSatisfied(sutResults) == false);
+}
+
 }
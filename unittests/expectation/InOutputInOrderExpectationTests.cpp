@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/InOutputInOrderExpectation.hpp"
+#include "headers/expectation/validation/InOutputInOrderCause.hpp"
+#include "headers/ProcessResults.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+class InOrderSearch
+{
+public:
+    explicit InOrderSearch(const std::string &expectedTexts)
+        :
+        fExpectedTexts(expectedTexts),
+        fExpectation(fExpectedTexts)
+    {
+        fExpectation.Prepare({testFilePath, fPatternCache});
+    }
+
+    expectation::validation::ValidationResult
+    Search(const std::vector<std::string> &chunks)
+    {
+        for (const auto &chunk : chunks) {
+            fExpectation.Consume(chunk);
+        }
+
+        return fExpectation.Validate({0, ""});
+    }
+
+private:
+    const std::string fExpectedTexts;
+    regex::PatternCache fPatternCache;
+    expectation::InOutputInOrderExpectation fExpectation;
+};
+
+}
+
+
+TEST_CASE("Should split expected texts into lines without empty ones")
+{
+    expectation::InOutputInOrderExpectation expectation("first\n\nsecond\n");
+
+    CHECK(expectation.GetTexts() == std::vector<std::string_view>{"first", "second"});
+}
+
+TEST_CASE("Should be satisfied when texts are found in order")
+{
+    InOrderSearch search("starting\nready\nstopped\n");
+    auto result = search.Search({"log: starting\nlog: ready\nlog: working\nlog: stopped\n"});
+
+    CHECK(result.isSatisfied() == true);
+    CHECK(!result.cause.has_value());
+}
+
+TEST_CASE("Should find texts split between chunks")
+{
+    InOrderSearch search("starting\nready\n");
+    auto result = search.Search({"log: sta", "rting\nlog: re", "a", "dy\n"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should find text which starts with a part of the text matched before")
+{
+    InOrderSearch search("aab\n");
+    auto result = search.Search({"aaa", "ab"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should not be satisfied when texts are found in different order")
+{
+    InOrderSearch search("ready\nstarting\n");
+    auto result = search.Search({"starting\nready\n"});
+
+    CHECK(result.isSatisfied() == false);
+}
+
+TEST_CASE("Should search the next text after the previous one")
+{
+    InOrderSearch search("abc\nbcd\n");
+    auto result = search.Search({"abcd"});
+
+    CHECK(result.isSatisfied() == false);
+}
+
+TEST_CASE("Should report the first text not found and position after the last found text")
+{
+    InOrderSearch search("starting\nready\nstopped\n");
+    auto result = search.Search({"starting\n", "stopped\n"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::InOutputInOrderCause>(*result.cause);
+    CHECK(cause.fExpectedPartialOutput == "ready");
+    CHECK(cause.fTextNumber == 2);
+    CHECK(cause.fTextsCount == 3);
+    CHECK(cause.fSearchStartPosition == 8);
+}
+
+TEST_CASE("Should start searching again after prepare")
+{
+    expectation::InOutputInOrderExpectation expectation("ready\n");
+    regex::PatternCache patternCache;
+    expectation.Consume("ready\n");
+    expectation.Prepare({testFilePath, patternCache});
+
+    CHECK(expectation.Validate({0, ""}).isSatisfied() == false);
+}
+
+}
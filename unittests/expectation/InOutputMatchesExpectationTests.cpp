@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/InOutputMatchesExpectation.hpp"
+#include "headers/expectation/validation/InOutputMatchesCause.hpp"
+#include "headers/ProcessResults.hpp"
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+}
+
+
+TEST_CASE("Should be satisfied when part of the output matches the pattern")
+{
+    regex::PatternCache patternCache;
+    expectation::InOutputMatchesExpectation expectation("^ERROR: [a-z]+$");
+
+    expectation.Prepare({testFilePath, patternCache});
+    expectation.Consume("INFO: started\nERR");
+    expectation.Consume("OR: failed\nINFO: done\n");
+
+    CHECK(expectation.Validate({0, ""}).isSatisfied() == true);
+}
+
+TEST_CASE("Should not be satisfied when no part of the output matches the pattern")
+{
+    regex::PatternCache patternCache;
+    expectation::InOutputMatchesExpectation expectation("^ERROR: [a-z]+$");
+
+    expectation.Prepare({testFilePath, patternCache});
+    expectation.Consume("INFO: ERROR: failed\n");
+
+    auto result = expectation.Validate({0, ""});
+
+    REQUIRE(result.isSatisfied() == false);
+    CHECK(std::get<expectation::validation::InOutputMatchesCause>(*result.cause).fPattern == "^ERROR: [a-z]+$");
+}
+
+TEST_CASE("Should start matching again after prepare")
+{
+    regex::PatternCache patternCache;
+    expectation::InOutputMatchesExpectation expectation("found");
+
+    expectation.Prepare({testFilePath, patternCache});
+    expectation.Consume("found");
+    CHECK(expectation.Validate({0, ""}).isSatisfied() == true);
+
+    expectation.Prepare({testFilePath, patternCache});
+    expectation.Consume("nothing");
+    CHECK(expectation.Validate({0, ""}).isSatisfied() == false);
+}
+
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputFileExpectation.hpp"
+#include "headers/expectation/validation/OutputFileCause.hpp"
+#include "headers/exception/FileReadException.hpp"
+#include "headers/ProcessResults.hpp"
+
+#include <fstream>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "output_file_expectation_tests-test_file.omtt";
+const std::string expectedOutputFile = "output_file_expectation_tests-expected.txt";
+
+void
+WriteExpectedOutput(const std::string &content)
+{
+    std::ofstream file(expectedOutputFile, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+class OutputFileComparison
+{
+public:
+    explicit OutputFileComparison(const std::string &expectedOutput,
+                                  const normalize::Filters &normalization = {})
+        :
+        fExpectation(expectedOutputFile, normalization)
+    {
+        WriteExpectedOutput(expectedOutput);
+        fExpectation.Prepare({testFilePath, fPatternCache});
+    }
+
+    expectation::validation::ValidationResult
+    Compare(const std::vector<std::string> &chunks)
+    {
+        for (const auto &chunk : chunks) {
+            fExpectation.Consume(chunk);
+        }
+
+        return fExpectation.Validate({0, ""});
+    }
+
+    bool
+    IsSatisfied(const std::vector<std::string> &chunks)
+    {
+        for (const auto &chunk : chunks) {
+            fExpectation.Consume(chunk);
+        }
+
+        return fExpectation.IsSatisfied({0, ""});
+    }
+
+private:
+    regex::PatternCache fPatternCache;
+    expectation::OutputFileExpectation fExpectation;
+};
+
+}
+
+
+TEST_CASE("Should be satisfied when output is the same as the file content")
+{
+    OutputFileComparison comparison("some output\n");
+    auto result = comparison.Compare({"some output\n"});
+
+    CHECK(result.isSatisfied() == true);
+    CHECK(!result.cause.has_value());
+}
+
+TEST_CASE("Should be satisfied when output is split into many chunks")
+{
+    OutputFileComparison comparison("some output\n");
+    auto result = comparison.Compare({"so", "me out", "", "put\n"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should be satisfied when both file and output are empty")
+{
+    OutputFileComparison comparison("");
+    auto result = comparison.Compare({});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should treat CR and CR LF in the file as LF")
+{
+    OutputFileComparison comparison("a\r\nb\rc\r\n");
+    auto result = comparison.Compare({"a\n", "b\nc", "\n"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should not be satisfied when output differs")
+{
+    OutputFileComparison comparison("some output");
+    auto result = comparison.Compare({"some other output"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputFileCause>(*result.cause);
+    CHECK(cause.fExpectedOutputFile == expectedOutputFile);
+    CHECK(cause.fDifferencePosition == 6);
+    CHECK(cause.fDifferenceLine == 1);
+    CHECK(cause.fDifferenceColumn == 7);
+    CHECK(cause.fContextPosition == 6);
+    CHECK(cause.fExpectedContext == "some output");
+    CHECK(cause.fOutputContext == "some other ou");
+}
+
+TEST_CASE("Should count the line and column of the difference across chunks")
+{
+    OutputFileComparison comparison("first\r\nsecond\nthird line\n");
+    auto result = comparison.Compare({"first\nsec", "ond\nthi", "rd lane\n"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputFileCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == 20);
+    CHECK(cause.fDifferenceLine == 3);
+    CHECK(cause.fDifferenceColumn == 8);
+}
+
+TEST_CASE("Should keep only the last matched bytes in the context")
+{
+    OutputFileComparison comparison("0123456789abc");
+    auto result = comparison.Compare({"0123", "456789", "xyz"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputFileCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == 10);
+    CHECK(cause.fContextPosition == 6);
+    CHECK(cause.fExpectedContext == "456789abc");
+    CHECK(cause.fOutputContext == "456789xyz");
+}
+
+TEST_CASE("Should not be satisfied when output is longer than the file content")
+{
+    OutputFileComparison comparison("abc");
+    auto result = comparison.Compare({"abc", "def"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputFileCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == 3);
+    CHECK(cause.fExpectedContext == "abc");
+    CHECK(cause.fOutputContext == "abcdef");
+}
+
+TEST_CASE("Should not be satisfied when output is shorter than the file content")
+{
+    OutputFileComparison comparison("abc\r\ndef");
+    auto result = comparison.Compare({"abc"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputFileCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == 3);
+    CHECK(cause.fExpectedContext == "abc\ndef");
+    CHECK(cause.fOutputContext == "abc");
+}
+
+TEST_CASE("Should apply the normalization filters to the file content")
+{
+    OutputFileComparison comparison("pid 1234  \r\n\r\n\r\ndone\t\n",
+                                    {normalize::Filter::TRIM,
+                                     normalize::Filter::SQUEEZE,
+                                     normalize::Filter::MASK_INT});
+    auto result = comparison.Compare({"pid #\n", "\ndone\n"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should filter the file content larger than one filtered chunk")
+{
+    std::string fileContent;
+    std::string output;
+    for (int i = 0; i < 20000; ++i) {
+        fileContent += "line " + std::to_string(i) + " \t \n";
+        output += "line #\n";
+    }
+
+    OutputFileComparison comparison(fileContent, {normalize::Filter::TRIM, normalize::Filter::MASK_INT});
+    std::vector<std::string> chunks;
+    for (std::string::size_type i = 0; i < output.size(); i += 4096) {
+        chunks.push_back(output.substr(i, 4096));
+    }
+
+    CHECK(comparison.Compare(chunks).isSatisfied() == true);
+}
+
+TEST_CASE("Should not be satisfied when output ends before the filtered file content")
+{
+    std::string fileContent;
+    std::string output;
+    for (int i = 0; i < 20000; ++i) {
+        fileContent += "line " + std::to_string(i) + " \t \n";
+        output += "line #\n";
+    }
+
+    OutputFileComparison comparison(fileContent + "end  \n", {normalize::Filter::TRIM, normalize::Filter::MASK_INT});
+    auto result = comparison.Compare({output});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputFileCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == output.size());
+    CHECK(cause.fDifferenceLine == 20001);
+}
+
+TEST_CASE("Should check the verdict against the rest of the filtered file content")
+{
+    const normalize::Filters filters{normalize::Filter::TRIM};
+
+    CHECK(OutputFileComparison("a  \n", filters).IsSatisfied({"a\n"}) == true);
+    CHECK(OutputFileComparison("a  \nb\n", filters).IsSatisfied({"a\n"}) == false);
+    CHECK(OutputFileComparison("a\n").IsSatisfied({"a\nb"}) == false);
+}
+
+TEST_CASE("Should show the normalized file content when output differs")
+{
+    OutputFileComparison comparison("pid 1234\nok\n", {normalize::Filter::MASK_INT});
+    auto result = comparison.Compare({"pid #\nfailed\n"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputFileCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == 6);
+    CHECK(cause.fExpectedContext == "pid #\nok\n");
+}
+
+TEST_CASE("Should resolve the file path relative to the test file directory")
+{
+    WriteExpectedOutput("some output");
+
+    regex::PatternCache patternCache;
+    expectation::OutputFileExpectation expectation(expectedOutputFile);
+    expectation.Prepare({"./" + testFilePath, patternCache});
+    expectation.Consume("some output");
+
+    CHECK(expectation.Validate({0, ""}).isSatisfied() == true);
+}
+
+TEST_CASE("Should throw when the file doesn't exist")
+{
+    regex::PatternCache patternCache;
+    expectation::OutputFileExpectation expectation("output_file_expectation_tests-not-existing.txt");
+
+    CHECK_THROWS_AS(expectation.Prepare({testFilePath, patternCache}), exception::FileReadException);
+}
+
+TEST_CASE("Should return file path as content")
+{
+    expectation::OutputFileExpectation expectation(expectedOutputFile);
+
+    CHECK(expectation.GetContent() == expectedOutputFile);
+}
+
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputJsonExpectation.hpp"
+#include "headers/expectation/validation/OutputJsonCause.hpp"
+#include "headers/json/exception/SyntaxException.hpp"
+#include "headers/ProcessResults.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+class JsonComparison
+{
+public:
+    explicit JsonComparison(const std::string &expectedOutput)
+        :
+        fExpectedOutput(expectedOutput),
+        fExpectation(fExpectedOutput)
+    {
+        fExpectation.Prepare({testFilePath, fPatternCache});
+    }
+
+    expectation::validation::ValidationResult
+    Compare(const std::vector<std::string> &chunks)
+    {
+        for (const auto &chunk : chunks) {
+            fExpectation.Consume(chunk);
+        }
+
+        return fExpectation.Validate({0, ""});
+    }
+
+private:
+    const std::string fExpectedOutput;
+    regex::PatternCache fPatternCache;
+    expectation::OutputJsonExpectation fExpectation;
+};
+
+expectation::validation::OutputJsonCause
+compare_and_get_cause(const std::string &expectedOutput, const std::string &output)
+{
+    JsonComparison comparison(expectedOutput);
+    auto result = comparison.Compare({output});
+
+    REQUIRE(result.cause.has_value());
+    return std::get<expectation::validation::OutputJsonCause>(*result.cause);
+}
+
+}
+
+
+TEST_CASE("Should be satisfied when output is the same JSON")
+{
+    JsonComparison comparison(R"({"name": "omtt", "tags": [1, 2]})");
+    auto result = comparison.Compare({R"({"name":"omtt","tags":[1,2]})"});
+
+    CHECK(result.isSatisfied() == true);
+    CHECK(!result.cause.has_value());
+}
+
+TEST_CASE("Should not compare members order, white spaces and numbers notation")
+{
+    JsonComparison comparison(R"({"a": 1, "b": {"c": 0.5, "d": null}})");
+    auto result = comparison.Compare({"{\n  \"b\": {\"d\": null, \"c\": 5e-1},\n  \"a\": 1.0\n}\n"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should compare output split between chunks")
+{
+    JsonComparison comparison(R"({"text": "long value", "number": 12345})");
+    auto result = comparison.Compare({"{\"te", "xt\": \"long ", "value\", \"number\": 123", "45}"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should throw when expected output is not a valid JSON")
+{
+    CHECK_THROWS_AS(expectation::OutputJsonExpectation("{\"a\": 1"), json::exception::SyntaxException);
+}
+
+TEST_GROUP("Differences")
+{
+
+UNIT_TEST("Should point the different value")
+{
+    auto cause = compare_and_get_cause(R"({"a": [1, {"b": "x"}]})", R"({"a": [1, {"b": "y"}]})");
+
+    CHECK(cause.fPointer == "/a/1/b");
+    CHECK(cause.fExpected == "\"x\"");
+    CHECK(cause.fActual == "\"y\"");
+}
+
+UNIT_TEST("Should report different kinds of values")
+{
+    auto cause = compare_and_get_cause(R"({"a": {}})", R"({"a": [1]})");
+
+    CHECK(cause.fPointer == "/a");
+    CHECK(cause.fExpected == "object");
+    CHECK(cause.fActual == "array");
+}
+
+UNIT_TEST("Should report different numbers")
+{
+    auto cause = compare_and_get_cause("[1.5]", "[1.50001]");
+
+    CHECK(cause.fPointer == "/0");
+    CHECK(cause.fExpected == "1.5");
+    CHECK(cause.fActual == "1.50001");
+}
+
+UNIT_TEST("Should report missing members")
+{
+    auto cause = compare_and_get_cause(R"({"a": 1, "b": true})", R"({"a": 1})");
+
+    CHECK(cause.fPointer == "/b");
+    CHECK(cause.fExpected == "true");
+    CHECK(cause.fActual == "nothing");
+}
+
+UNIT_TEST("Should report unexpected members")
+{
+    auto cause = compare_and_get_cause(R"({"a": 1})", R"({"a": 1, "b": null})");
+
+    CHECK(cause.fPointer == "/b");
+    CHECK(cause.fExpected == "nothing");
+    CHECK(cause.fActual == "null");
+}
+
+UNIT_TEST("Should report duplicated members")
+{
+    auto cause = compare_and_get_cause(R"({"a": 1})", R"({"a": 1, "a": 1})");
+
+    CHECK(cause.fPointer == "/a");
+    CHECK(cause.fActual == "duplicated member");
+}
+
+UNIT_TEST("Should report missing and unexpected array items")
+{
+    auto missing = compare_and_get_cause("[1, 2, 3]", "[1, 2]");
+    CHECK(missing.fPointer == "/2");
+    CHECK(missing.fExpected == "3");
+    CHECK(missing.fActual == "nothing");
+
+    auto unexpected = compare_and_get_cause("[1]", "[1, [2]]");
+    CHECK(unexpected.fPointer == "/1");
+    CHECK(unexpected.fExpected == "nothing");
+    CHECK(unexpected.fActual == "array");
+}
+
+UNIT_TEST("Should escape pointer tokens")
+{
+    auto cause = compare_and_get_cause(R"({"a/b": {"c~d": 1}})", R"({"a/b": {"c~d": 2}})");
+
+    CHECK(cause.fPointer == "/a~1b/c~0d");
+}
+
+UNIT_TEST("Should report the first difference only")
+{
+    auto cause = compare_and_get_cause("[1, 2, 3]", "[1, 0, 0, 0]");
+
+    CHECK(cause.fPointer == "/1");
+}
+
+UNIT_TEST("Should report invalid output")
+{
+    auto cause = compare_and_get_cause(R"({"a": [1, 2]})", R"({"a": [1, 2)");
+
+    CHECK(cause.fPointer == "/a/1");
+    CHECK(cause.fExpected == "2");
+    CHECK(cause.fActual == "invalid JSON (unexpected end of text at byte 11)");
+}
+
+UNIT_TEST("Should report empty output")
+{
+    auto cause = compare_and_get_cause("{}", "");
+
+    CHECK(cause.fPointer == "");
+    CHECK(cause.fExpected == "object");
+    CHECK(cause.fActual == "invalid JSON (unexpected end of text at byte 0)");
+}
+
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputLineCountExpectation.hpp"
+#include "headers/expectation/validation/OutputLineCountCause.hpp"
+#include "headers/ProcessResults.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+expectation::validation::ValidationResult
+validate(expectation::OutputLineCountExpectation &expectation, const std::vector<std::string> &chunks)
+{
+    regex::PatternCache patternCache;
+    expectation.Prepare({testFilePath, patternCache});
+
+    for (const auto &chunk : chunks) {
+        expectation.Consume(chunk);
+    }
+
+    return expectation.Validate({0, ""});
+}
+
+std::uint64_t
+line_count(const std::vector<std::string> &chunks)
+{
+    expectation::OutputLineCountExpectation expectation(expectation::Comparison::EXACTLY, 1000);
+
+    const auto result = validate(expectation, chunks);
+    return std::get<expectation::validation::OutputLineCountCause>(*result.cause).fLineCount;
+}
+
+}
+
+TEST_CASE("Should count no lines in empty output")
+{
+    CHECK(line_count({}) == 0);
+    CHECK(line_count({""}) == 0);
+}
+
+TEST_CASE("Should count lines ended with new line")
+{
+    CHECK(line_count({"first\nsecond\n"}) == 2);
+    CHECK(line_count({"\n\n\n"}) == 3);
+}
+
+TEST_CASE("Should count last line without new line")
+{
+    CHECK(line_count({"first\nsecond"}) == 2);
+    CHECK(line_count({"first"}) == 1);
+}
+
+TEST_CASE("Should count lines split between chunks")
+{
+    CHECK(line_count({"fir", "st\nsec", "ond\n", ""}) == 2);
+    CHECK(line_count({"first\n", "second"}) == 2);
+    CHECK(line_count({"first", "\n"}) == 1);
+}
+
+TEST_CASE("Should be satisfied when output has expected line count")
+{
+    expectation::OutputLineCountExpectation expectation(expectation::Comparison::EXACTLY, 2);
+
+    CHECK(validate(expectation, {"first\nsecond\n"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"first\n"}).isSatisfied() == false);
+}
+
+TEST_CASE("Cause should contain expected and counted lines")
+{
+    expectation::OutputLineCountExpectation expectation(expectation::Comparison::AT_MOST, 1);
+
+    const auto result = validate(expectation, {"first\nsecond\n"});
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<expectation::validation::OutputLineCountCause>(*result.cause);
+    CHECK(cause.fComparison == expectation::Comparison::AT_MOST);
+    CHECK(cause.fExpectedLineCount == 1);
+    CHECK(cause.fLineCount == 2);
+}
+
+TEST_CASE("Should be satisfied when output has at least expected line count")
+{
+    expectation::OutputLineCountExpectation expectation(expectation::Comparison::AT_LEAST, 2);
+
+    CHECK(validate(expectation, {"first\nsecond"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"first\n"}).isSatisfied() == false);
+}
+
+TEST_CASE("Should not need more output when at least expected lines are read")
+{
+    regex::PatternCache patternCache;
+    expectation::OutputLineCountExpectation expectation(expectation::Comparison::AT_LEAST, 2);
+    expectation.Prepare({testFilePath, patternCache});
+
+    expectation.Consume("first\n");
+    CHECK(expectation.NeedsMoreOutput() == true);
+
+    expectation.Consume("sec");
+    CHECK(expectation.NeedsMoreOutput() == false);
+}
+
+}  // omtt
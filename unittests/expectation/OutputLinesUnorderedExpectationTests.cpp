@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputLinesUnorderedExpectation.hpp"
+#include "headers/expectation/validation/OutputLinesUnorderedCause.hpp"
+#include "headers/ProcessResults.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+class UnorderedComparison
+{
+public:
+    explicit UnorderedComparison(const std::string &expectedOutput)
+        :
+        fExpectedOutput(expectedOutput),
+        fExpectation(fExpectedOutput)
+    {
+        fExpectation.Prepare({testFilePath, fPatternCache});
+    }
+
+    expectation::validation::ValidationResult
+    Compare(const std::vector<std::string> &chunks)
+    {
+        for (const auto &chunk : chunks) {
+            fExpectation.Consume(chunk);
+        }
+
+        return fExpectation.Validate({0, ""});
+    }
+
+    bool
+    IsSatisfied(const std::vector<std::string> &chunks)
+    {
+        for (const auto &chunk : chunks) {
+            fExpectation.Consume(chunk);
+        }
+
+        return fExpectation.IsSatisfied({0, ""});
+    }
+
+private:
+    const std::string fExpectedOutput;
+    regex::PatternCache fPatternCache;
+    expectation::OutputLinesUnorderedExpectation fExpectation;
+};
+
+}
+
+
+TEST_CASE("Should be satisfied when output has the same lines in different order")
+{
+    UnorderedComparison comparison("first\nsecond\nsecond\nthird\n");
+    auto result = comparison.Compare({"second\nthird\n", "second\nfirst\n"});
+
+    CHECK(result.isSatisfied() == true);
+    CHECK(!result.cause.has_value());
+}
+
+TEST_CASE("Should check the verdict with the last line without new line")
+{
+    CHECK(UnorderedComparison("a\nb\n").IsSatisfied({"b\na"}) == true);
+    CHECK(UnorderedComparison("a\nb\n").IsSatisfied({"b\nc"}) == false);
+}
+
+TEST_CASE("Should join lines split between chunks")
+{
+    UnorderedComparison comparison("first line\nsecond line\n");
+    auto result = comparison.Compare({"second ", "li", "ne\nfirst", " line\n"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should accept the last line without new line")
+{
+    UnorderedComparison comparison("first\nsecond\n");
+    auto result = comparison.Compare({"second\nfirst"});
+
+    CHECK(result.isSatisfied() == true);
+}
+
+TEST_CASE("Should count empty lines")
+{
+    UnorderedComparison comparison("first\n\n");
+    auto result = comparison.Compare({"first\n"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputLinesUnorderedCause>(*result.cause);
+    CHECK(cause.fMissingLinesCount == 1);
+    CHECK(cause.fMissingLines.at(0).fLine == "");
+}
+
+TEST_CASE("Should report missing and extra lines with their counts")
+{
+    UnorderedComparison comparison("first\nsecond\nsecond\nthird\n");
+    auto result = comparison.Compare({"third\nextra\nfirst\nextra\n"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputLinesUnorderedCause>(*result.cause);
+    CHECK(cause.fMissingLinesCount == 2);
+    REQUIRE(cause.fMissingLines.size() == 1);
+    CHECK(cause.fMissingLines[0].fLine == "second");
+    CHECK(cause.fMissingLines[0].fCount == 2);
+    CHECK(cause.fExtraLinesCount == 2);
+    REQUIRE(cause.fExtraLines.size() == 1);
+    CHECK(cause.fExtraLines[0].fLine == "extra");
+    CHECK(cause.fExtraLines[0].fCount == 2);
+}
+
+TEST_CASE("Should list only the first lines and count all of them")
+{
+    UnorderedComparison comparison("");
+    std::string output;
+    for (int i = 0; i < 20; ++i) {
+        output += std::to_string(i) + "\n";
+    }
+    auto result = comparison.Compare({output});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputLinesUnorderedCause>(*result.cause);
+    CHECK(cause.fExtraLinesCount == 20);
+    CHECK(cause.fExtraLines.size() == 10);
+    CHECK(cause.fExtraLines[0].fLine == "0");
+}
+
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputMatchesExpectation.hpp"
+#include "headers/expectation/validation/OutputMatchesCause.hpp"
+#include "headers/ProcessResults.hpp"
+
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+class OutputMatching
+{
+public:
+    explicit OutputMatching(const std::string &pattern)
+        :
+        fPattern(pattern),
+        fExpectation(fPattern)
+    {
+        fExpectation.Prepare({testFilePath, fPatternCache});
+    }
+
+    expectation::validation::ValidationResult
+    Match(const std::vector<std::string> &chunks)
+    {
+        for (const auto &chunk : chunks) {
+            fExpectation.Consume(chunk);
+        }
+
+        return fExpectation.Validate({0, ""});
+    }
+
+private:
+    const std::string fPattern;
+    regex::PatternCache fPatternCache;
+    expectation::OutputMatchesExpectation fExpectation;
+};
+
+}
+
+
+TEST_CASE("Should be satisfied when the whole output matches the pattern")
+{
+    OutputMatching matching("Result: [0-9]+\\n");
+    auto result = matching.Match({"Result: ", "42\n"});
+
+    CHECK(result.isSatisfied() == true);
+    CHECK(!result.cause.has_value());
+}
+
+TEST_CASE("Should not be satisfied when only part of the output matches the pattern")
+{
+    OutputMatching matching("Result: [0-9]+");
+    auto result = matching.Match({"Result: 42\n"});
+
+    CHECK(result.isSatisfied() == false);
+}
+
+TEST_CASE("Should report the longest matched prefix and its context")
+{
+    OutputMatching matching("Result: [0-9]+\\n");
+    auto result = matching.Match({"Some Result: ", "4x2\n"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputMatchesCause>(*result.cause);
+    CHECK(cause.fPattern == "Result: [0-9]+\\n");
+    CHECK(cause.fMatchedPrefixSize == 0);
+    CHECK(cause.fContextPosition == 0);
+    CHECK(cause.fOutputContext == "Some Re");
+}
+
+TEST_CASE("Should keep the context around the first byte that doesn't match")
+{
+    OutputMatching matching("Result: [0-9]+\\n");
+    auto result = matching.Match({"Result: ", "4x2\n"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputMatchesCause>(*result.cause);
+    CHECK(cause.fMatchedPrefixSize == 9);
+    CHECK(cause.fContextPosition == 6);
+    CHECK(cause.fOutputContext == "ult: 4x2\n");
+}
+
+TEST_CASE("Should report the whole output as matched prefix when output is too short")
+{
+    OutputMatching matching("abc");
+    auto result = matching.Match({"ab"});
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputMatchesCause>(*result.cause);
+    CHECK(cause.fMatchedPrefixSize == 2);
+    CHECK(cause.fContextPosition == 2);
+    CHECK(cause.fOutputContext == "ab");
+}
+
+TEST_CASE("Should return pattern as content")
+{
+    expectation::OutputMatchesExpectation expectation("a+");
+
+    CHECK(expectation.GetContent() == "a+");
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputSha256Expectation.hpp"
+#include "headers/expectation/exception/DigestSyntaxException.hpp"
+#include "headers/expectation/validation/OutputSha256Cause.hpp"
+#include "headers/ProcessResults.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+// SHA-256 of "some output\n"
+const std::string someOutputDigest = "71fe348d841941fe2c3a1828f01dc9a0cdad7acaef8b41707bd3f36bac3260ba";
+
+expectation::validation::ValidationResult
+validate(expectation::OutputSha256Expectation &expectation, const std::vector<std::string> &chunks)
+{
+    regex::PatternCache patternCache;
+    expectation.Prepare({testFilePath, patternCache});
+
+    for (const auto &chunk : chunks) {
+        expectation.Consume(chunk);
+    }
+
+    return expectation.Validate({0, ""});
+}
+
+}
+
+TEST_CASE("Should be satisfied when output digest is the same as expected")
+{
+    expectation::OutputSha256Expectation expectation(someOutputDigest);
+
+    CHECK(validate(expectation, {"some output\n"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"some ", "out", "put\n"}).isSatisfied() == true);
+}
+
+TEST_CASE("Should not be satisfied when output digest is different than expected")
+{
+    expectation::OutputSha256Expectation expectation(someOutputDigest);
+
+    const auto result = validate(expectation, {"hello\n"});
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<expectation::validation::OutputSha256Cause>(*result.cause);
+    CHECK(cause.fExpectedDigest == someOutputDigest);
+    CHECK(cause.fDigest == "5891b5b522d5df086d0ff0b110fbd9d21bb4fc7163af34d08286a2e846f6be03");
+    CHECK(cause.fSize == 6);
+    CHECK(cause.fHead == "hello\n");
+    CHECK(cause.fTail == "hello\n");
+}
+
+TEST_CASE("Cause should contain beginning and end of long output")
+{
+    expectation::OutputSha256Expectation expectation(someOutputDigest);
+
+    const auto result = validate(expectation, {"first line\n", "sec", "ond line\n", "end"});
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<expectation::validation::OutputSha256Cause>(*result.cause);
+    CHECK(cause.fSize == 26);
+    CHECK(cause.fHead == "first l");
+    CHECK(cause.fTail == "ine\nend");
+}
+
+TEST_CASE("Should throw exception when expected digest is not valid")
+{
+    CHECK_THROWS_AS(expectation::OutputSha256Expectation("71fe348d"), expectation::exception::DigestSyntaxException);
+    CHECK_THROWS_AS(expectation::OutputSha256Expectation(""), expectation::exception::DigestSyntaxException);
+}
+
+TEST_CASE("Should not need the output kept in process results")
+{
+    expectation::OutputSha256Expectation expectation(someOutputDigest);
+
+    CHECK(expectation.NeedsWholeOutput() == false);
+}
+
+}  // omtt
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputSizeExpectation.hpp"
+#include "headers/expectation/validation/OutputSizeCause.hpp"
+#include "headers/ProcessResults.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+expectation::validation::ValidationResult
+validate(expectation::OutputSizeExpectation &expectation, const std::vector<std::string> &chunks)
+{
+    regex::PatternCache patternCache;
+    expectation.Prepare({testFilePath, patternCache});
+
+    for (const auto &chunk : chunks) {
+        expectation.Consume(chunk);
+    }
+
+    return expectation.Validate({0, ""});
+}
+
+}
+
+TEST_CASE("Should be satisfied when output size is the same as expected")
+{
+    expectation::OutputSizeExpectation expectation(expectation::Comparison::EXACTLY, 8);
+
+    CHECK(validate(expectation, {"some", " out"}).isSatisfied() == true);
+}
+
+TEST_CASE("Should not be satisfied when output size is different than expected")
+{
+    expectation::OutputSizeExpectation expectation(expectation::Comparison::EXACTLY, 8);
+
+    const auto result = validate(expectation, {"some", " output"});
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<expectation::validation::OutputSizeCause>(*result.cause);
+    CHECK(cause.fComparison == expectation::Comparison::EXACTLY);
+    CHECK(cause.fExpectedSize == 8);
+    CHECK(cause.fSize == 11);
+}
+
+TEST_CASE("Should be satisfied when output has at least expected size")
+{
+    expectation::OutputSizeExpectation expectation(expectation::Comparison::AT_LEAST, 4);
+
+    CHECK(validate(expectation, {"some", " output"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"so", "me"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"som"}).isSatisfied() == false);
+}
+
+TEST_CASE("Should be satisfied when output has at most expected size")
+{
+    expectation::OutputSizeExpectation expectation(expectation::Comparison::AT_MOST, 4);
+
+    CHECK(validate(expectation, {}).isSatisfied() == true);
+    CHECK(validate(expectation, {"so", "me"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"some", " output"}).isSatisfied() == false);
+}
+
+TEST_CASE("Should not need more output when at least expected size is read")
+{
+    regex::PatternCache patternCache;
+    expectation::OutputSizeExpectation expectation(expectation::Comparison::AT_LEAST, 4);
+    expectation.Prepare({testFilePath, patternCache});
+
+    expectation.Consume("som");
+    CHECK(expectation.NeedsMoreOutput() == true);
+
+    expectation.Consume("e");
+    CHECK(expectation.NeedsMoreOutput() == false);
+}
+
+TEST_CASE("Should need the whole output to count exact size")
+{
+    regex::PatternCache patternCache;
+    expectation::OutputSizeExpectation expectation(expectation::Comparison::EXACTLY, 4);
+    expectation.Prepare({testFilePath, patternCache});
+
+    expectation.Consume("some output");
+
+    CHECK(expectation.NeedsMoreOutput() == true);
+}
+
+TEST_CASE("Should not need the output kept in process results")
+{
+    expectation::OutputSizeExpectation expectation(expectation::Comparison::EXACTLY, 4);
+
+    CHECK(expectation.NeedsWholeOutput() == false);
+}
+
+}  // omtt
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputStartsWithExpectation.hpp"
+#include "headers/expectation/validation/OutputStartsWithCause.hpp"
+#include "headers/ProcessResults.hpp"
+#include "headers/regex/PatternCache.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace omtt
+{
+
+namespace
+{
+
+const Path testFilePath = "test.omtt";
+
+expectation::validation::ValidationResult
+validate(expectation::OutputStartsWithExpectation &expectation, const std::vector<std::string> &chunks)
+{
+    regex::PatternCache patternCache;
+    expectation.Prepare({testFilePath, patternCache});
+
+    for (const auto &chunk : chunks) {
+        expectation.Consume(chunk);
+    }
+
+    return expectation.Validate({0, ""});
+}
+
+}
+
+TEST_CASE("Should be satisfied when output starts with expected text")
+{
+    expectation::OutputStartsWithExpectation expectation("Welcome\n");
+
+    CHECK(validate(expectation, {"Welcome\nrest of the output\n"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"Wel", "come", "\n", "rest"}).isSatisfied() == true);
+    CHECK(validate(expectation, {"Welcome\n"}).isSatisfied() == true);
+}
+
+TEST_CASE("Should be satisfied with empty expected text")
+{
+    expectation::OutputStartsWithExpectation expectation("");
+
+    CHECK(validate(expectation, {}).isSatisfied() == true);
+    CHECK(validate(expectation, {"some output"}).isSatisfied() == true);
+}
+
+TEST_CASE("Should not be satisfied when output starts with other text")
+{
+    expectation::OutputStartsWithExpectation expectation("Welcome\n");
+
+    const auto result = validate(expectation, {"Wel", "l done\n"});
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<expectation::validation::OutputStartsWithCause>(*result.cause);
+    CHECK(cause.fExpectedBeginning == "Welcome\n");
+    CHECK(cause.fDifferencePosition == 3);
+    CHECK(cause.fContextPosition == 3);
+    CHECK(cause.fOutputContext == "Well done\n");
+}
+
+TEST_CASE("Should not be satisfied when output is shorter than expected text")
+{
+    expectation::OutputStartsWithExpectation expectation("Welcome\n");
+
+    const auto result = validate(expectation, {"Welc"});
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<expectation::validation::OutputStartsWithCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == 4);
+    CHECK(cause.fOutputContext == "Welc");
+}
+
+TEST_CASE("Should not need more output when expected text is found")
+{
+    regex::PatternCache patternCache;
+    expectation::OutputStartsWithExpectation expectation("Welcome\n");
+    expectation.Prepare({testFilePath, patternCache});
+
+    expectation.Consume("Welcome");
+    CHECK(expectation.NeedsMoreOutput() == true);
+
+    expectation.Consume("\nrest");
+    CHECK(expectation.NeedsMoreOutput() == false);
+}
+
+TEST_CASE("Should need output after difference until its context is collected")
+{
+    regex::PatternCache patternCache;
+    expectation::OutputStartsWithExpectation expectation("Welcome\n");
+    expectation.Prepare({testFilePath, patternCache});
+
+    expectation.Consume("Wex");
+    CHECK(expectation.NeedsMoreOutput() == true);
+
+    expectation.Consume("123456");
+    CHECK(expectation.NeedsMoreOutput() == false);
+}
+
+}  // omtt
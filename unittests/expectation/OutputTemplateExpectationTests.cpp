@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputTemplateExpectation.hpp"
+#include "headers/expectation/validation/OutputTemplateCause.hpp"
+#include "headers/ProcessResults.hpp"
+
+
+namespace omtt
+{
+
+TEST_CASE("Should be satisfied when output matches the template")
+{
+    expectation::OutputTemplateExpectation expectation("PID: {{int}}\n");
+    const ProcessResults results{0, "PID: 1234\n"};
+
+    auto result = expectation.Validate(results);
+
+    CHECK(result.isSatisfied() == true);
+    CHECK(!result.cause.has_value());
+}
+
+TEST_CASE("Should report template and output positions of the difference")
+{
+    expectation::OutputTemplateExpectation expectation("PID: {{int}}\nok\n");
+    const ProcessResults results{0, "PID: 1234\nfailed\n"};
+
+    auto result = expectation.Validate(results);
+
+    REQUIRE(result.isSatisfied() == false);
+    auto &cause = std::get<expectation::validation::OutputTemplateCause>(*result.cause);
+    CHECK(cause.fDifferencePosition == 10);
+    CHECK(cause.fTemplatePosition == 13);
+    CHECK(cause.fTemplate == "PID: {{int}}\nok\n");
+    CHECK(cause.fOutput == "PID: 1234\nfailed\n");
+}
+
+TEST_CASE("Should return template as content")
+{
+    expectation::OutputTemplateExpectation expectation("{{*}}");
+
+    CHECK(expectation.GetContent() == "{{*}}");
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/OutputWithToleranceExpectation.hpp"
+#include "headers/expectation/exception/ToleranceSyntaxException.hpp"
+#include "headers/expectation/validation/OutputWithToleranceCause.hpp"
+#include "headers/ProcessResults.hpp"
+
+
+namespace omtt::expectation
+{
+
+TEST_CASE("Should be satisfied when numbers are within tolerance")
+{
+    OutputWithToleranceExpectation sut("energy: 1.2345e-3 J\n", "1e-6", "0");
+
+    auto result = sut.Validate({0, "energy: 0.0012349 J\n"});
+
+    CHECK(result.isSatisfied() == true);
+    CHECK(!result.cause.has_value());
+}
+
+TEST_CASE("Should contain numbers out of tolerance")
+{
+    OutputWithToleranceExpectation sut("t = 10.0 s\n", "0.1", "0");
+
+    const ProcessResults processResults{0, "t = 10.5 s\n"};
+    auto result = sut.Validate(processResults);
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<validation::OutputWithToleranceCause>(*result.cause);
+    CHECK(cause.fExpectedPosition == 4);
+    CHECK(cause.fDifferencePosition == 4);
+    CHECK(cause.fExpectedNumber == "10.0");
+    CHECK(cause.fNumber == "10.5");
+}
+
+TEST_CASE("Should contain text difference position without numbers")
+{
+    OutputWithToleranceExpectation sut("t = 10.0 s\n", "0.1", "0");
+
+    auto result = sut.Validate({0, "t = 10 ms\n"});
+
+    REQUIRE(result.cause.has_value());
+    const auto cause = std::get<validation::OutputWithToleranceCause>(*result.cause);
+    CHECK(cause.fExpectedPosition == 9);
+    CHECK(cause.fDifferencePosition == 7);
+    CHECK(cause.fExpectedNumber.empty());
+    CHECK(cause.fNumber.empty());
+}
+
+TEST_CASE("Should keep parsed tolerance")
+{
+    OutputWithToleranceExpectation sut("", "0.5", "1e-3");
+
+    CHECK(sut.GetTolerance().absolute == 0.5);
+    CHECK(sut.GetTolerance().relative == 0.001);
+}
+
+TEST_CASE("Should throw on invalid tolerance")
+{
+    CHECK_THROWS_AS(OutputWithToleranceExpectation("", "abc", "0"), exception::ToleranceSyntaxException);
+    CHECK_THROWS_AS(OutputWithToleranceExpectation("", "0", "-1"), exception::ToleranceSyntaxException);
+    CHECK_THROWS_AS(OutputWithToleranceExpectation("", "1%", "0"), exception::ToleranceSyntaxException);
+}
+
+}  // omtt::expectation
@@ -116,4 +116,45 @@ TEST_CASE("Cause should contain expected text")
     CHECK(cause.fExpectedPartialOutput == expectedPartialOutput);
 }
 
+TEST_CASE("Should not search the output when external search is used")
+{
+    const std::string expectedPartialOutput = "me ou";
+    const ProcessResults sutResults {0, "some output"};
+
+    expectation::PartialOutputExpectation expectation(expectedPartialOutput);
+    expectation.UseExternalSearch();
+
+    CHECK(expectation.Validate(sutResults).isSatisfied() == false);
+
+    expectation.MarkFound();
+
+    CHECK(expectation.Validate(sutResults).isSatisfied() == true);
+}
+
+TEST_CASE("Should search error output when error output stream is given")
+{
+    const std::string expectedPartialErrors = "warning";
+    const ProcessResults sutResults {0, "no warnings here", "error"};
+
+    expectation::PartialOutputExpectation expectation(expectedPartialErrors, expectation::Stream::ERROR_OUTPUT);
+
+    auto validationReults = expectation.Validate(sutResults);
+
+    CHECK(expectation.NeedsWholeOutput() == false);
+    REQUIRE(validationReults.isSatisfied() == false);
+    const auto cause = std::get<expectation::validation::PartialOutputCause>(*validationReults.cause);
+    CHECK(cause.fStream == expectation::Stream::ERROR_OUTPUT);
+}
+
+TEST_CASE("Should be cheap to validate only when searched externally")
+{
+    expectation::PartialOutputExpectation expectation("some text");
+
+    CHECK(expectation.GetCost() == expectation::Expectation::Cost::EXPENSIVE);
+
+    expectation.UseExternalSearch();
+
+    CHECK(expectation.GetCost() == expectation::Expectation::Cost::CHEAP);
+}
+
 }
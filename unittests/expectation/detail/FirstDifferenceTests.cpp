@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/detail/FirstDifference.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+// compares the texts byte by byte
+Difference
+expected_difference(const std::string &expected, const std::string &output)
+{
+    Difference difference{0, 1, 1};
+
+    const auto length = std::min(expected.size(), output.size());
+    while (difference.position < length && expected[difference.position] == output[difference.position]) {
+        if (output[difference.position] == '\n') {
+            ++difference.line;
+            difference.column = 1;
+        }
+        else {
+            ++difference.column;
+        }
+        ++difference.position;
+    }
+
+    return difference;
+}
+
+}
+
+TEST_CASE("Should find no difference in the same texts")
+{
+    CHECK(!find_first_difference("", "").has_value());
+    CHECK(!find_first_difference("abc\ndef\n", "abc\ndef\n").has_value());
+    CHECK(!find_first_difference("0123456789abcdef0123", "0123456789abcdef0123").has_value());
+}
+
+TEST_CASE("Should find difference inside the first eight bytes")
+{
+    const auto difference = find_first_difference("abcdefgh", "abcXefgh");
+
+    REQUIRE(difference.has_value());
+    CHECK(difference->position == 3);
+    CHECK(difference->line == 1);
+    CHECK(difference->column == 4);
+}
+
+TEST_CASE("Should find difference after the first eight bytes")
+{
+    const auto difference = find_first_difference("0123456789abcdefXYZ", "0123456789abcdefXYz");
+
+    REQUIRE(difference.has_value());
+    CHECK(difference->position == 18);
+    CHECK(difference->line == 1);
+    CHECK(difference->column == 19);
+}
+
+TEST_CASE("Should find difference at the end of shorter expected text")
+{
+    const auto difference = find_first_difference("0123456789", "0123456789abcdef");
+
+    REQUIRE(difference.has_value());
+    CHECK(difference->position == 10);
+    CHECK(difference->column == 11);
+}
+
+TEST_CASE("Should find difference at the end of shorter output")
+{
+    const auto difference = find_first_difference("0123456789abcdef", "0123456789");
+
+    REQUIRE(difference.has_value());
+    CHECK(difference->position == 10);
+    CHECK(difference->column == 11);
+}
+
+TEST_CASE("Should find difference in the first byte of empty output")
+{
+    const auto difference = find_first_difference("a", "");
+
+    REQUIRE(difference.has_value());
+    CHECK(difference->position == 0);
+    CHECK(difference->line == 1);
+    CHECK(difference->column == 1);
+}
+
+TEST_CASE("Should count lines and columns before the difference")
+{
+    const auto difference = find_first_difference("first\nsecond\n\nfourth line\n", "first\nsecond\n\nfourth_line\n");
+
+    REQUIRE(difference.has_value());
+    CHECK(difference->position == 20);
+    CHECK(difference->line == 4);
+    CHECK(difference->column == 7);
+}
+
+TEST_CASE("Should point to the first column after the new line")
+{
+    const auto difference = find_first_difference("\n\n\n\n\n\n\n\n\na", "\n\n\n\n\n\n\n\n\nb");
+
+    REQUIRE(difference.has_value());
+    CHECK(difference->position == 9);
+    CHECK(difference->line == 10);
+    CHECK(difference->column == 1);
+}
+
+TEST_CASE("Should find the same difference as byte by byte comparison")
+{
+    std::mt19937 random(20240615);
+    std::uniform_int_distribution<int> length(0, 70);
+    std::uniform_int_distribution<int> byte(0, 3);
+    const std::string alphabet = "a\n\x8a\x0b";
+
+    for (int i = 0; i < 2000; ++i) {
+        std::string expected;
+        const int expectedLength = length(random);
+        for (int j = 0; j < expectedLength; ++j) {
+            expected += alphabet[byte(random)];
+        }
+
+        std::string output = expected.substr(0, length(random));
+        const int outputLength = length(random);
+        while (static_cast<int>(output.size()) < outputLength) {
+            output += alphabet[byte(random)];
+        }
+
+        const auto difference = find_first_difference(expected, output);
+
+        if (expected == output) {
+            CHECK(!difference.has_value());
+            continue;
+        }
+
+        const auto byteByByte = expected_difference(expected, output);
+        REQUIRE(difference.has_value());
+        CHECK(difference->position == byteByByte.position);
+        CHECK(difference->line == byteByByte.line);
+        CHECK(difference->column == byteByByte.column);
+    }
+}
+
+TEST_CASE("Should count the new lines in the words and in the tail")
+{
+    CHECK(count_new_lines("") == 0);
+    CHECK(count_new_lines("\n") == 1);
+    CHECK(count_new_lines("abc\ndef\n\n\nghijk\nl\n") == 6);
+    CHECK(count_new_lines("\x8a\x0a\xff\x0b\x09\x0a\x80\x00") == 2);
+}
+
+}  // omtt::expectation::detail
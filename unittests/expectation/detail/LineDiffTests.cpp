@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/detail/LineDiff.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+constexpr std::size_t NO_LIMIT = 1000;
+
+std::string
+numbered_lines(const std::size_t count)
+{
+    std::string text;
+    for (std::size_t i = 0; i < count; ++i) {
+        text += std::to_string(i) + "\n";
+    }
+    return text;
+}
+
+std::size_t
+changed_lines(const std::vector<DiffHunk> &hunks)
+{
+    std::size_t changed = 0;
+    for (const auto &hunk : hunks) {
+        for (const auto &line : hunk.lines) {
+            changed += (line.kind != DiffLine::Kind::COMMON) ? 1 : 0;
+        }
+    }
+    return changed;
+}
+
+// the hunks give the whole texts back, when there is no limit of context lines
+void
+check_texts_from_hunks(const std::vector<DiffHunk> &hunks,
+                       const std::string &expected,
+                       const std::string &output)
+{
+    std::string expectedFromHunks;
+    std::string outputFromHunks;
+
+    for (const auto &hunk : hunks) {
+        for (const auto &line : hunk.lines) {
+            if (line.kind != DiffLine::Kind::INSERTED) {
+                expectedFromHunks += line.text;
+            }
+            if (line.kind != DiffLine::Kind::DELETED) {
+                outputFromHunks += line.text;
+            }
+        }
+    }
+
+    CHECK(expectedFromHunks == expected);
+    CHECK(outputFromHunks == output);
+}
+
+std::size_t
+longest_common_subsequence(const std::string &first, const std::string &second)
+{
+    std::vector<std::vector<std::size_t>> lengths(first.size() + 1, std::vector<std::size_t>(second.size() + 1, 0));
+
+    for (std::size_t i = 1; i <= first.size(); ++i) {
+        for (std::size_t j = 1; j <= second.size(); ++j) {
+            lengths[i][j] = (first[i - 1] == second[j - 1])
+                            ? lengths[i - 1][j - 1] + 1
+                            : std::max(lengths[i - 1][j], lengths[i][j - 1]);
+        }
+    }
+
+    return lengths[first.size()][second.size()];
+}
+
+std::string
+as_lines(const std::string &letters)
+{
+    std::string text;
+    for (const char letter : letters) {
+        text += letter;
+        text += '\n';
+    }
+    return text;
+}
+
+}
+
+TEST_CASE("Should find no hunks in the same texts")
+{
+    const auto hunks = diff_lines("a\nb\n", "a\nb\n", NO_LIMIT);
+
+    REQUIRE(hunks.has_value());
+    CHECK(hunks->empty());
+}
+
+TEST_CASE("Should find inserted line with context")
+{
+    const std::string expected = numbered_lines(10);
+    std::string output = expected;
+    output.insert(output.find("5\n"), "new\n");
+
+    const auto hunks = diff_lines(expected, output, NO_LIMIT);
+
+    REQUIRE(hunks.has_value());
+    REQUIRE(hunks->size() == 1);
+    const DiffHunk &hunk = hunks->at(0);
+    CHECK(hunk.expectedBegin == 2);
+    CHECK(hunk.expectedCount == 6);
+    CHECK(hunk.outputBegin == 2);
+    CHECK(hunk.outputCount == 7);
+    REQUIRE(hunk.lines.size() == 7);
+    CHECK(hunk.lines[2].text == "4\n");
+    CHECK(hunk.lines[3].kind == DiffLine::Kind::INSERTED);
+    CHECK(hunk.lines[3].text == "new\n");
+    CHECK(hunk.lines[4].text == "5\n");
+}
+
+TEST_CASE("Should split changes far from each other into hunks")
+{
+    const std::string expected = numbered_lines(20);
+    std::string output = expected;
+    output.replace(output.find("2\n"), 2, "two\n");
+    output.replace(output.find("17\n"), 3, "");
+
+    const auto hunks = diff_lines(expected, output, NO_LIMIT);
+
+    REQUIRE(hunks.has_value());
+    REQUIRE(hunks->size() == 2);
+    CHECK(hunks->at(0).expectedBegin == 0);
+    CHECK(hunks->at(0).expectedCount == 6);
+    CHECK(hunks->at(0).outputCount == 6);
+    CHECK(hunks->at(1).expectedBegin == 14);
+    CHECK(hunks->at(1).expectedCount == 6);
+    CHECK(hunks->at(1).outputCount == 5);
+}
+
+TEST_CASE("Should keep changes close to each other in one hunk")
+{
+    const std::string expected = numbered_lines(20);
+    std::string output = expected;
+    output.replace(output.find("5\n"), 2, "five\n");
+    output.replace(output.find("11\n"), 3, "eleven\n");
+
+    const auto hunks = diff_lines(expected, output, NO_LIMIT);
+
+    REQUIRE(hunks.has_value());
+    REQUIRE(hunks->size() == 1);
+    CHECK(hunks->at(0).expectedBegin == 2);
+    CHECK(hunks->at(0).expectedCount == 13);
+}
+
+TEST_CASE("Should treat missing new line at the end as a different line")
+{
+    const auto hunks = diff_lines("a\nb\n", "a\nb", NO_LIMIT);
+
+    REQUIRE(hunks.has_value());
+    REQUIRE(hunks->size() == 1);
+    REQUIRE(hunks->at(0).lines.size() == 3);
+    CHECK(hunks->at(0).lines[1].kind == DiffLine::Kind::DELETED);
+    CHECK(hunks->at(0).lines[1].text == "b\n");
+    CHECK(hunks->at(0).lines[2].kind == DiffLine::Kind::INSERTED);
+    CHECK(hunks->at(0).lines[2].text == "b");
+}
+
+TEST_CASE("Should give nothing when texts are too different")
+{
+    CHECK(diff_lines(numbered_lines(10), "", 9).has_value() == false);
+    CHECK(diff_lines(numbered_lines(10), "", 10).has_value() == true);
+    CHECK(diff_lines("a\nb\nc\n", "x\ny\nz\n", 5).has_value() == false);
+    CHECK(diff_lines("a\nb\nc\n", "x\ny\nz\n", 6).has_value() == true);
+}
+
+TEST_CASE("Should find the shortest edit script")
+{
+    std::mt19937 random(20240601);
+    std::uniform_int_distribution<int> length(0, 12);
+    std::uniform_int_distribution<int> letter('a', 'd');
+
+    for (int i = 0; i < 2000; ++i) {
+        std::string first(length(random), ' ');
+        std::string second(length(random), ' ');
+        for (auto &c : first) {
+            c = static_cast<char>(letter(random));
+        }
+        for (auto &c : second) {
+            c = static_cast<char>(letter(random));
+        }
+
+        const std::string expected = as_lines(first);
+        const std::string output = as_lines(second);
+        const auto hunks = diff_lines(expected, output, NO_LIMIT, NO_LIMIT);
+
+        REQUIRE(hunks.has_value());
+        CHECK(changed_lines(*hunks) == first.size() + second.size() - 2 * longest_common_subsequence(first, second));
+        if (!hunks->empty()) {
+            check_texts_from_hunks(*hunks, expected, output);
+        }
+    }
+}
+
+}  // omtt::expectation::detail
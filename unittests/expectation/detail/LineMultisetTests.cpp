@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/detail/LineMultiset.hpp"
+
+#include <string>
+
+
+namespace omtt::expectation::detail
+{
+
+TEST_CASE("Should count the same lines together")
+{
+    LineMultiset sut;
+
+    sut.Add("first");
+    sut.Add("second");
+    sut.Add("first");
+
+    REQUIRE(sut.GetEntries().size() == 2);
+    CHECK(sut.GetEntries()[0].line == "first");
+    CHECK(sut.GetEntries()[0].count == 2);
+    CHECK(sut.GetEntries()[1].line == "second");
+    CHECK(sut.GetEntries()[1].count == 1);
+}
+
+TEST_CASE("Should have negative count of removed lines which were not added")
+{
+    LineMultiset sut;
+
+    sut.Add("first");
+    sut.Remove("first");
+    sut.Remove("extra");
+    sut.Remove("extra");
+
+    REQUIRE(sut.GetEntries().size() == 2);
+    CHECK(sut.GetEntries()[0].count == 0);
+    CHECK(sut.GetEntries()[1].line == "extra");
+    CHECK(sut.GetEntries()[1].count == -2);
+}
+
+TEST_CASE("Should copy removed lines which were not added")
+{
+    LineMultiset sut;
+
+    {
+        std::string line = "temporary line";
+        sut.Remove(line);
+        line = "something else";
+    }
+
+    CHECK(sut.GetEntries()[0].line == "temporary line");
+}
+
+TEST_CASE("Should keep counts when the table grows")
+{
+    LineMultiset sut;
+    std::vector<std::string> lines;
+    for (int i = 0; i < 1000; ++i) {
+        lines.push_back("line " + std::to_string(i));
+    }
+
+    for (const auto &line : lines) {
+        sut.Add(line);
+    }
+    for (const auto &line : lines) {
+        sut.Remove(line);
+    }
+
+    CHECK(sut.GetEntries().size() == 1000);
+    for (const auto &entry : sut.GetEntries()) {
+        CHECK(entry.count == 0);
+    }
+}
+
+}
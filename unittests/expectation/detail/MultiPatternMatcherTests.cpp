@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/detail/MultiPatternMatcher.hpp"
+
+
+namespace omtt::expectation::detail
+{
+
+TEST_CASE("Should find all patterns in the text")
+{
+    MultiPatternMatcher sut({"he", "she", "his", "hers"});
+
+    CHECK(sut.Feed("ushers") == true);
+
+    CHECK(sut.IsFound(0) == true);
+    CHECK(sut.IsFound(1) == true);
+    CHECK(sut.IsFound(2) == false);
+    CHECK(sut.IsFound(3) == true);
+    CHECK(sut.AreAllFound() == false);
+}
+
+TEST_CASE("Should find pattern which is a suffix of other pattern")
+{
+    MultiPatternMatcher sut({"abcd", "bc"});
+
+    sut.Feed("xabcx");
+
+    CHECK(sut.IsFound(0) == false);
+    CHECK(sut.IsFound(1) == true);
+}
+
+TEST_CASE("Should find pattern split between chunks")
+{
+    MultiPatternMatcher sut({"some output"});
+
+    CHECK(sut.Feed("text with some ou") == false);
+    CHECK(sut.Feed("tput") == true);
+
+    CHECK(sut.IsFound(0) == true);
+    CHECK(sut.AreAllFound() == true);
+}
+
+TEST_CASE("Should not find pattern with different letters case")
+{
+    MultiPatternMatcher sut({"Output"});
+
+    sut.Feed("some output");
+
+    CHECK(sut.IsFound(0) == false);
+}
+
+TEST_CASE("Should find the same pattern given many times")
+{
+    MultiPatternMatcher sut({"abc", "x", "abc"});
+
+    sut.Feed("abc");
+
+    CHECK(sut.IsFound(0) == true);
+    CHECK(sut.IsFound(1) == false);
+    CHECK(sut.IsFound(2) == true);
+}
+
+TEST_CASE("Should find empty pattern in empty text")
+{
+    MultiPatternMatcher sut({""});
+
+    CHECK(sut.IsFound(0) == true);
+    CHECK(sut.AreAllFound() == true);
+}
+
+TEST_CASE("Should find patterns with bytes not used in other patterns")
+{
+    MultiPatternMatcher sut({"a\nb", "\xff\x01"});
+
+    sut.Feed(std::string_view("xx\xff\x01 a\nb", 9));
+
+    CHECK(sut.AreAllFound() == true);
+}
+
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/detail/OutputTemplate.hpp"
+#include "headers/expectation/exception/TemplateSyntaxException.hpp"
+
+
+namespace omtt::expectation::detail
+{
+
+TEST_CASE("Should match output equal to template without placeholders")
+{
+    OutputTemplate sut("some output\n");
+
+    CHECK_FALSE(sut.Match("some output\n").has_value());
+}
+
+TEST_CASE("Should not match output longer than template without placeholders")
+{
+    OutputTemplate sut("some output\n");
+
+    const auto mismatch = sut.Match("some output\nmore\n");
+
+    REQUIRE(mismatch.has_value());
+    CHECK(mismatch->outputPosition == 12);
+    CHECK(mismatch->templatePosition == 12);
+}
+
+TEST_CASE("Should match any text in place of the star placeholder")
+{
+    OutputTemplate sut("Started at {{*}}\nDone\n");
+
+    CHECK_FALSE(sut.Match("Started at 12:30:01\nDone\n").has_value());
+    CHECK_FALSE(sut.Match("Started at \nDone\n").has_value());
+    CHECK_FALSE(sut.Match("Started at 12\nDone\nDone\n").has_value());
+    CHECK(sut.Match("Started at 12\nDone\nDone\nx").has_value());
+}
+
+TEST_CASE("Should match text around many star placeholders")
+{
+    OutputTemplate sut("{{*}}a{{*}}{{*}}b{{*}}");
+
+    CHECK_FALSE(sut.Match("ab").has_value());
+    CHECK_FALSE(sut.Match("xxaxxbxx").has_value());
+    CHECK(sut.Match("xxbxxaxx").has_value());
+}
+
+TEST_CASE("Should find the block after star placeholder at its next position")
+{
+    OutputTemplate sut("{{*}}a{{int}}!");
+
+    CHECK_FALSE(sut.Match("ax a1 a12!").has_value());
+}
+
+TEST_CASE("Should match integers")
+{
+    OutputTemplate sut("PID: {{int}}, result: {{int}}\n");
+
+    CHECK_FALSE(sut.Match("PID: 1234, result: -5\n").has_value());
+    CHECK(sut.Match("PID: , result: 5\n").has_value());
+    CHECK(sut.Match("PID: 12a, result: 5\n").has_value());
+}
+
+TEST_CASE("Should match hexadecimal numbers with and without prefix")
+{
+    OutputTemplate sut("address {{hex}} {{hex}}\n");
+
+    CHECK_FALSE(sut.Match("address 0x7ffdA0 deadbeef\n").has_value());
+    CHECK(sut.Match("address 0x 1\n").has_value());
+}
+
+TEST_CASE("Should take the whole run of digits")
+{
+    OutputTemplate sut("{{int}}5");
+
+    CHECK(sut.Match("1235").has_value());
+}
+
+TEST_CASE("Should report the furthest difference")
+{
+    OutputTemplate sut("PID: {{int}}\nStatus: ok\n");
+
+    const auto mismatch = sut.Match("PID: 42\nStatus: failed\n");
+
+    REQUIRE(mismatch.has_value());
+    CHECK(mismatch->outputPosition == 16);
+    CHECK(mismatch->templatePosition == 21);
+}
+
+TEST_CASE("Should report the placeholder which doesn't match")
+{
+    OutputTemplate sut("PID: {{int}}\n");
+
+    const auto mismatch = sut.Match("PID: none\n");
+
+    REQUIRE(mismatch.has_value());
+    CHECK(mismatch->outputPosition == 5);
+    CHECK(mismatch->templatePosition == 5);
+}
+
+TEST_CASE("Should report position where block after star placeholder was searched when it is not found")
+{
+    OutputTemplate sut("Start\n{{*}}Done\n");
+
+    const auto mismatch = sut.Match("Start\nsome output\n");
+
+    REQUIRE(mismatch.has_value());
+    CHECK(mismatch->outputPosition == 6);
+    CHECK(mismatch->templatePosition == 11);
+}
+
+TEST_CASE("Should match texts in braces which are not placeholders literally")
+{
+    OutputTemplate sut("{{ x }} {{}} {{Int}} {{int");
+
+    CHECK_FALSE(sut.Match("{{ x }} {{}} {{Int}} {{int").has_value());
+}
+
+TEST_CASE("Should throw exception on unknown placeholder")
+{
+    CHECK_THROWS_AS(OutputTemplate("value: {{number}}"), exception::TemplateSyntaxException);
+}
+
+}
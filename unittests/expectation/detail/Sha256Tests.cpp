@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/detail/Sha256.hpp"
+
+#include <string>
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+std::string
+sha256(const std::string &text)
+{
+    Sha256 sha256;
+    sha256.Update(text);
+    return to_hex(sha256.GetDigest());
+}
+
+}
+
+TEST_CASE("Should compute digests of FIPS 180-4 examples")
+{
+    CHECK(sha256("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    CHECK(sha256("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    CHECK(sha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")
+          == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST_CASE("Should compute the same digest for text given in chunks of any size")
+{
+    const std::string text(1000000, 'a');
+
+    for (const std::size_t chunkSize : {1, 7, 63, 64, 65, 4096}) {
+        Sha256 sha256;
+        for (std::size_t i = 0; i < text.size(); i += chunkSize) {
+            sha256.Update(std::string_view(text).substr(i, chunkSize));
+        }
+
+        CHECK(to_hex(sha256.GetDigest()) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    }
+}
+
+TEST_CASE("Should continue hashing after the digest is given")
+{
+    Sha256 sha256;
+    sha256.Update("a");
+    (void) sha256.GetDigest();
+    sha256.Update("bc");
+
+    CHECK(to_hex(sha256.GetDigest()) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_CASE("Should start from the beginning after reset")
+{
+    Sha256 sha256;
+    sha256.Update("some text");
+    sha256.Reset();
+    sha256.Update("abc");
+
+    CHECK(to_hex(sha256.GetDigest()) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_CASE("Should parse digest in upper and lower case")
+{
+    const auto digest = parse_digest("BA7816BF8F01CFEA414140DE5DAE2223b00361a396177a9cb410ff61f20015ad");
+
+    REQUIRE(digest.has_value());
+    CHECK(to_hex(*digest) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_CASE("Should not parse text other than 64 hex digits")
+{
+    CHECK(!parse_digest("").has_value());
+    CHECK(!parse_digest("ba7816bf").has_value());
+    CHECK(!parse_digest("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad00").has_value());
+    CHECK(!parse_digest("xa7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad").has_value());
+}
+
+}  // omtt::expectation::detail
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/expectation/detail/TolerantComparison.hpp"
+
+
+namespace omtt::expectation::detail
+{
+
+namespace
+{
+
+const Tolerance exact{0, 0};
+
+}
+
+
+TEST_GROUP("Numbers")
+{
+
+UNIT_TEST("Should find size of decimal numbers")
+{
+    CHECK(number_size("12 apples") == 2);
+    CHECK(number_size("-1.5e-3,") == 7);
+    CHECK(number_size(".5") == 2);
+    CHECK(number_size("2.") == 1);
+    CHECK(number_size("3e") == 1);
+    CHECK(number_size("4E+2") == 4);
+}
+
+UNIT_TEST("Should not find numbers in other texts")
+{
+    CHECK(number_size("") == 0);
+    CHECK(number_size("-") == 0);
+    CHECK(number_size("-.") == 0);
+    CHECK(number_size("+1") == 0);
+    CHECK(number_size("e5") == 0);
+}
+
+UNIT_TEST("Should parse whole text only")
+{
+    CHECK(parse_number("2.5") == 2.5);
+    CHECK(parse_number("-1e2") == -100.0);
+    CHECK(!parse_number("2.5x").has_value());
+    CHECK(!parse_number("").has_value());
+    CHECK(!parse_number("1e999").has_value());
+}
+
+UNIT_TEST("Should accept absolute or relative difference")
+{
+    CHECK(is_within_tolerance(1.0, 1.05, {0.1, 0}));
+    CHECK(is_within_tolerance(1000.0, 1001.0, {0, 0.001}));
+    CHECK_FALSE(is_within_tolerance(1.0, 1.2, {0.1, 0.1}));
+}
+
+}
+
+TEST_GROUP("Comparison")
+{
+
+UNIT_TEST("Should accept the same text")
+{
+    CHECK(!compare_with_tolerance("a 1 b\n", "a 1 b\n", exact).has_value());
+}
+
+UNIT_TEST("Should accept numbers written in other notation")
+{
+    CHECK(!compare_with_tolerance("x = 2500, y = 0.5\n", "x = 2.5e3, y = .50\n", exact).has_value());
+}
+
+UNIT_TEST("Should accept numbers within tolerance")
+{
+    CHECK(!compare_with_tolerance("pi: 3.14159\n", "pi: 3.14160\n", {0.0001, 0}).has_value());
+    CHECK(!compare_with_tolerance("c: 299792458\n", "c: 299792000\n", {0, 0.00001}).has_value());
+}
+
+UNIT_TEST("Should report number out of tolerance")
+{
+    const auto mismatch = compare_with_tolerance("a = 1, b = 2.0\n", "a = 1, b = 2.25\n", {0.1, 0});
+
+    REQUIRE(mismatch.has_value());
+    CHECK(mismatch->expectedPosition == 11);
+    CHECK(mismatch->outputPosition == 11);
+    CHECK(mismatch->expectedNumberSize == 3);
+    CHECK(mismatch->outputNumberSize == 4);
+}
+
+UNIT_TEST("Should report text difference after numbers of different sizes")
+{
+    const auto mismatch = compare_with_tolerance("1.0 apples\n", "1 pears\n", exact);
+
+    REQUIRE(mismatch.has_value());
+    CHECK(mismatch->expectedPosition == 4);
+    CHECK(mismatch->outputPosition == 2);
+    CHECK(mismatch->expectedNumberSize == 0);
+    CHECK(mismatch->outputNumberSize == 0);
+}
+
+UNIT_TEST("Should compare signs")
+{
+    const auto mismatch = compare_with_tolerance("-1\n", "1\n", {1, 0});
+
+    REQUIRE(mismatch.has_value());
+    CHECK(mismatch->expectedNumberSize == 2);
+    CHECK(mismatch->outputNumberSize == 1);
+}
+
+UNIT_TEST("Should not compare digits inside words with tolerance")
+{
+    CHECK(compare_with_tolerance("x64\n", "x65\n", {1, 0}).has_value());
+    CHECK(compare_with_tolerance("v1.2\n", "v1.3\n", {1, 0}).has_value());
+}
+
+UNIT_TEST("Should report output shorter or longer than expected")
+{
+    const auto shorter = compare_with_tolerance("1 2\n", "1 2", exact);
+    REQUIRE(shorter.has_value());
+    CHECK(shorter->expectedPosition == 3);
+    CHECK(shorter->outputPosition == 3);
+
+    const auto longer = compare_with_tolerance("1 2", "1 2 3", exact);
+    REQUIRE(longer.has_value());
+    CHECK(longer->expectedPosition == 3);
+    CHECK(longer->outputPosition == 3);
+}
+
+UNIT_TEST("Should compare numbers out of double range as text")
+{
+    CHECK(!compare_with_tolerance("1e999\n", "1e999\n", exact).has_value());
+    CHECK(compare_with_tolerance("1e999\n", "1.0e999\n", exact).has_value());
+}
+
+}
+
+}  // omtt::expectation::detail
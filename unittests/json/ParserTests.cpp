@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/json/Parser.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace omtt::json
+{
+
+namespace
+{
+
+class EventsRecorder : public Handler
+{
+public:
+    void OnNull() override { events += "null "; }
+    void OnBoolean(const bool value) override { events += value ? "true " : "false "; }
+    void OnNumber(const std::string_view &number) override { events += "n:" + std::string(number) + " "; }
+    void OnString(const std::string_view &value) override { events += "s:" + std::string(value) + " "; }
+    void OnKey(const std::string_view &key) override { events += "k:" + std::string(key) + " "; }
+    void OnObjectBegin() override { events += "{ "; }
+    void OnObjectEnd() override { events += "} "; }
+    void OnArrayBegin() override { events += "[ "; }
+    void OnArrayEnd() override { events += "] "; }
+
+    std::string events;
+};
+
+std::string
+parse_events(const std::vector<std::string> &chunks)
+{
+    EventsRecorder recorder;
+    Parser sut(recorder);
+
+    for (const auto &chunk : chunks) {
+        if (!sut.Feed(chunk)) {
+            return sut.GetError();
+        }
+    }
+
+    if (!sut.Finish()) {
+        return sut.GetError();
+    }
+
+    return recorder.events;
+}
+
+}
+
+
+TEST_CASE("Should report values in document order")
+{
+    CHECK(parse_events({R"({"a": [1, -2.5e3, true, false, null], "b": {}, "c": "text"})"})
+          == "{ k:a [ n:1 n:-2.5e3 true false null ] k:b { } k:c s:text } ");
+}
+
+TEST_CASE("Should report top level scalars")
+{
+    CHECK(parse_events({" 12 "}) == "n:12 ");
+    CHECK(parse_events({"12"}) == "n:12 ");
+    CHECK(parse_events({"\"text\"\n"}) == "s:text ");
+    CHECK(parse_events({"null"}) == "null ");
+}
+
+TEST_CASE("Should parse values split between chunks")
+{
+    CHECK(parse_events({"{\"ke", "y\": [12", "34, tr", "ue, \"va\\", "u00", "41lue\"]", "}"})
+          == "{ k:key [ n:1234 true s:vaAlue ] } ");
+}
+
+TEST_CASE("Should unescape strings")
+{
+    CHECK(parse_events({R"("\"\\\/\b\f\n\r\t")"}) == "s:\"\\/\b\f\n\r\t ");
+    CHECK(parse_events({R"("\u0041\u00e9\u20ac")"}) == "s:A\xc3\xa9\xe2\x82\xac ");
+    CHECK(parse_events({R"("\ud83d\ude00")"}) == "s:\xf0\x9f\x98\x80 ");
+}
+
+TEST_GROUP("Syntax errors")
+{
+
+UNIT_TEST("Should report unexpected character with its position")
+{
+    CHECK(parse_events({"[1, 2,]"}) == "unexpected character ']' at byte 6");
+    CHECK(parse_events({"{\"a\" 1}"}) == "expected ':', got character '1' at byte 5");
+    CHECK(parse_events({"{1: 2}"}) == "expected member name, got character '1' at byte 1");
+}
+
+UNIT_TEST("Should count position over chunks")
+{
+    CHECK(parse_events({"[1, ", "2", ",]"}) == "unexpected character ']' at byte 6");
+}
+
+UNIT_TEST("Should report invalid numbers")
+{
+    CHECK(parse_events({"[1.x]"}) == "invalid number at byte 3");
+    CHECK(parse_events({"[1e]"}) == "invalid number at byte 3");
+    CHECK(parse_events({"01"}) == "unexpected character '1' at byte 1");
+    CHECK(parse_events({"1."}).find("unexpected end of text") == 0);
+    CHECK(parse_events({"-"}).find("unexpected end of text") == 0);
+    CHECK(parse_events({"1e+"}).find("unexpected end of text") == 0);
+    CHECK(parse_events({"[.5]"}).find("unexpected character '.'") == 0);
+}
+
+UNIT_TEST("Should report invalid literals")
+{
+    CHECK(parse_events({"[tru]"}) == "invalid literal, expected 'true' at byte 4");
+}
+
+UNIT_TEST("Should report unescaped control characters in strings")
+{
+    CHECK(parse_events({"\"a\nb\""}) == "unescaped byte 0x0a in string at byte 2");
+}
+
+UNIT_TEST("Should report text after the value")
+{
+    CHECK(parse_events({"{} {}"}) == "unexpected character '{' at byte 3");
+}
+
+UNIT_TEST("Should report not finished document")
+{
+    CHECK(parse_events({"{\"a\": [1"}) == "unexpected end of text at byte 8");
+    CHECK(parse_events({""}) == "unexpected end of text at byte 0");
+}
+
+}
+
+}  // omtt::json
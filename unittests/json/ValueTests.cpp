@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/json/Value.hpp"
+#include "headers/json/exception/SyntaxException.hpp"
+
+
+namespace omtt::json
+{
+
+TEST_CASE("Should build object with members in written order")
+{
+    const Value value = parse(R"({"b": 1, "a": [true, null], "c": "text"})");
+
+    REQUIRE(value.kind == Value::Kind::OBJECT);
+    REQUIRE(value.keys.size() == 3);
+    CHECK(value.keys[0] == "b");
+    CHECK(value.keys[1] == "a");
+    CHECK(value.keys[2] == "c");
+    CHECK(value.items[0].kind == Value::Kind::NUMBER);
+    CHECK(value.items[1].kind == Value::Kind::ARRAY);
+    CHECK(value.items[1].items.size() == 2);
+    CHECK(value.items[2].text == "text");
+}
+
+TEST_CASE("Should find members by key")
+{
+    const Value value = parse(R"({"b": 1, "a": 2, "c": 3})");
+
+    CHECK(value.FindMember("a") == 1);
+    CHECK(value.FindMember("b") == 0);
+    CHECK(value.FindMember("c") == 2);
+    CHECK(value.FindMember("d") == Value::NOT_FOUND);
+}
+
+TEST_CASE("Should throw on invalid JSON")
+{
+    CHECK_THROWS_AS(parse("{\"a\": }"), exception::SyntaxException);
+    CHECK_THROWS_AS(parse(""), exception::SyntaxException);
+}
+
+TEST_CASE("Should throw on duplicated members")
+{
+    CHECK_THROWS_AS(parse(R"({"a": 1, "a": 2})"), exception::SyntaxException);
+}
+
+TEST_GROUP("Canonical numbers")
+{
+
+UNIT_TEST("Should be the same for equal numbers")
+{
+    CHECK(canonical_number("1") == canonical_number("1.0"));
+    CHECK(canonical_number("1") == canonical_number("10e-1"));
+    CHECK(canonical_number("1") == canonical_number("0.1E1"));
+    CHECK(canonical_number("-250") == canonical_number("-2.5e+2"));
+    CHECK(canonical_number("0") == canonical_number("-0.0e5"));
+}
+
+UNIT_TEST("Should differ for different numbers")
+{
+    CHECK(canonical_number("1") != canonical_number("-1"));
+    CHECK(canonical_number("1") != canonical_number("10"));
+    CHECK(canonical_number("0.1") != canonical_number("0.01"));
+    CHECK(canonical_number("12345678901234567890") != canonical_number("12345678901234567891"));
+}
+
+UNIT_TEST("Should write significant digits and exponent")
+{
+    CHECK(canonical_number("0") == "0");
+    CHECK(canonical_number("120") == "12e3");
+    CHECK(canonical_number("-0.005") == "-5e-2");
+}
+
+}
+
+TEST_GROUP("Descriptions")
+{
+
+UNIT_TEST("Should describe scalars as JSON")
+{
+    CHECK(describe(parse("null")) == "null");
+    CHECK(describe(parse("true")) == "true");
+    CHECK(describe(parse("1.50")) == "1.50");
+    CHECK(describe(parse(R"("a\"b\n")")) == R"("a\"b\n")");
+}
+
+UNIT_TEST("Should describe containers by kind")
+{
+    CHECK(describe(parse("[1]")) == "array");
+    CHECK(describe(parse("{}")) == "object");
+}
+
+UNIT_TEST("Should shorten long strings")
+{
+    CHECK(describe_string(std::string(50, 'a')) == "\"" + std::string(40, 'a') + "...\"");
+}
+
+}
+
+}  // omtt::json
@@ -210,6 +210,48 @@ TEST_CASE("Should return keyword token with 'FAILURE' value")
     helper::test_one_token_with_buffer(buffer, expectedToken);
 }
 
+TEST_CASE("Should return 'NORMALIZE' keywords with filter names")
+{
+    const std::string buffer = "RUN\nNORMALIZE TRIM\nNORMALIZE SQUEEZE\nNORMALIZE MASK INT\nNORMALIZE MASK HEX\nWITH";
+    Lexer sut(buffer);
+
+    const std::vector<Token> expectedTokens{{TokenKind::KEYWORD, "RUN"},
+                                            {TokenKind::KEYWORD, "NORMALIZE"},
+                                            {TokenKind::KEYWORD, "TRIM"},
+                                            {TokenKind::KEYWORD, "NORMALIZE"},
+                                            {TokenKind::KEYWORD, "SQUEEZE"},
+                                            {TokenKind::KEYWORD, "NORMALIZE"},
+                                            {TokenKind::KEYWORD, "MASK"},
+                                            {TokenKind::KEYWORD, "INT"},
+                                            {TokenKind::KEYWORD, "NORMALIZE"},
+                                            {TokenKind::KEYWORD, "MASK"},
+                                            {TokenKind::KEYWORD, "HEX"},
+                                            {TokenKind::KEYWORD, "WITH"}};
+
+    for (const auto &expectedToken : expectedTokens) {
+        helper::check_token_equality(sut.FindNextToken(), expectedToken);
+    }
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'ERROR OUTPUT' keywords should return lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "EXPECT IN ERROR OUTPUT\nerror: bad input\nEXPECT";
+    Lexer sut(buffer);
+
+    const std::vector<Token> expectedTokens{{TokenKind::KEYWORD, "EXPECT"},
+                                            {TokenKind::KEYWORD, "IN"},
+                                            {TokenKind::KEYWORD, "ERROR"},
+                                            {TokenKind::KEYWORD, "OUTPUT"},
+                                            {TokenKind::TEXT, "error: bad input"},
+                                            {TokenKind::KEYWORD, "EXPECT"}};
+
+    for (const auto &expectedToken : expectedTokens) {
+        helper::check_token_equality(sut.FindNextToken(), expectedToken);
+    }
+    helper::check_has_no_more_tokens(sut);
+}
+
 TEST_CASE("Should return keyword token with 'INPUT' value")
 {
     const std::string buffer = "INPUT";
@@ -503,6 +545,304 @@ TEST_CASE("Should throw exception when characters other than spaces and tabs are
     CHECK_THROWS_AS(sut.FindNextToken(), exception::UnexpectedCharacterException);
 }
 
+TEST_CASE("After the 'INPUT' keyword should return 'FILE' keyword and path from the same line")
+{
+    const std::string buffer = "INPUT FILE  data/some input.txt \t\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "FILE"});
+    helper::check_token_equality(thirdToken, {TokenKind::TEXT, "data/some input.txt"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'INPUT FILE' keywords should not read lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "INPUT FILE input.txt\nRUN";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "FILE"});
+    helper::check_token_equality(thirdToken, {TokenKind::TEXT, "input.txt"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "RUN"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'INPUT FILE' keywords should not return text token when path is missing")
+{
+    const std::string buffer = "INPUT FILE\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "FILE"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'FILE' keyword and path from the same line")
+{
+    const std::string buffer = "EXPECT OUTPUT FILE expected.txt\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "FILE"});
+    helper::check_token_equality(fourthToken, {TokenKind::TEXT, "expected.txt"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'SHA256' keyword and digest from the same line")
+{
+    const std::string buffer = "EXPECT OUTPUT SHA256 71fe348d841941fe2c3a1828f01dc9a0cdad7acaef8b41707bd3f36bac3260ba\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "SHA256"});
+    helper::check_token_equality(fourthToken, {TokenKind::TEXT, "71fe348d841941fe2c3a1828f01dc9a0cdad7acaef8b41707bd3f36bac3260ba"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'MATCHES' keyword and pattern from the same line")
+{
+    const std::string buffer = "EXPECT IN OUTPUT MATCHES ^[0-9]+ (a|b)$\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+    auto sixthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "IN"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "MATCHES"});
+    helper::check_token_equality(fifthToken, {TokenKind::TEXT, "^[0-9]+ (a|b)$"});
+    helper::check_token_equality(sixthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'TEMPLATE' keyword and lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "EXPECT OUTPUT TEMPLATE \nPID: {{int}}\n\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "TEMPLATE"});
+    helper::check_token_equality(fourthToken, {TokenKind::TEXT, "PID: {{int}}\n"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'IN ORDER' keywords and lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "EXPECT IN OUTPUT IN ORDER\nstarting\nready\n\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+    auto sixthToken = sut.FindNextToken();
+    auto seventhToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "IN"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "IN"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "ORDER"});
+    helper::check_token_equality(sixthToken, {TokenKind::TEXT, "starting\nready\n"});
+    helper::check_token_equality(seventhToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'LINES UNORDERED' keywords and lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "EXPECT OUTPUT LINES UNORDERED\nfirst\nsecond\n\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+    auto sixthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "LINES"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "UNORDERED"});
+    helper::check_token_equality(fifthToken, {TokenKind::TEXT, "first\nsecond\n"});
+    helper::check_token_equality(sixthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'JSON' keyword and lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "EXPECT OUTPUT JSON\n{\"a\": [1, 2]}\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "JSON"});
+    helper::check_token_equality(fourthToken, {TokenKind::TEXT, "{\"a\": [1, 2]}"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'WITH TOLERANCE' keywords, arguments and lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "EXPECT OUTPUT WITH TOLERANCE 0.01  1e-6\npi: 3.14\n\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+    auto sixthToken = sut.FindNextToken();
+    auto seventhToken = sut.FindNextToken();
+    auto eighthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "WITH"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "TOLERANCE"});
+    helper::check_token_equality(fifthToken, {TokenKind::TEXT, "0.01"});
+    helper::check_token_equality(sixthToken, {TokenKind::TEXT, "1e-6"});
+    helper::check_token_equality(seventhToken, {TokenKind::TEXT, "pi: 3.14\n"});
+    helper::check_token_equality(eighthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'SIZE' keyword and integer")
+{
+    const std::string buffer = "EXPECT OUTPUT SIZE 1024\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "SIZE"});
+    helper::check_token_equality(fourthToken, {TokenKind::INTEGER, "1024"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'LINES AT LEAST' keywords and integer")
+{
+    const std::string buffer = "EXPECT OUTPUT LINES AT LEAST 3\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+    auto sixthToken = sut.FindNextToken();
+    auto seventhToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "LINES"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "AT"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "LEAST"});
+    helper::check_token_equality(sixthToken, {TokenKind::INTEGER, "3"});
+    helper::check_token_equality(seventhToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT SIZE' keywords should throw exception when count is not a number")
+{
+    const std::string buffer = "EXPECT OUTPUT SIZE 10k\n";
+    Lexer sut(buffer);
+
+    (void) sut.FindNextToken();
+    (void) sut.FindNextToken();
+    (void) sut.FindNextToken();
+
+    CHECK_THROWS_AS(sut.FindNextToken(), exception::UnexpectedCharacterException);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should return 'STARTS WITH' keywords and lines up to 'EXPECT' keyword")
+{
+    const std::string buffer = "EXPECT OUTPUT STARTS WITH\nWelcome\n\nEXPECT";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+    auto sixthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "STARTS"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "WITH"});
+    helper::check_token_equality(fifthToken, {TokenKind::TEXT, "Welcome\n"});
+    helper::check_token_equality(sixthToken, {TokenKind::KEYWORD, "EXPECT"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'INPUT' keyword should return 'FILE' text token when it is in the next line")
+{
+    const std::string buffer = "INPUT\nFILE input.txt";
+    const Token expectedFirstToken {TokenKind::KEYWORD, "INPUT"};
+    const Token expectedSecondToken {TokenKind::TEXT, "FILE input.txt"};
+    helper::test_two_tokens_with_buffer(buffer, expectedFirstToken, expectedSecondToken);
+}
+
 TEST_CASE("After the 'INPUT' keyword should return empty text token when there is no more text in buffer")
 {
     const std::string buffer = "INPUT";
@@ -576,6 +916,85 @@ TEST_CASE("After the 'INPUT' keyword should return all next lines as text token
     helper::check_has_no_more_tokens(sut);
 }
 
+TEST_CASE("After the 'INPUT' keyword should return all next lines as text token up to line begining with 'RUN' keyword")
+{
+    const std::string buffer = "INPUT\nsome input\nother line\nRUN\nWITH";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(secondToken, {TokenKind::TEXT, "some input\nother line"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "RUN"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "WITH"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'INPUT' keyword should return text token up to 'RUN' keyword at the end of buffer")
+{
+    const std::string buffer = "INPUT\nsome input\nRUN";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(secondToken, {TokenKind::TEXT, "some input"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "RUN"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'INPUT' keyword should ignore line begining with word starting with 'RUN'")
+{
+    const std::string buffer = "INPUT\nRUNNING\nRUN_ALL";
+    const Token expectedFirstToken {TokenKind::KEYWORD, "INPUT"};
+    const Token expectedSecondToken {TokenKind::TEXT, "RUNNING\nRUN_ALL"};
+    helper::test_two_tokens_with_buffer(buffer, expectedFirstToken, expectedSecondToken);
+}
+
+TEST_CASE("After the 'INPUT' keyword should ignore line begining with 'RUN' keyword followed by other words")
+{
+    const std::string buffer = "INPUT\nRUN 1\nRUN ALL\nRUN\nWITH";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(secondToken, {TokenKind::TEXT, "RUN 1\nRUN ALL"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "RUN"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "WITH"});
+    helper::check_has_no_more_tokens(sut);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should ignore line begining with 'RUN' keyword followed by other words")
+{
+    const std::string buffer = "OUTPUT\nsome output\nRUN 1";
+    const Token expectedFirstToken {TokenKind::KEYWORD, "OUTPUT"};
+    const Token expectedSecondToken {TokenKind::TEXT, "some output\nRUN 1"};
+    helper::test_two_tokens_with_buffer(buffer, expectedFirstToken, expectedSecondToken);
+}
+
+TEST_CASE("After the 'OUTPUT' keyword should end the text token at line with only 'RUN' keyword")
+{
+    const std::string buffer = "OUTPUT\nsome output\nRUN\nother line";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "OUTPUT"});
+    helper::check_token_equality(secondToken, {TokenKind::TEXT, "some output"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "RUN"});
+}
+
 TEST_CASE("Should return proper text token when multiple 'INPUT' keywords are present")
 {
     const std::string buffer = "INPUT\nsome text\nEXPECT INPUT\nother line\nEXPECT";
@@ -1057,6 +1476,29 @@ TEST_CASE("Should read RUN keyword after 'EMPTY INPUT'")
     helper::check_has_no_more_tokens(sut);
 }
 
+TEST_CASE("Should read input lines of the next test after 'EMPTY INPUT'")
+{
+    const std::string buffer = "WITH EMPTY INPUT\nRUN\nWITH INPUT\nEXIT CODE 1";
+    Lexer sut(buffer);
+
+    auto token = sut.FindNextToken();
+    auto secondToken = sut.FindNextToken();
+    auto thirdToken = sut.FindNextToken();
+    auto fourthToken = sut.FindNextToken();
+    auto fifthToken = sut.FindNextToken();
+    auto sixthToken = sut.FindNextToken();
+    auto seventhToken = sut.FindNextToken();
+
+    helper::check_token_equality(token, {TokenKind::KEYWORD, "WITH"});
+    helper::check_token_equality(secondToken, {TokenKind::KEYWORD, "EMPTY"});
+    helper::check_token_equality(thirdToken, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(fourthToken, {TokenKind::KEYWORD, "RUN"});
+    helper::check_token_equality(fifthToken, {TokenKind::KEYWORD, "WITH"});
+    helper::check_token_equality(sixthToken, {TokenKind::KEYWORD, "INPUT"});
+    helper::check_token_equality(seventhToken, {TokenKind::TEXT, "EXIT CODE 1"});
+    helper::check_has_no_more_tokens(sut);
+}
+
 TEST_CASE("Should read WITH keyword after 'EMPTY INPUT'")
 {
     const std::string buffer = "EXPECT EMPTY INPUT\nWITH";
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/logger/AsyncLogger.hpp"
+#include "headers/system/Unix.hpp"
+#include "headers/system/exception/SystemException.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+
+namespace omtt::logger
+{
+
+namespace
+{
+
+// writes the event names, to check the order of events
+class EventNamesLogger : public Logger
+{
+public:
+    explicit EventNamesLogger(std::ostream &stream) : fStream(stream) {}
+
+    void
+    SutPath(const std::string &path) override
+    {
+        fStream << "sut " << path << '\n';
+    }
+
+    void
+    BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                       const omtt::TestPaths::size_type numberOfTests,
+                       const omtt::Path &testPath) override
+    {
+        fStream << "begin " << executedTests << '/' << numberOfTests << ' ' << testPath << '\n';
+    }
+
+    void
+    EndTestExecution(const omtt::ProcessResults &processResults,
+                     const omtt::TestExecutionSummary &summary) override
+    {
+        fStream << "end " << processResults.exitCode << '\n';
+    }
+
+    void
+    OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                      const omtt::TestPaths::size_type numberOfTestsPassed,
+                      const omtt::TestPaths::size_type numberOfTestsFailed) override
+    {
+        fStream << "total " << executedTests << '\n';
+    }
+
+private:
+    std::ostream &fStream;
+};
+
+std::unique_ptr<Logger>
+create_event_names_logger(std::ostream &stream)
+{
+    return std::make_unique<EventNamesLogger>(stream);
+}
+
+class TemporaryFile
+{
+public:
+    TemporaryFile() : fFile(std::tmpfile()) {}
+    ~TemporaryFile() { std::fclose(fFile); }
+
+    int
+    GetFd() const
+    {
+        return fileno(fFile);
+    }
+
+    std::string
+    ReadAll() const
+    {
+        std::string content;
+        char buffer[4096];
+        off_t offset = 0;
+        ssize_t bytes;
+        while ((bytes = pread(GetFd(), buffer, sizeof(buffer), offset)) > 0) {
+            content.append(buffer, static_cast<std::size_t>(bytes));
+            offset += bytes;
+        }
+        return content;
+    }
+
+private:
+    std::FILE *fFile;
+};
+
+}
+
+TEST_CASE("Should write events in logged order on flush")
+{
+    TemporaryFile file;
+    AsyncLogger logger(create_event_names_logger, file.GetFd());
+
+    logger.SutPath("/bin/cat");
+    logger.BeginTestExecution(1, 1, "test.omtt");
+    logger.EndTestExecution({3, "", ""}, {Verdict::PASS, {}});
+    logger.OverallStatistics(1, 1, 0);
+    logger.Flush();
+
+    CHECK(file.ReadAll() == "sut /bin/cat\n"
+                            "begin 1/1 test.omtt\n"
+                            "end 3\n"
+                            "total 1\n");
+}
+
+TEST_CASE("Should keep order of events when ring is full")
+{
+    TemporaryFile file;
+    AsyncLogger logger(create_event_names_logger, file.GetFd(), 2);
+
+    std::string expected;
+    for (int i = 1; i <= 1000; ++i) {
+        logger.BeginTestExecution(i, 1000, "test.omtt");
+        expected += "begin " + std::to_string(i) + "/1000 test.omtt\n";
+    }
+    logger.Flush();
+
+    CHECK(file.ReadAll() == expected);
+}
+
+TEST_CASE("Should write remaining events when destroyed")
+{
+    TemporaryFile file;
+
+    {
+        AsyncLogger logger(create_event_names_logger, file.GetFd());
+        logger.SutPath("/bin/cat");
+        logger.OverallStatistics(0, 0, 0);
+    }
+
+    CHECK(file.ReadAll() == "sut /bin/cat\n"
+                            "total 0\n");
+}
+
+TEST_CASE("Should write event bigger than kept buffers")
+{
+    TemporaryFile file;
+    AsyncLogger logger(create_event_names_logger, file.GetFd());
+
+    const std::string path(3 * 1024 * 1024, 'p');
+    logger.SutPath(path);
+    logger.SutPath("next");
+    logger.Flush();
+
+    CHECK(file.ReadAll() == "sut " + path + "\n"
+                            "sut next\n");
+}
+
+TEST_CASE("Should report write failure on flush")
+{
+    const auto pipe = system::unix::MakePipe();
+    system::unix::Close(pipe.writeEnd);
+
+    AsyncLogger logger(create_event_names_logger, pipe.writeEnd);
+    logger.SutPath("/bin/cat");
+
+    CHECK_THROWS_AS(logger.Flush(), system::unix::exception::SystemException);
+
+    system::unix::Close(pipe.readEnd);
+}
+
+}  // omtt::logger
@@ -10,6 +10,20 @@
 
 #include "headers/logger/ConsoleLogger.hpp"
 #include "headers/expectation/validation/FullOutputCause.hpp"
+#include "headers/expectation/validation/OutputDiffCause.hpp"
+#include "headers/expectation/validation/OutputFileCause.hpp"
+#include "headers/expectation/validation/OutputMatchesCause.hpp"
+#include "headers/expectation/validation/InOutputMatchesCause.hpp"
+#include "headers/expectation/validation/InOutputInOrderCause.hpp"
+#include "headers/expectation/validation/OutputLinesUnorderedCause.hpp"
+#include "headers/expectation/validation/OutputJsonCause.hpp"
+#include "headers/expectation/validation/OutputWithToleranceCause.hpp"
+#include "headers/expectation/validation/OutputTemplateCause.hpp"
+#include "headers/expectation/validation/OutputSizeCause.hpp"
+#include "headers/expectation/validation/OutputLineCountCause.hpp"
+#include "headers/expectation/validation/OutputStartsWithCause.hpp"
+#include "headers/expectation/validation/OutputSha256Cause.hpp"
+#include "headers/expectation/validation/InputFileCause.hpp"
 
 #include <sstream>
 
@@ -93,7 +107,7 @@ CreateTestSummary(const std::string::size_type differencePosition = 0,
                   const std::string &expectedOutput = "",
                   const std::string &output = "")
 {
-    auto cause = expectation::validation::FullOutputCause{differencePosition, expectedOutput, output};
+    auto cause = expectation::validation::FullOutputCause{differencePosition, 1, differencePosition + 1, expectedOutput, output};
 
     return {
         Verdict::FAIL,
@@ -137,6 +151,16 @@ TEST_GROUP("Full Output Cause logging")
         CHECK(contain(console_log, "Output doesn't match.\nFirst difference at byte: 4"));
     }
 
+    UNIT_TEST("Difference position message should contain line and column of the difference")
+    {
+        const auto cause = expectation::validation::FullOutputCause{6, 2, 3, "ab\ncdx", "ab\ncdy"};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "First difference at byte: 6 (line 2, column 3)\n"));
+    }
+
     UNIT_TEST("Context should have three empty new lines for empty process output")
     {
         constexpr std::string::size_type differencePosition = 0;
@@ -562,6 +586,215 @@ CreateSuccessfulTestSummary()
 
 }
 
+TEST_GROUP("Output File Cause logging")
+{
+
+    UNIT_TEST("Should contain file path and difference position with line and column")
+    {
+        const std::string expectedOutputFile = "expected.txt";
+        const auto cause = expectation::validation::OutputFileCause{expectedOutputFile, 120, 3, 5, 1, "ab", "ac"};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Output doesn't match the file: expected.txt\nFirst difference at byte: 120 (line 3, column 5)"));
+    }
+
+    UNIT_TEST("Should contain context of the first difference")
+    {
+        const std::string expectedOutputFile = "expected.txt";
+        const auto cause = expectation::validation::OutputFileCause{expectedOutputFile, 120, 3, 5, 1, "ab", "ac"};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Expected (context):\n\
+a    b    \n\
+     ^    \n\
+0x61 0x62 \n\
+Got (context):\n\
+a    c    \n\
+     ^    \n\
+0x61 0x63"));
+    }
+
+}
+
+TEST_GROUP("Output Matches Cause logging")
+{
+
+    UNIT_TEST("Should contain pattern, matched prefix size and context")
+    {
+        const std::string pattern = "ab+";
+        const auto cause = expectation::validation::OutputMatchesCause{pattern, 1, 1, "ac"};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Output doesn't match the pattern: ab+\n\
+Longest matched prefix: 1 bytes\n\
+Got (context):\n\
+a    c    \n\
+     ^    \n\
+0x61 0x63"));
+    }
+
+    UNIT_TEST("Should contain pattern not found in output")
+    {
+        const std::string pattern = "^ab+$";
+        const auto cause = expectation::validation::InOutputMatchesCause{pattern};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Pattern not found in output: ^ab+$"));
+    }
+
+}
+
+TEST_GROUP("In Output In Order Cause logging")
+{
+
+    UNIT_TEST("Should contain text number, search position and text context")
+    {
+        const std::string text = "ready";
+        const auto cause = expectation::validation::InOutputInOrderCause{text, 2, 3, 8};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Text not found in output after byte: 8\n\
+Text 2 of 3 in order.\n\
+Expected (context):\n\
+r    e    a    d    y    \n\
+0x72 0x65 0x61 0x64 0x79"));
+    }
+
+}
+
+TEST_GROUP("Output Lines Unordered Cause logging")
+{
+
+    UNIT_TEST("Should contain missing and extra lines with their counts")
+    {
+        const auto cause = expectation::validation::OutputLinesUnorderedCause{{{"second", 2}}, 2,
+                                                                              {{"extra", 1}, {"other", 1}}, 3};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Output lines don't match (in any order).\n\
+Missing lines: 2\n\
+  second (2 times)\n\
+Extra lines: 3\n\
+  extra\n\
+  other\n\
+  ..."));
+    }
+
+    UNIT_TEST("Should not contain missing lines header when no line is missing")
+    {
+        const auto cause = expectation::validation::OutputLinesUnorderedCause{{}, 0, {{"extra", 1}}, 1};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(not contain(console_log, "Missing lines"));
+        CHECK(contain(console_log, "Extra lines: 1\n  extra"));
+    }
+
+}
+
+TEST_GROUP("Output JSON Cause logging")
+{
+
+    UNIT_TEST("Should contain pointer, expected and actual values")
+    {
+        const auto cause = expectation::validation::OutputJsonCause{"/items/1/name", "\"first\"", "nothing"};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Output JSON doesn't match.\n\
+First difference at: \"/items/1/name\"\n\
+Expected: \"first\"\n\
+Got: nothing"));
+    }
+
+}
+
+TEST_GROUP("Output With Tolerance Cause logging")
+{
+
+    UNIT_TEST("Should contain numbers out of tolerance with context")
+    {
+        const auto cause = expectation::validation::OutputWithToleranceCause{2, 2, "1.0", "1.5", "x=1.0", "x=1.5"};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Number out of tolerance at byte: 2\n\
+Expected: 1.0\n\
+Got: 1.5\n\
+Expected (context):\n\
+x    =    1    .    0    \n\
+          ^              \n\
+0x78 0x3d 0x31 0x2e 0x30 \n\
+Got (context):\n\
+x    =    1    .    5    \n\
+          ^              \n\
+0x78 0x3d 0x31 0x2e 0x35 "));
+    }
+
+    UNIT_TEST("Should contain text difference positions")
+    {
+        const auto cause = expectation::validation::OutputWithToleranceCause{4, 2, "", "", "1.0 s", "1 m"};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Output doesn't match.\n\
+First difference at byte: 2\n\
+Expected (context):\n"));
+        CHECK(not contain(console_log, "Number out of tolerance"));
+    }
+
+}
+
+TEST_GROUP("Output Template Cause logging")
+{
+
+    UNIT_TEST("Should contain difference position and context of template and output")
+    {
+        const std::string outputTemplate = "{{int}}";
+        const std::string output = "a";
+        const auto cause = expectation::validation::OutputTemplateCause{0, 0, outputTemplate, output};
+        const TestExecutionSummary testSummary {Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "\
+Output doesn't match the template.\n\
+First difference at byte: 0\n\
+Expected (context):\n\
+{    {    i    n    t    }    }    \n\
+^                                  \n\
+0x7b 0x7b 0x69 0x6e 0x74 0x7d 0x7d \n\
+Got (context):\n\
+a    \n\
+^    \n\
+0x61"));
+    }
+
+}
+
 TEST_GROUP("Errors Output (stderr) logging")
 {
     UNIT_TEST("Should not contain error messages header when stderr is empty")
@@ -619,4 +852,203 @@ TEST_GROUP("Errors Output (stderr) logging")
     }
 }
 
+TEST_GROUP("Error Output Causes logging")
+{
+
+    UNIT_TEST("Full output cause should name error output")
+    {
+        const auto cause = expectation::validation::FullOutputCause{0, 1, 1, "a", "b", expectation::Stream::ERROR_OUTPUT};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Error output doesn't match.\nFirst difference at byte: 0 (line 1, column 1)\n"));
+    }
+
+    UNIT_TEST("Partial output cause should name error output")
+    {
+        const auto cause = expectation::validation::PartialOutputCause{"a", expectation::Stream::ERROR_OUTPUT};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Text not found in error output.\nExpected (context):\n"));
+    }
+
+    UNIT_TEST("Empty output cause should name error output")
+    {
+        const auto cause = expectation::validation::EmptyOutputCause{"a", expectation::Stream::ERROR_OUTPUT};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Expected empty error output.\nGot (context):\n"));
+    }
+
+}
+
+TEST_GROUP("Output Diff Cause logging")
+{
+
+    UNIT_TEST("Should show hunks in unified format")
+    {
+        using expectation::detail::DiffLine;
+
+        const std::vector<expectation::detail::DiffHunk> hunks{
+            {4, 3, 4, 3, {{DiffLine::Kind::COMMON, "a\n"},
+                          {DiffLine::Kind::DELETED, "b\n"},
+                          {DiffLine::Kind::INSERTED, "c\n"},
+                          {DiffLine::Kind::COMMON, "d\n"}}},
+            {20, 1, 20, 0, {{DiffLine::Kind::DELETED, "e"}}}
+        };
+        const auto cause = expectation::validation::OutputDiffCause{hunks};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Output doesn't match.\n"
+                                   "--- expected\n"
+                                   "+++ output\n"
+                                   "@@ -5,3 +5,3 @@\n"
+                                   " a\n"
+                                   "-b\n"
+                                   "+c\n"
+                                   " d\n"
+                                   "@@ -21,1 +20,0 @@\n"
+                                   "-e\n"
+                                   "\\ No newline at end of file\n"));
+    }
+
+}
+
+TEST_GROUP("Output Count Causes logging")
+{
+
+    UNIT_TEST("Should contain expected and counted output size")
+    {
+        const auto cause = expectation::validation::OutputSizeCause{expectation::Comparison::EXACTLY, 1024, 1000};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Output size doesn't match.\n"
+                                   "Expected: 1024 bytes\n"
+                                   "Got: 1000 bytes"));
+    }
+
+    UNIT_TEST("Should contain limits of output line count")
+    {
+        const auto atLeast = expectation::validation::OutputLineCountCause{expectation::Comparison::AT_LEAST, 3, 2};
+        const auto atMost = expectation::validation::OutputLineCountCause{expectation::Comparison::AT_MOST, 1, 2};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {atLeast, atMost}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Output line count doesn't match.\n"
+                                   "Expected: at least 3 lines\n"
+                                   "Got: 2 lines"));
+        CHECK(contain(console_log, "Expected: at most 1 lines\n"));
+    }
+
+}
+
+TEST_GROUP("Output Starts With Cause logging")
+{
+
+    UNIT_TEST("Should contain difference position and context")
+    {
+        const auto cause = expectation::validation::OutputStartsWithCause{"Welcome", 3, 3, "Well done"};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Output doesn't start with the expected text.\n"
+                                   "First difference at byte: 3\n"
+                                   "Expected (context):\n"
+                                   "W    e    l    c    o    m    e"));
+        CHECK(contain(console_log, "Got (context):\n"
+                                   "W    e    l    l    SPC  d    o    n    e"));
+    }
+
+}
+
+TEST_GROUP("Output SHA-256 Cause logging")
+{
+
+    UNIT_TEST("Should contain expected and computed digests with output size")
+    {
+        const auto cause = expectation::validation::OutputSha256Cause{"71fe", "5891", 6, "hello\n", "hello\n"};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Output SHA-256 doesn't match.\n"
+                                   "Expected: 71fe\n"
+                                   "Got: 5891 (6 bytes)\n"
+                                   "Output beginning (context):\n"
+                                   "h    e    l    l    o    LF"));
+        CHECK(contain(console_log, "Output end (context):\n"
+                                   "h    e    l    l    o    LF"));
+    }
+
+    UNIT_TEST("Should not contain output samples for empty output")
+    {
+        const auto cause = expectation::validation::OutputSha256Cause{"71fe", "e3b0", 0, "", ""};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Got: e3b0 (0 bytes)"));
+        CHECK(!contain(console_log, "Output beginning"));
+    }
+
+}
+
+TEST_GROUP("Input File Cause logging")
+{
+
+    UNIT_TEST("Should contain input file path and reason")
+    {
+        const auto cause = expectation::validation::InputFileCause{"data/input.txt", "No such file or directory"};
+        const TestExecutionSummary testSummary{Verdict::FAIL, {cause}};
+
+        const auto console_log = ExecuteSut(notImportantProcessResult, testSummary);
+
+        CHECK(contain(console_log, "Input file can't be opened: data/input.txt\n"
+                                   "Reason: No such file or directory"));
+    }
+
+}
+
+TEST_GROUP("Resource usage logging")
+{
+
+    const omtt::ProcessResults processResults {
+        0,
+        "",
+        "",
+        {std::chrono::milliseconds(12), std::chrono::microseconds(1500), std::chrono::microseconds(250), 2048, 100, 1, 3, 4}
+    };
+
+    UNIT_TEST("Resources should be printed after the verdict when they are shown")
+    {
+        std::stringstream stream;
+        logger::ConsoleLogger sut(stream, true);
+        sut.EndTestExecution(processResults, {Verdict::PASS, {}});
+
+        CHECK(stream.str() == "Verdict: PASS\n"
+                              "Resources: wall_time=0.012000 user_time=0.001500 system_time=0.000250 max_rss_kb=2048"
+                              " minor_page_faults=100 major_page_faults=1"
+                              " voluntary_context_switches=3 involuntary_context_switches=4\n");
+    }
+
+    UNIT_TEST("Resources should not be printed by default")
+    {
+        const auto console_log = ExecuteSut(processResults, {Verdict::PASS, {}});
+
+        CHECK(!contain(console_log, "Resources:"));
+    }
+
+}
+
 }
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/logger/JUnitXmlLogger.hpp"
+
+#include <sstream>
+#include <string>
+
+
+namespace omtt::logger
+{
+
+namespace
+{
+
+bool
+contain(const std::string &text, const std::string &value)
+{
+    return text.find(value) != std::string::npos;
+}
+
+}
+
+TEST_CASE("Should begin test suite named after SUT")
+{
+    std::stringstream stream;
+    JUnitXmlLogger logger(stream);
+
+    logger.SutPath("/bin/cat");
+
+    CHECK(stream.str() == "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                          "<testsuites>\n"
+                          "  <testsuite name=\"/bin/cat\">\n");
+}
+
+TEST_CASE("Should write passed test case when test ends")
+{
+    std::stringstream stream;
+    JUnitXmlLogger logger(stream);
+
+    logger.SutPath("/bin/cat");
+    logger.BeginTestExecution(1, 1, "tests/a&b.omtt");
+    stream.str("");
+    logger.EndTestExecution({0, "", "", {std::chrono::milliseconds(5),
+                                         std::chrono::microseconds(1500),
+                                         std::chrono::microseconds(250),
+                                         2048, 100, 1, 3, 4}},
+                            {Verdict::PASS, {}, std::chrono::microseconds(5250)});
+
+    CHECK(stream.str() == "    <testcase name=\"tests/a&amp;b.omtt\" classname=\"/bin/cat\" time=\"0.005250\">\n"
+                          "      <properties>\n"
+                          "        <property name=\"exit_code\" value=\"0\"/>\n"
+                          "        <property name=\"wall_time\" value=\"0.005000\"/>\n"
+                          "        <property name=\"user_time\" value=\"0.001500\"/>\n"
+                          "        <property name=\"system_time\" value=\"0.000250\"/>\n"
+                          "        <property name=\"max_rss_kb\" value=\"2048\"/>\n"
+                          "        <property name=\"minor_page_faults\" value=\"100\"/>\n"
+                          "        <property name=\"major_page_faults\" value=\"1\"/>\n"
+                          "        <property name=\"voluntary_context_switches\" value=\"3\"/>\n"
+                          "        <property name=\"involuntary_context_switches\" value=\"4\"/>\n"
+                          "      </properties>\n"
+                          "    </testcase>\n");
+}
+
+TEST_CASE("Should write failure with causes and SUT errors")
+{
+    std::stringstream stream;
+    JUnitXmlLogger logger(stream);
+
+    logger.BeginTestExecution(1, 1, "test.omtt");
+    logger.EndTestExecution({1, "", "<error>\n"},
+                            {Verdict::FAIL,
+                             {expectation::validation::ExitCodeCause{0, 1},
+                              expectation::validation::SuccessfulExitCause{1}}});
+
+    CHECK(contain(stream.str(), "<property name=\"exit_code\" value=\"1\"/>"));
+    CHECK(contain(stream.str(), "      <failure message=\"Exit code doesn&apos;t match.\" type=\"FAIL\">"
+                                "Exit code doesn&apos;t match.\nExpected: 0\nGot: 1\n"
+                                "--------------------\n"
+                                "Exit status doesn&apos;t match.\nExpected: exit with success\n"
+                                "Got: exit with failure (exit code: 1)</failure>\n"
+                                "      <system-err>&lt;error&gt;\n</system-err>\n"));
+}
+
+TEST_CASE("Should write failure without causes")
+{
+    std::stringstream stream;
+    JUnitXmlLogger logger(stream);
+
+    logger.BeginTestExecution(1, 1, "test.omtt");
+    logger.EndTestExecution({1, "", ""}, {Verdict::FAIL, {}});
+
+    CHECK(contain(stream.str(), "      <failure message=\"FAIL\" type=\"FAIL\"></failure>\n"));
+}
+
+TEST_CASE("Should replace characters not allowed in XML")
+{
+    std::stringstream stream;
+    JUnitXmlLogger logger(stream);
+
+    logger.BeginTestExecution(1, 1, "test\n.omtt");
+    logger.EndTestExecution({0, "", std::string("\x01\xFF", 2)}, {Verdict::PASS, {}});
+
+    CHECK(contain(stream.str(), "<testcase name=\"test&#10;.omtt\""));
+    CHECK(contain(stream.str(), "<system-err>\xEF\xBF\xBD\xEF\xBF\xBD</system-err>"));
+}
+
+TEST_CASE("Should end test suite with overall statistics")
+{
+    std::stringstream stream;
+
+    {
+        JUnitXmlLogger logger(stream);
+        logger.SutPath("/bin/cat");
+        stream.str("");
+        logger.OverallStatistics(0, 0, 0);
+    }
+
+    CHECK(stream.str() == "  </testsuite>\n"
+                          "</testsuites>\n");
+}
+
+TEST_CASE("Should end test suite when run is interrupted")
+{
+    std::stringstream stream;
+
+    {
+        JUnitXmlLogger logger(stream);
+        logger.SutPath("/bin/cat");
+        stream.str("");
+    }
+
+    CHECK(stream.str() == "  </testsuite>\n"
+                          "</testsuites>\n");
+}
+
+}  // omtt::logger
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/logger/JsonLinesLogger.hpp"
+
+#include <sstream>
+#include <string>
+
+
+namespace omtt::logger
+{
+
+namespace
+{
+
+bool
+contain(const std::string &text, const std::string &value)
+{
+    return text.find(value) != std::string::npos;
+}
+
+std::string
+log_test(const omtt::ProcessResults &processResults,
+         const omtt::TestExecutionSummary &summary)
+{
+    std::stringstream stream;
+    JsonLinesLogger logger(stream);
+
+    logger.BeginTestExecution(2, 3, "tests/cat.omtt#2");
+    logger.EndTestExecution(processResults, summary);
+
+    return stream.str();
+}
+
+}
+
+TEST_CASE("Should write start record with SUT path")
+{
+    std::stringstream stream;
+    JsonLinesLogger logger(stream);
+
+    logger.SutPath("/bin/cat");
+
+    CHECK(stream.str() == "{\"type\":\"start\",\"sut\":\"/bin/cat\"}\n");
+}
+
+TEST_CASE("Should write test record in one line when test ends")
+{
+    const std::string record = log_test({0, "", ""}, {Verdict::PASS, {}});
+
+    CHECK(record.rfind("{\"type\":\"test\",\"number\":2,\"total\":3,\"test\":\"tests/cat.omtt#2\","
+                       "\"verdict\":\"PASS\",\"exit_code\":0,\"time\":", 0) == 0);
+    CHECK(contain(record, ",\"causes\":[],\"errors\":\"\"}\n"));
+    CHECK(record.find('\n') == record.size() - 1);
+}
+
+TEST_CASE("Should write resources used by SUT")
+{
+    const std::string record = log_test({0, "", "", {std::chrono::milliseconds(12),
+                                                     std::chrono::microseconds(1500),
+                                                     std::chrono::microseconds(250),
+                                                     2048, 100, 1, 3, 4}},
+                                        {Verdict::PASS, {}, std::chrono::microseconds(12500)});
+
+    CHECK(contain(record, "\"time\":0.012500,\"resources\":{\"wall_time\":0.012000,\"user_time\":0.001500,"
+                          "\"system_time\":0.000250,\"max_rss_kb\":2048,\"minor_page_faults\":100,"
+                          "\"major_page_faults\":1,\"voluntary_context_switches\":3,"
+                          "\"involuntary_context_switches\":4},\"causes\":[]"));
+}
+
+TEST_CASE("Should write causes and SUT errors of failed test")
+{
+    const std::string record = log_test({1, "", "error\n"},
+                                        {Verdict::FAIL,
+                                         {expectation::validation::ExitCodeCause{0, 1},
+                                          expectation::validation::SuccessfulExitCause{1}}});
+
+    CHECK(contain(record, "\"verdict\":\"FAIL\",\"exit_code\":1,"));
+    CHECK(contain(record, "\"causes\":[\"Exit code doesn't match.\\nExpected: 0\\nGot: 1\","
+                          "\"Exit status doesn't match.\\nExpected: exit with success\\n"
+                          "Got: exit with failure (exit code: 1)\"],"));
+    CHECK(contain(record, "\"errors\":\"error\\n\"}"));
+}
+
+TEST_CASE("Should escape special characters and invalid bytes")
+{
+    const std::string record = log_test({0, "", std::string("\"\\\t\x01 z\xC5\xBC \xFF", 10)}, {Verdict::PASS, {}});
+
+    CHECK(contain(record, "\"errors\":\"\\\"\\\\\\t\\u0001 z\xC5\xBC \xEF\xBF\xBD\"}"));
+}
+
+TEST_CASE("Should write summary record")
+{
+    std::stringstream stream;
+    JsonLinesLogger logger(stream);
+
+    logger.OverallStatistics(3, 2, 1);
+
+    CHECK(stream.str() == "{\"type\":\"summary\",\"tests\":3,\"passed\":2,\"failed\":1}\n");
+}
+
+}  // omtt::logger
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/logger/MultiLogger.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace omtt::logger
+{
+
+namespace
+{
+
+// records the events with the logger name
+class RecordingLogger : public Logger
+{
+public:
+    RecordingLogger(std::vector<std::string> &events, const std::string &name)
+        :
+        fEvents(events),
+        fName(name)
+    {
+    }
+
+    void SutPath(const std::string &path) override { fEvents.push_back(fName + " sut " + path); }
+
+    void
+    BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                       const omtt::TestPaths::size_type numberOfTests,
+                       const omtt::Path &testPath) override
+    {
+        fEvents.push_back(fName + " begin " + testPath);
+    }
+
+    void
+    EndTestExecution(const omtt::ProcessResults &processResults,
+                     const omtt::TestExecutionSummary &summary) override
+    {
+        fEvents.push_back(fName + " end " + to_cstring(summary.verdict));
+    }
+
+    void
+    OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                      const omtt::TestPaths::size_type numberOfTestsPassed,
+                      const omtt::TestPaths::size_type numberOfTestsFailed) override
+    {
+        fEvents.push_back(fName + " total " + std::to_string(executedTests));
+    }
+
+    void Flush() override { fEvents.push_back(fName + " flush"); }
+
+private:
+    std::vector<std::string> &fEvents;
+    const std::string        fName;
+};
+
+}
+
+TEST_CASE("Should pass every event to all loggers in order")
+{
+    std::vector<std::string> events;
+    std::vector<std::unique_ptr<Logger>> loggers;
+    loggers.push_back(std::make_unique<RecordingLogger>(events, "console"));
+    loggers.push_back(std::make_unique<RecordingLogger>(events, "json"));
+    MultiLogger logger(std::move(loggers));
+
+    logger.SutPath("/bin/cat");
+    logger.BeginTestExecution(1, 1, "test.omtt");
+    logger.EndTestExecution({0, "", ""}, {Verdict::PASS, {}});
+    logger.OverallStatistics(1, 1, 0);
+    logger.Flush();
+
+    CHECK(events == std::vector<std::string>{"console sut /bin/cat", "json sut /bin/cat",
+                                             "console begin test.omtt", "json begin test.omtt",
+                                             "console end PASS", "json end PASS",
+                                             "console total 1", "json total 1",
+                                             "console flush", "json flush"});
+}
+
+}  // omtt::logger
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/logger/detail/Context.hpp"
+
+#include <string>
+#include <type_traits>
+
+
+namespace omtt::logger::detail
+{
+
+TEST_CASE("Should show characters and hex codes around the mismatch")
+{
+    const std::string text = "0123456789abcdef";
+
+    CHECK(context(text, 8, PointerVisibility::NO_POINTER)
+          == "2    3    4    5    6    7    8    9    a    b    c    d    e    \n"
+             "0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 0x61 0x62 0x63 0x64 0x65 ");
+}
+
+TEST_CASE("Should point to the mismatch")
+{
+    CHECK(context("abc", 1, PointerVisibility::INCLUDE_POINTER)
+          == "a    b    c    \n"
+             "     ^         \n"
+             "0x61 0x62 0x63 ");
+}
+
+TEST_CASE("Should name white space characters")
+{
+    CHECK(context(" \t\r\n\v\f", 0, PointerVisibility::NO_POINTER)
+          == "SPC  TAB  CR   LF   VT   FF   \n"
+             "0x20 0x09 0x0d 0x0a 0x0b 0x0c ");
+}
+
+TEST_CASE("Should mark not printable characters")
+{
+    CHECK(context(std::string("\x00\x7f", 2), 0, PointerVisibility::NO_POINTER)
+          == "NP   NP   \n"
+             "0x00 0x7f ");
+}
+
+TEST_CASE("Should show bytes above ASCII as sign extended integers")
+{
+    if constexpr (std::is_signed_v<char>) {
+        CHECK(context("\x8a", 0, PointerVisibility::NO_POINTER)
+              == "NP   \n"
+                 "0xffffff8a ");
+    }
+    else {
+        CHECK(context("\x8a", 0, PointerVisibility::NO_POINTER)
+              == "NP   \n"
+                 "0x8a ");
+    }
+}
+
+TEST_CASE("Should show empty rows for empty text")
+{
+    CHECK(context("", 0, PointerVisibility::INCLUDE_POINTER) == "\n\n");
+}
+
+TEST_CASE("Should append context to the buffer")
+{
+    std::string buffer = "Got (context):\n";
+
+    append_context(buffer, "x", 0, PointerVisibility::NO_POINTER);
+
+    CHECK(buffer == "Got (context):\n"
+                    "x    \n"
+                    "0x78 ");
+}
+
+}  // omtt::logger::detail
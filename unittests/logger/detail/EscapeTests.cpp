@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/logger/detail/Escape.hpp"
+
+#include <string>
+
+
+namespace omtt::logger::detail
+{
+
+namespace
+{
+
+const std::string REPLACEMENT = "\xEF\xBF\xBD";
+
+std::string
+json(const std::string &text)
+{
+    std::string buffer;
+    append_json_string(buffer, text);
+    return buffer;
+}
+
+std::string
+xml_text(const std::string &text)
+{
+    std::string buffer;
+    append_xml_text(buffer, text);
+    return buffer;
+}
+
+std::string
+xml_attribute(const std::string &text)
+{
+    std::string buffer;
+    append_xml_attribute(buffer, text);
+    return buffer;
+}
+
+}
+
+TEST_CASE("Should quote and escape JSON string")
+{
+    CHECK(json("") == "\"\"");
+    CHECK(json("a \"b\" \\c/") == "\"a \\\"b\\\" \\\\c/\"");
+    CHECK(json("\n\r\t") == "\"\\n\\r\\t\"");
+    CHECK(json(std::string("\x00\x1f\x7f", 3)) == "\"\\u0000\\u001f\\u007f\"");
+}
+
+TEST_CASE("Should keep valid UTF-8 sequences")
+{
+    CHECK(json("\xC5\xBC\xE2\x82\xAC\xF0\x9F\x98\x80") == "\"\xC5\xBC\xE2\x82\xAC\xF0\x9F\x98\x80\"");
+    CHECK(xml_text("\xC5\xBC\xE2\x82\xAC\xF0\x9F\x98\x80") == "\xC5\xBC\xE2\x82\xAC\xF0\x9F\x98\x80");
+}
+
+TEST_CASE("Should replace invalid UTF-8 bytes")
+{
+    // lone continuation byte, truncated sequence, overlong form, surrogate and code point above U+10FFFF
+    CHECK(json("\x80") == "\"" + REPLACEMENT + "\"");
+    CHECK(json("\xE2\x82") == "\"" + REPLACEMENT + REPLACEMENT + "\"");
+    CHECK(json("\xC0\xAF") == "\"" + REPLACEMENT + REPLACEMENT + "\"");
+    CHECK(json("\xED\xA0\x80") == "\"" + REPLACEMENT + REPLACEMENT + REPLACEMENT + "\"");
+    CHECK(json("\xF4\x90\x80\x80") == "\"" + REPLACEMENT + REPLACEMENT + REPLACEMENT + REPLACEMENT + "\"");
+    CHECK(json("a\xFFz") == "\"a" + REPLACEMENT + "z\"");
+}
+
+TEST_CASE("Should escape XML markup characters")
+{
+    CHECK(xml_text("<a href=\"x\">&'</a>") == "&lt;a href=&quot;x&quot;&gt;&amp;&apos;&lt;/a&gt;");
+}
+
+TEST_CASE("Should keep new lines in XML text and escape them in attributes")
+{
+    CHECK(xml_text("a\n\tb\r") == "a\n\tb&#13;");
+    CHECK(xml_attribute("a\n\tb\r") == "a&#10;&#9;b&#13;");
+}
+
+TEST_CASE("Should replace control characters not allowed in XML")
+{
+    CHECK(xml_text(std::string("\x00\x1b", 2)) == REPLACEMENT + REPLACEMENT);
+}
+
+}  // omtt::logger::detail
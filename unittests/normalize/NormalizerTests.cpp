@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/normalize/Normalizer.hpp"
+
+#include <string>
+#include <vector>
+
+
+namespace omtt::normalize
+{
+
+namespace
+{
+
+std::string
+normalized_in_chunks(const Filters &filters, const std::string &text, const std::string::size_type chunkSize)
+{
+    Normalizer normalizer(filters);
+    std::string result;
+
+    for (std::string::size_type i = 0; i < text.size(); i += chunkSize) {
+        std::string chunk = text.substr(i, chunkSize);
+        normalizer.Apply(chunk, [&result](const std::string_view &piece) {
+            result += piece;
+        });
+    }
+
+    return result;
+}
+
+}
+
+TEST_CASE("Should leave text unchanged without filters")
+{
+    CHECK(normalized({}, "a  b\n\n\n12\n") == "a  b\n\n\n12\n");
+}
+
+TEST_GROUP("Trim")
+{
+
+UNIT_TEST("Should remove spaces and tabs at the end of lines")
+{
+    CHECK(normalized({Filter::TRIM}, "a \t\nb  \n  c\n") == "a\nb\n  c\n");
+}
+
+UNIT_TEST("Should remove spaces at the end of text")
+{
+    CHECK(normalized({Filter::TRIM}, "a  ") == "a");
+    CHECK(normalized({Filter::TRIM}, "   ") == "");
+}
+
+UNIT_TEST("Should keep spaces inside lines")
+{
+    CHECK(normalized({Filter::TRIM}, "a \t b\n") == "a \t b\n");
+}
+
+UNIT_TEST("Should give the same text for any chunk size")
+{
+    const std::string text = "a  b   \n \t \n  c  d \t\n e ";
+    const std::string expected = normalized({Filter::TRIM}, text);
+
+    for (std::string::size_type chunkSize = 1; chunkSize <= text.size(); ++chunkSize) {
+        CHECK(normalized_in_chunks({Filter::TRIM}, text, chunkSize) == expected);
+    }
+}
+
+}
+
+TEST_GROUP("Squeeze")
+{
+
+UNIT_TEST("Should leave at most one empty line in a row")
+{
+    CHECK(normalized({Filter::SQUEEZE}, "a\n\n\n\nb\n\nc\n") == "a\n\nb\n\nc\n");
+}
+
+UNIT_TEST("Should remove empty lines at the beginning")
+{
+    CHECK(normalized({Filter::SQUEEZE}, "\n\n\na\n") == "\na\n");
+}
+
+UNIT_TEST("Should give the same text for any chunk size")
+{
+    const std::string text = "\n\na\n\n\n\nb\nc\n\n\n";
+    const std::string expected = normalized({Filter::SQUEEZE}, text);
+
+    for (std::string::size_type chunkSize = 1; chunkSize <= text.size(); ++chunkSize) {
+        CHECK(normalized_in_chunks({Filter::SQUEEZE}, text, chunkSize) == expected);
+    }
+}
+
+}
+
+TEST_GROUP("Mask")
+{
+
+UNIT_TEST("Should replace decimal numbers")
+{
+    CHECK(normalized({Filter::MASK_INT}, "pid 1234, port 80: 5") == "pid #, port #: #");
+}
+
+UNIT_TEST("Should replace hexadecimal numbers after prefix")
+{
+    CHECK(normalized({Filter::MASK_HEX}, "at 0x7ffd1a, 0XAB and 0x") == "at 0x#, 0X# and 0x");
+}
+
+UNIT_TEST("Should not replace hexadecimal numbers without prefix")
+{
+    CHECK(normalized({Filter::MASK_HEX}, "deadbeef 12") == "deadbeef 12");
+    CHECK(normalized({Filter::MASK_HEX}, "v10x12") == "v10x12");
+}
+
+UNIT_TEST("Should give the same text for any chunk size")
+{
+    const std::string text = "a 0x1f2e b 123 0xff 0 x9 99";
+    const Filters filters{Filter::MASK_HEX, Filter::MASK_INT};
+    const std::string expected = normalized(filters, text);
+
+    CHECK(expected == "a #x# b # #x# # x# #");
+    for (std::string::size_type chunkSize = 1; chunkSize <= text.size(); ++chunkSize) {
+        CHECK(normalized_in_chunks(filters, text, chunkSize) == expected);
+    }
+}
+
+}
+
+TEST_CASE("Should apply filters in the given order")
+{
+    const std::string text = "1 \n\n\n2 \n";
+
+    CHECK(normalized({Filter::MASK_INT, Filter::TRIM, Filter::SQUEEZE}, text) == "#\n\n#\n");
+}
+
+TEST_CASE("Should pass the spaces kept between chunks through the next filters")
+{
+    const std::string text = "a  1 \t\n  \n\n\nb \t 22  c\n";
+    const Filters filters{Filter::TRIM, Filter::SQUEEZE, Filter::MASK_INT};
+    const std::string expected = normalized(filters, text);
+
+    CHECK(expected == "a  #\n\nb \t #  c\n");
+    for (std::string::size_type chunkSize = 1; chunkSize <= text.size(); ++chunkSize) {
+        CHECK(normalized_in_chunks(filters, text, chunkSize) == expected);
+    }
+}
+
+}  // omtt::normalize
@@ -7,6 +7,9 @@
  */
 
 #include "headers/parser/Parser.hpp"
+#include "headers/expectation/exception/TemplateSyntaxException.hpp"
+#include "headers/regex/exception/SyntaxException.hpp"
+#include "headers/json/exception/SyntaxException.hpp"
 #include "unittests/lexer/LexerFake.hpp"
 
 #include "unittests/test_framework.hpp"
@@ -366,6 +369,647 @@ TEST_GROUP("Overall")
 
         CHECK_THROWS_AS(sut.parse(), exception::WrongTokenException);
     }
+
+    UNIT_TEST("Should parse correct input file tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "FILE"},
+                        lexer::Token{lexer::TokenKind::TEXT, "data/input.txt"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXIT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "CODE"},
+                        lexer::Token{lexer::TokenKind::INTEGER, "0"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        CHECK(data.input == "");
+        REQUIRE(data.inputFile.has_value());
+        CHECK(*data.inputFile == "data/input.txt");
+        CheckHasOneExpectation(data);
+        CheckExitCode(data, 0);
+    }
+
+    UNIT_TEST("Should throw exception when input file path is missing")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "FILE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::UnexpectedKeywordException);
+    }
+
+    UNIT_TEST("Should parse correct output file tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "FILE"},
+                        lexer::Token{lexer::TokenKind::TEXT, "data/output.txt"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        CheckHasOneExpectation(data);
+        auto *expectation = dynamic_cast<expectation::OutputFileExpectation*>(data.expectations.at(0).get());
+        REQUIRE(expectation != nullptr);
+        CHECK(expectation->GetContent() == "data/output.txt");
+    }
+
+    UNIT_TEST("Should throw exception when output file path is missing")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "FILE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::UnexpectedKeywordException);
+    }
+
+    UNIT_TEST("Should parse correct output matches tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "MATCHES"},
+                        lexer::Token{lexer::TokenKind::TEXT, "[0-9]+\\n"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "MATCHES"},
+                        lexer::Token{lexer::TokenKind::TEXT, "^[a-z]+$"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 2);
+        auto *output = dynamic_cast<expectation::OutputMatchesExpectation*>(data.expectations.at(0).get());
+        REQUIRE(output != nullptr);
+        CHECK(output->GetContent() == "[0-9]+\\n");
+        auto *inOutput = dynamic_cast<expectation::InOutputMatchesExpectation*>(data.expectations.at(1).get());
+        REQUIRE(inOutput != nullptr);
+        CHECK(inOutput->GetContent() == "^[a-z]+$");
+    }
+
+    UNIT_TEST("Should throw exception when pattern is not valid")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "MATCHES"},
+                        lexer::Token{lexer::TokenKind::TEXT, "(abc"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), regex::exception::SyntaxException);
+    }
+
+    UNIT_TEST("Should parse correct output template tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "TEMPLATE"},
+                        lexer::Token{lexer::TokenKind::TEXT, "PID: {{int}}\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *output = dynamic_cast<expectation::OutputTemplateExpectation*>(data.expectations.at(0).get());
+        REQUIRE(output != nullptr);
+        CHECK(output->GetContent() == "PID: {{int}}\n");
+    }
+
+    UNIT_TEST("Should parse correct in output in order tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "ORDER"},
+                        lexer::Token{lexer::TokenKind::TEXT, "starting\nready\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *inOrder = dynamic_cast<expectation::InOutputInOrderExpectation*>(data.expectations.at(0).get());
+        REQUIRE(inOrder != nullptr);
+        CHECK(inOrder->GetContent() == "starting\nready\n");
+    }
+
+    UNIT_TEST("Should throw exception when 'ORDER' keyword is missing after 'IN OUTPUT IN' keywords")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::TEXT, "starting\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::WrongTokenException);
+    }
+
+    UNIT_TEST("Should parse correct output lines unordered tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "LINES"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "UNORDERED"},
+                        lexer::Token{lexer::TokenKind::TEXT, "first\nsecond\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *lines = dynamic_cast<expectation::OutputLinesUnorderedExpectation*>(data.expectations.at(0).get());
+        REQUIRE(lines != nullptr);
+        CHECK(lines->GetContent() == "first\nsecond\n");
+    }
+
+    UNIT_TEST("Should parse correct output size tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "SIZE"},
+                        lexer::Token{lexer::TokenKind::INTEGER, "10737418240"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *size = dynamic_cast<expectation::OutputSizeExpectation*>(data.expectations.at(0).get());
+        REQUIRE(size != nullptr);
+        CHECK(size->GetComparison() == expectation::Comparison::EXACTLY);
+        CHECK(size->GetExpectedSize() == 10737418240u);
+    }
+
+    UNIT_TEST("Should parse correct output size at most tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "SIZE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "AT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "MOST"},
+                        lexer::Token{lexer::TokenKind::INTEGER, "100"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *size = dynamic_cast<expectation::OutputSizeExpectation*>(data.expectations.at(0).get());
+        REQUIRE(size != nullptr);
+        CHECK(size->GetComparison() == expectation::Comparison::AT_MOST);
+        CHECK(size->GetExpectedSize() == 100);
+    }
+
+    UNIT_TEST("Should parse correct output line count at least tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "LINES"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "AT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "LEAST"},
+                        lexer::Token{lexer::TokenKind::INTEGER, "3"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *lines = dynamic_cast<expectation::OutputLineCountExpectation*>(data.expectations.at(0).get());
+        REQUIRE(lines != nullptr);
+        CHECK(lines->GetComparison() == expectation::Comparison::AT_LEAST);
+        CHECK(lines->GetExpectedLineCount() == 3);
+    }
+
+    UNIT_TEST("Should throw exception when output line count is not followed by integer")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "LINES"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "AT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "LEAST"},
+                        lexer::Token{lexer::TokenKind::TEXT, "first\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::WrongTokenException);
+    }
+
+    UNIT_TEST("Should throw exception when output size is too big")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "SIZE"},
+                        lexer::Token{lexer::TokenKind::INTEGER, "99999999999999999999999"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::IntegerOutOfRangeException);
+    }
+
+    UNIT_TEST("Should parse correct output starts with tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "STARTS"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::TEXT, "Welcome\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *startsWith = dynamic_cast<expectation::OutputStartsWithExpectation*>(data.expectations.at(0).get());
+        REQUIRE(startsWith != nullptr);
+        CHECK(startsWith->GetContent() == "Welcome\n");
+    }
+
+    UNIT_TEST("Should parse correct output digest tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "SHA256"},
+                        lexer::Token{lexer::TokenKind::TEXT, "71fe348d841941fe2c3a1828f01dc9a0cdad7acaef8b41707bd3f36bac3260ba"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *digest = dynamic_cast<expectation::OutputSha256Expectation*>(data.expectations.at(0).get());
+        REQUIRE(digest != nullptr);
+        CHECK(expectation::detail::to_hex(digest->GetExpectedDigest()) == "71fe348d841941fe2c3a1828f01dc9a0cdad7acaef8b41707bd3f36bac3260ba");
+    }
+
+    UNIT_TEST("Should parse correct output with tolerance tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "TOLERANCE"},
+                        lexer::Token{lexer::TokenKind::TEXT, "0.5"},
+                        lexer::Token{lexer::TokenKind::TEXT, "0.25"},
+                        lexer::Token{lexer::TokenKind::TEXT, "pi: 3.14\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *tolerance = dynamic_cast<expectation::OutputWithToleranceExpectation*>(data.expectations.at(0).get());
+        REQUIRE(tolerance != nullptr);
+        CHECK(tolerance->GetContent() == "pi: 3.14\n");
+        CHECK(tolerance->GetTolerance().absolute == 0.5);
+        CHECK(tolerance->GetTolerance().relative == 0.25);
+    }
+
+    UNIT_TEST("Should throw exception when tolerance is missing")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "TOLERANCE"},
+                        lexer::Token{lexer::TokenKind::TEXT, "0.5"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::MissingToleranceException);
+    }
+
+    UNIT_TEST("Should parse correct output JSON tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "JSON"},
+                        lexer::Token{lexer::TokenKind::TEXT, "{\"a\": 1}\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 1);
+        auto *json = dynamic_cast<expectation::OutputJsonExpectation*>(data.expectations.at(0).get());
+        REQUIRE(json != nullptr);
+        CHECK(json->GetContent() == "{\"a\": 1}\n");
+    }
+
+    UNIT_TEST("Should parse normalization filters and apply them to expected output")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "NORMALIZE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "TRIM"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "NORMALIZE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "SQUEEZE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "NORMALIZE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "MASK"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "HEX"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "NORMALIZE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "MASK"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "pid 42  \n\n\n"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "at 0x1f "}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        const normalize::Filters expectedFilters{normalize::Filter::TRIM,
+                                                 normalize::Filter::SQUEEZE,
+                                                 normalize::Filter::MASK_HEX,
+                                                 normalize::Filter::MASK_INT};
+        CHECK(data.normalization == expectedFilters);
+        REQUIRE(data.expectations.size() == 2);
+        auto *output = dynamic_cast<expectation::FullOutputExpectation*>(data.expectations.at(0).get());
+        REQUIRE(output != nullptr);
+        CHECK(output->GetContent() == "pid #\n\n");
+        auto *partialOutput = dynamic_cast<expectation::PartialOutputExpectation*>(data.expectations.at(1).get());
+        REQUIRE(partialOutput != nullptr);
+        CHECK(partialOutput->GetContent() == "at #x#");
+    }
+
+    UNIT_TEST("Should parse correct error output tokens flow")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "ERROR"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "error: bad input\n"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "ERROR"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "bad"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "ERROR"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData &data = sut.parse();
+
+        REQUIRE(data.expectations.size() == 4);
+        auto *errors = dynamic_cast<expectation::FullOutputExpectation*>(data.expectations.at(0).get());
+        REQUIRE(errors != nullptr);
+        CHECK(errors->GetContent() == "error: bad input\n");
+        CHECK(errors->GetStream() == expectation::Stream::ERROR_OUTPUT);
+        auto *partialErrors = dynamic_cast<expectation::PartialOutputExpectation*>(data.expectations.at(1).get());
+        REQUIRE(partialErrors != nullptr);
+        CHECK(partialErrors->GetContent() == "bad");
+        CHECK(partialErrors->GetStream() == expectation::Stream::ERROR_OUTPUT);
+        auto *emptyErrors = dynamic_cast<expectation::EmptyOutputExpectation*>(data.expectations.at(2).get());
+        REQUIRE(emptyErrors != nullptr);
+        CHECK(emptyErrors->GetStream() == expectation::Stream::ERROR_OUTPUT);
+        auto *emptyOutput = dynamic_cast<expectation::EmptyOutputExpectation*>(data.expectations.at(3).get());
+        REQUIRE(emptyOutput != nullptr);
+        CHECK(emptyOutput->GetStream() == expectation::Stream::OUTPUT);
+    }
+
+    UNIT_TEST("Should throw exception when 'OUTPUT' keyword is missing after 'ERROR'")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "IN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "ERROR"},
+                        lexer::Token{lexer::TokenKind::TEXT, "bad"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::WrongTokenException);
+    }
+
+    UNIT_TEST("Should throw exception when normalization filter is unknown")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "NORMALIZE"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "MASK"},
+                        lexer::Token{lexer::TokenKind::TEXT, "DATE"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), exception::WrongTokenException);
+    }
+
+    UNIT_TEST("Should throw exception when expected JSON is not valid")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "JSON"},
+                        lexer::Token{lexer::TokenKind::TEXT, "{\"a\": }\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), json::exception::SyntaxException);
+    }
+
+    UNIT_TEST("Should throw exception when template has unknown placeholder")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "TEMPLATE"},
+                        lexer::Token{lexer::TokenKind::TEXT, "PID: {{number}}\n"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parse(), expectation::exception::TemplateSyntaxException);
+    }
+
+    UNIT_TEST("Should not have next test when file contains one test")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "example input"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        sut.parse();
+
+        CHECK_FALSE(sut.HasNextTest());
+    }
+
+    UNIT_TEST("Should have next test when 'RUN' keyword follows the test")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "first input"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "second input"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const TestData first = sut.parse();
+
+        CHECK(first.input == "first input");
+        CHECK(sut.HasNextTest());
+
+        const TestData second = sut.parse();
+
+        CHECK(second.input == "second input");
+        CHECK_FALSE(sut.HasNextTest());
+    }
+
+    UNIT_TEST("Should parse all tests with their own expectations")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "first input"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "OUTPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "first output"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EMPTY"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXPECT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "EXIT"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "CODE"},
+                        lexer::Token{lexer::TokenKind::INTEGER, "3"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        const std::vector<TestData> tests = sut.parseAll();
+
+        REQUIRE(tests.size() == 2);
+        CHECK(tests.at(0).input == "first input");
+        CheckHasOneExpectation(tests.at(0));
+        CheckOutput(tests.at(0), "first output");
+        CHECK(tests.at(1).input == "");
+        CheckHasOneExpectation(tests.at(1));
+        CheckExitCode(tests.at(1), 3);
+    }
+
+    UNIT_TEST("Should throw exception when next test is incomplete")
+    {
+        LexerFake lexer{lexer::Token{lexer::TokenKind::KEYWORD, "RUN"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "WITH"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "INPUT"},
+                        lexer::Token{lexer::TokenKind::TEXT, "first input"},
+                        lexer::Token{lexer::TokenKind::KEYWORD, "RUN"}
+        };
+        Parser<LexerFake> sut(lexer);
+
+        CHECK_THROWS_AS(sut.parseAll(), exception::MissingKeywordException);
+    }
 }
 
 
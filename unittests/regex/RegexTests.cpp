@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/regex/Matcher.hpp"
+#include "headers/regex/PatternCache.hpp"
+#include "headers/regex/exception/SyntaxException.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+
+namespace omtt::regex
+{
+
+namespace
+{
+
+bool
+MatchChunks(const std::string &pattern, const Mode mode, std::initializer_list<std::string_view> chunks)
+{
+    Regex regex(pattern, mode);
+    Matcher matcher(regex);
+
+    for (const auto &chunk : chunks) {
+        matcher.Feed(chunk);
+    }
+
+    return matcher.Finish();
+}
+
+bool
+Matches(const std::string &pattern, const std::string_view &text)
+{
+    return MatchChunks(pattern, Mode::WHOLE_TEXT, {text});
+}
+
+bool
+Finds(const std::string &pattern, const std::string_view &text)
+{
+    return MatchChunks(pattern, Mode::SEARCH, {text});
+}
+
+}
+
+TEST_GROUP("Whole text matching")
+{
+    UNIT_TEST("Should match literal text")
+    {
+        CHECK(Matches("some output", "some output"));
+        CHECK_FALSE(Matches("some output", "some outpu"));
+        CHECK_FALSE(Matches("some output", "some output\n"));
+    }
+
+    UNIT_TEST("Should match empty pattern only with empty text")
+    {
+        CHECK(Matches("", ""));
+        CHECK_FALSE(Matches("", "a"));
+    }
+
+    UNIT_TEST("Should match repetitions")
+    {
+        CHECK(Matches("ab*c", "ac"));
+        CHECK(Matches("ab*c", "abbbc"));
+        CHECK(Matches("ab+c", "abc"));
+        CHECK_FALSE(Matches("ab+c", "ac"));
+        CHECK(Matches("ab?c", "ac"));
+        CHECK_FALSE(Matches("ab?c", "abbc"));
+        CHECK(Matches("a{3}", "aaa"));
+        CHECK_FALSE(Matches("a{3}", "aaaa"));
+        CHECK(Matches("a{2,}", "aaaaa"));
+        CHECK_FALSE(Matches("a{2,}", "a"));
+        CHECK(Matches("a{1,2}b", "aab"));
+        CHECK_FALSE(Matches("a{1,2}b", "aaab"));
+    }
+
+    UNIT_TEST("Should match alternatives and groups")
+    {
+        CHECK(Matches("(PASS|FAIL): [0-9]+", "FAIL: 12"));
+        CHECK(Matches("(?:ab)+", "ababab"));
+        CHECK_FALSE(Matches("(ab)+", "aba"));
+        CHECK(Matches("a|", ""));
+    }
+
+    UNIT_TEST("Should match byte classes")
+    {
+        CHECK(Matches("[a-c]+", "abcba"));
+        CHECK_FALSE(Matches("[a-c]+", "abd"));
+        CHECK(Matches("[^0-9]+", "abc"));
+        CHECK_FALSE(Matches("[^0-9]+", "ab1"));
+        CHECK(Matches("[]a]+", "]a]"));
+        CHECK(Matches("[a-]+", "a-a"));
+        CHECK(Matches("\\d+\\s\\w+", "123 some_word"));
+        CHECK_FALSE(Matches("\\D", "1"));
+        CHECK(Matches("\\x41\\.", "A."));
+    }
+
+    UNIT_TEST("Should not match new line with dot")
+    {
+        CHECK(Matches(".*", "some text"));
+        CHECK_FALSE(Matches(".*", "some\ntext"));
+        CHECK(Matches(".*\\n.*\\n", "some\ntext\n"));
+    }
+
+    UNIT_TEST("Should match line anchors")
+    {
+        CHECK(Matches("^a$\\n^b$", "a\nb"));
+        CHECK_FALSE(Matches("a^b", "ab"));
+        CHECK(Matches("(.*\\n)*^end$", "some\nlines\nend"));
+        CHECK(Matches("a$\\n$\\n^b", "a\n\nb"));
+    }
+
+    UNIT_TEST("Should match text given in many chunks")
+    {
+        CHECK(MatchChunks("abc[0-9]+", Mode::WHOLE_TEXT, {"a", "", "bc1", "23"}));
+        CHECK(MatchChunks("a$\\n^b", Mode::WHOLE_TEXT, {"a", "\n", "b"}));
+        CHECK_FALSE(MatchChunks("abc", Mode::WHOLE_TEXT, {"ab", "cd"}));
+    }
+
+    UNIT_TEST("Should report the longest matched prefix")
+    {
+        Regex regex("some (output|text)\\n", Mode::WHOLE_TEXT);
+        Matcher matcher(regex);
+
+        CHECK(matcher.Feed("some ou") == 7);
+        CHECK(matcher.Feed("tside") == 1);
+        CHECK(matcher.IsDecided());
+        CHECK_FALSE(matcher.Finish());
+        CHECK(matcher.GetMatchedPrefixSize() == 8);
+    }
+
+    UNIT_TEST("Should report the whole text as matched prefix when text is too short")
+    {
+        Regex regex("abc", Mode::WHOLE_TEXT);
+        Matcher matcher(regex);
+
+        matcher.Feed("ab");
+
+        CHECK_FALSE(matcher.Finish());
+        CHECK(matcher.GetMatchedPrefixSize() == 2);
+    }
+
+    UNIT_TEST("Should reuse compiled regex for many texts")
+    {
+        Regex regex("[a-z]+[0-9]", Mode::WHOLE_TEXT);
+
+        for (int i = 0; i < 3; ++i) {
+            Matcher first(regex);
+            first.Feed("abc1");
+            CHECK(first.Finish());
+
+            Matcher second(regex);
+            second.Feed("abc");
+            CHECK_FALSE(second.Finish());
+        }
+    }
+}
+
+TEST_GROUP("Searching")
+{
+    UNIT_TEST("Should find pattern in the text")
+    {
+        CHECK(Finds("o.t", "some output"));
+        CHECK(Finds("[0-9]{3}", "value: 123."));
+        CHECK_FALSE(Finds("[0-9]{3}", "value: 12."));
+        CHECK(Finds("", ""));
+    }
+
+    UNIT_TEST("Should find pattern at line begin and line end")
+    {
+        CHECK(Finds("^ERROR", "INFO a\nERROR b\n"));
+        CHECK_FALSE(Finds("^ERROR", "INFO ERROR b\n"));
+        CHECK(Finds("b$", "INFO a\nERROR b\n"));
+        CHECK(Finds("b$", "INFO a\nERROR b"));
+        CHECK_FALSE(Finds("^a$", "ab\n"));
+        CHECK(Finds("^$", "a\n\nb"));
+    }
+
+    UNIT_TEST("Should find pattern split between chunks")
+    {
+        CHECK(MatchChunks("needle", Mode::SEARCH, {"hay nee", "dle hay"}));
+        CHECK(MatchChunks("a$", Mode::SEARCH, {"xa", "\nb"}));
+    }
+
+    UNIT_TEST("Should stop consuming text when pattern is found")
+    {
+        Regex regex("found", Mode::SEARCH);
+        Matcher matcher(regex);
+
+        matcher.Feed("it is found");
+
+        CHECK(matcher.IsDecided());
+        CHECK(matcher.Finish());
+    }
+}
+
+TEST_GROUP("Linear time matching")
+{
+    UNIT_TEST("Should match nested repetitions without backtracking")
+    {
+        const std::string text(100000, 'a');
+
+        CHECK_FALSE(Matches("(a*)*b", text));
+        CHECK_FALSE(Matches("(a|aa)+b", text));
+        CHECK(Matches("(a|aa)+", text));
+    }
+
+    UNIT_TEST("Should match when the DFA has too many states")
+    {
+        std::string text;
+        std::uint32_t random = 1;
+        for (int i = 0; i < 20000; ++i) {
+            random = random * 1103515245u + 12345u;
+            text += ((random >> 16) & 1) ? 'a' : 'b';
+        }
+
+        const std::string pattern = "(a|b)*a(a|b){14}";
+        const bool expected = text[text.size() - 15] == 'a';
+
+        Regex regex(pattern, Mode::WHOLE_TEXT);
+        for (int i = 0; i < 2; ++i) {
+            Matcher matcher(regex);
+            matcher.Feed(text);
+            CHECK(matcher.Finish() == expected);
+        }
+
+        CHECK(Matches(pattern, text.substr(0, text.size() - 1) + "a" + std::string(14, 'b')) == true);
+    }
+}
+
+TEST_GROUP("Syntax errors")
+{
+    UNIT_TEST("Should throw exception for invalid patterns")
+    {
+        for (const char *pattern : {"(ab", "ab)", "[ab", "*a", "a{2", "a{3,2}", "a{1001}",
+                                    "\\", "\\q", "[z-a]", "\\x4"}) {
+            CHECK_THROWS_AS(checkSyntax(pattern), exception::SyntaxException);
+        }
+    }
+
+    UNIT_TEST("Should describe the error and its position")
+    {
+        try {
+            checkSyntax("ab(cd");
+            CHECK(false);
+        }
+        catch (const exception::SyntaxException &ex) {
+            CHECK(std::string(ex.what()) == "invalid regular expression 'ab(cd': missing ')' at position 2");
+        }
+    }
+}
+
+TEST_GROUP("Pattern cache")
+{
+    UNIT_TEST("Should compile the same pattern once")
+    {
+        PatternCache sut;
+
+        Regex &first = sut.Get("a+", Mode::WHOLE_TEXT);
+        Regex &second = sut.Get("a+", Mode::WHOLE_TEXT);
+        Regex &search = sut.Get("a+", Mode::SEARCH);
+
+        CHECK(&first == &second);
+        CHECK(&first != &search);
+        CHECK(search.GetMode() == Mode::SEARCH);
+    }
+
+    UNIT_TEST("Should throw exception for invalid pattern")
+    {
+        PatternCache sut;
+
+        CHECK_THROWS_AS(sut.Get("(", Mode::SEARCH), exception::SyntaxException);
+    }
+}
+
+}
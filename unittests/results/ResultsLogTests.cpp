@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024, Adam Chyła <adam@chyla.org>.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unittests/test_framework.hpp"
+
+#include "headers/exception/FileReadException.hpp"
+#include "headers/logger/ResultsLogLogger.hpp"
+#include "headers/results/Report.hpp"
+#include "headers/results/ResultsLog.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+namespace omtt::results
+{
+
+namespace
+{
+
+const Path logFilePath = "results_log_tests-results.log";
+const Path contextFilePath = logFilePath + detail::CONTEXT_FILE_SUFFIX;
+
+const std::string exitCodeMessage = "Exit code doesn't match.\n"
+                                    "Expected: 0\n"
+                                    "Got: 3";
+
+void
+WriteLog()
+{
+    std::ofstream logFile(logFilePath, std::ios::binary | std::ios::trunc);
+    std::ofstream contextFile(contextFilePath, std::ios::binary | std::ios::trunc);
+    logger::ResultsLogLogger logger(logFile, contextFile);
+
+    logger.SutPath("/bin/cat");
+
+    logger.BeginTestExecution(1, 3, "first.omtt");
+    logger.EndTestExecution({0, "output", "warning\n"}, {Verdict::PASS, {}, std::chrono::microseconds(1500)});
+
+    logger.BeginTestExecution(2, 3, "second.omtt");
+    logger.EndTestExecution({3, "output", "error\n", {std::chrono::milliseconds(3),
+                                                     std::chrono::microseconds(1500),
+                                                     std::chrono::microseconds(250),
+                                                     2048, 100, 1, 3, 4}},
+                            {Verdict::FAIL,
+                             {expectation::validation::ExitCodeCause{0, 3},
+                              expectation::validation::RecordedCause{"recorded"}},
+                             std::chrono::milliseconds(2)});
+
+    logger.BeginTestExecution(3, 3, "dir/third.omtt");
+    logger.EndTestExecution({0, "", ""}, {Verdict::PASS, {}, std::chrono::nanoseconds(0)});
+
+    logger.OverallStatistics(3, 2, 1);
+}
+
+std::string
+ReadFile(const Path &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void
+WriteFile(const Path &path, const std::string &content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+// records the replayed events
+class RecordingLogger : public logger::Logger
+{
+public:
+    void SutPath(const std::string &path) override { fEvents.push_back("sut " + path); }
+
+    void
+    BeginTestExecution(const omtt::TestPaths::size_type executedTests,
+                       const omtt::TestPaths::size_type numberOfTests,
+                       const omtt::Path &testPath) override
+    {
+        fEvents.push_back("begin " + std::to_string(executedTests) + "/" + std::to_string(numberOfTests) + " " + testPath);
+    }
+
+    void
+    EndTestExecution(const omtt::ProcessResults &processResults,
+                     const omtt::TestExecutionSummary &summary) override
+    {
+        fEvents.push_back(std::string("end ") + to_cstring(summary.verdict)
+                          + " " + std::to_string(processResults.exitCode)
+                          + " " + std::to_string(summary.causes.size()));
+    }
+
+    void
+    OverallStatistics(const omtt::TestPaths::size_type executedTests,
+                      const omtt::TestPaths::size_type numberOfTestsPassed,
+                      const omtt::TestPaths::size_type numberOfTestsFailed) override
+    {
+        fEvents.push_back("total " + std::to_string(executedTests)
+                          + " " + std::to_string(numberOfTestsPassed)
+                          + " " + std::to_string(numberOfTestsFailed));
+    }
+
+    std::vector<std::string> fEvents;
+};
+
+}
+
+TEST_CASE("Should read back the logged tests")
+{
+    WriteLog();
+
+    const ResultsLog log(logFilePath);
+
+    CHECK(log.GetSutPath() == "/bin/cat");
+    REQUIRE(log.GetTestsCount() == 3);
+
+    const TestResult first = log.GetTest(0);
+    CHECK(first.number == 1);
+    CHECK(first.numberOfTests == 3);
+    CHECK(first.path == "first.omtt");
+    CHECK(first.verdict == Verdict::PASS);
+    CHECK(first.exitCode == 0);
+    CHECK(first.duration == std::chrono::microseconds(1500));
+    CHECK(first.errors == "warning\n");
+    CHECK(first.causes.empty());
+    CHECK(first.causeKinds.empty());
+
+    const TestResult second = log.GetTest(1);
+    CHECK(second.number == 2);
+    CHECK(second.path == "second.omtt");
+    CHECK(second.verdict == Verdict::FAIL);
+    CHECK(second.exitCode == 3);
+    CHECK(second.duration == std::chrono::milliseconds(2));
+    CHECK(second.errors == "error\n");
+    CHECK(second.resources.wallTime == std::chrono::milliseconds(3));
+    CHECK(second.resources.userTime == std::chrono::microseconds(1500));
+    CHECK(second.resources.systemTime == std::chrono::microseconds(250));
+    CHECK(second.resources.maxResidentSetSizeKb == 2048);
+    CHECK(second.resources.minorPageFaults == 100);
+    CHECK(second.resources.majorPageFaults == 1);
+    CHECK(second.resources.voluntaryContextSwitches == 3);
+    CHECK(second.resources.involuntaryContextSwitches == 4);
+    REQUIRE(second.causes.size() == 2);
+    CHECK(second.causes.at(0) == exitCodeMessage);
+    CHECK(second.causes.at(1) == "recorded");
+    CHECK(second.causeKinds == std::vector<detail::CauseKind>{detail::CauseKind::EXIT_CODE, detail::CauseKind::NONE});
+
+    CHECK(log.GetTest(2).path == "dir/third.omtt");
+}
+
+TEST_CASE("Should ignore the incomplete record at the end of the log")
+{
+    WriteLog();
+    const std::string content = ReadFile(logFilePath);
+    WriteFile(logFilePath, content.substr(0, content.size() - 10));
+
+    const ResultsLog log(logFilePath);
+
+    CHECK(log.GetTestsCount() == 2);
+}
+
+TEST_CASE("Should ignore the records with texts missing from the context file")
+{
+    WriteLog();
+    const std::string context = ReadFile(contextFilePath);
+    WriteFile(contextFilePath, context.substr(0, context.find("dir/third.omtt")));
+
+    const ResultsLog log(logFilePath);
+
+    CHECK(log.GetTestsCount() == 2);
+}
+
+TEST_CASE("Should throw when the file isn't a results log")
+{
+    WriteFile(logFilePath, std::string(64, 'x'));
+    WriteFile(contextFilePath, "");
+
+    CHECK_THROWS_AS(ResultsLog{logFilePath}, exception::FileReadException);
+}
+
+TEST_CASE("Should replay all logged tests")
+{
+    WriteLog();
+    const ResultsLog log(logFilePath);
+    RecordingLogger logger;
+
+    const auto numberOfTestsFailed = render_report(log, {}, logger);
+
+    CHECK(numberOfTestsFailed == 1);
+    CHECK(logger.fEvents == std::vector<std::string>{"sut /bin/cat",
+                                                     "begin 1/3 first.omtt",
+                                                     "end PASS 0 0",
+                                                     "begin 2/3 second.omtt",
+                                                     "end FAIL 3 2",
+                                                     "begin 3/3 dir/third.omtt",
+                                                     "end PASS 0 0",
+                                                     "total 3 2 1"});
+}
+
+TEST_CASE("Should replay only the tests matching the filter")
+{
+    WriteLog();
+    const ResultsLog log(logFilePath);
+
+    RecordingLogger failedLogger;
+    render_report(log, {Verdict::FAIL, "", std::nullopt}, failedLogger);
+    CHECK(failedLogger.fEvents == std::vector<std::string>{"sut /bin/cat",
+                                                           "begin 2/3 second.omtt",
+                                                           "end FAIL 3 2",
+                                                           "total 1 0 1"});
+
+    RecordingLogger pathLogger;
+    const auto numberOfTestsFailed = render_report(log, {Verdict::PASS, "dir/", std::nullopt}, pathLogger);
+    CHECK(numberOfTestsFailed == 0);
+    CHECK(pathLogger.fEvents == std::vector<std::string>{"sut /bin/cat",
+                                                         "begin 3/3 dir/third.omtt",
+                                                         "end PASS 0 0",
+                                                         "total 1 1 0"});
+}
+
+TEST_CASE("Should replay only the tests failed with the cause kind")
+{
+    WriteLog();
+    const ResultsLog log(logFilePath);
+
+    RecordingLogger exitCodeLogger;
+    render_report(log, {std::nullopt, "", detail::CauseKind::EXIT_CODE}, exitCodeLogger);
+    CHECK(exitCodeLogger.fEvents == std::vector<std::string>{"sut /bin/cat",
+                                                             "begin 2/3 second.omtt",
+                                                             "end FAIL 3 2",
+                                                             "total 1 0 1"});
+
+    RecordingLogger outputFileLogger;
+    render_report(log, {std::nullopt, "", detail::CauseKind::OUTPUT_FILE}, outputFileLogger);
+    CHECK(outputFileLogger.fEvents == std::vector<std::string>{"sut /bin/cat", "total 0 0 0"});
+}
+
+TEST_CASE("Should find the cause kind by its name")
+{
+    CHECK(cause_kind_from_name("EXIT_CODE") == detail::CauseKind::EXIT_CODE);
+    CHECK(cause_kind_from_name("INPUT_FILE") == detail::CauseKind::INPUT_FILE);
+    CHECK(!cause_kind_from_name("NONE").has_value());
+    CHECK(!cause_kind_from_name("exit_code").has_value());
+}
+
+}  // omtt::results
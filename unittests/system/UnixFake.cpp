@@ -48,6 +48,12 @@ WaitPid(pid_t pid, int *wstatus, int options)
     return GlobalFake().WaitPidAction(pid, wstatus, options);
 }
 
+int
+Wait4(pid_t pid, int *wstatus, int options, struct rusage *rusage)
+{
+    return GlobalFake().Wait4Action(pid, wstatus, options, rusage);
+}
+
 void
 DuplicateFd(int oldFd, int newFd)
 {
@@ -96,4 +102,10 @@ Kill(pid_t pid, int sig)
     return GlobalFake().KillAction(pid, sig);
 }
 
+int
+Open(const std::string &path, int flags, mode_t mode)
+{
+    return GlobalFake().OpenAction(path, flags, mode);
+}
+
 }  // omtt::system::unix
@@ -24,6 +24,7 @@ struct UnixFake
     std::function<void (int)> CloseAction;
     std::function<ssize_t ()> ForkAction;
     std::function<int (pid_t pid, int *wstatus, int options)> WaitPidAction;
+    std::function<int (pid_t pid, int *wstatus, int options, struct rusage *rusage)> Wait4Action;
     std::function<void (int, int)> DuplicateFdAction;
     std::function<void (const std::string &, const std::vector<std::string> &)> ExecAction;
     std::function<void (int)> TerminateAction;
@@ -32,6 +33,7 @@ struct UnixFake
     std::function<int (struct pollfd *fds, nfds_t nfds, int timeout)> PollAction;
     std::function<int (int fd, int cmd, int arg)> FcntlAction;
     std::function<void (pid_t pid, int sig)> KillAction;
+    std::function<int (const std::string &, int, mode_t)> OpenAction;
 };
 
 inline UnixFake& GlobalFake()